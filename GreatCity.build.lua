@@ -1,3 +1,15 @@
+newoption
+{
+    trigger = "cpu-picking",
+    description = "Pick entities by ray casting on the CPU instead of reading back an entity ID attachment"
+}
+
+newoption
+{
+    trigger = "cpu-culling",
+    description = "Frustum cull instances on the CPU instead of dispatching the culling compute shader"
+}
+
 workspace "GreatCity"
     architecture "x86_64"
     startproject "GreatCity"
@@ -72,6 +84,50 @@ project "GreatCity"
             "ShLwApi"
         }
 
+        removefiles
+        {
+            "%{wks.location}/GreatCity/Source/Platform/Linux/**",
+            "%{wks.location}/GreatCity/Source/Renderer/Vulkan/Linux/**",
+            "%{wks.location}/GreatCity/Source/ImGui/Platform/Linux/**"
+        }
+
+    filter "system:linux"
+        defines
+        {
+            "GC_PLATFORM_LINUX",
+            "_DEFAULT_SOURCE"
+        }
+
+        includedirs
+        {
+            "$(VULKAN_SDK)/include"
+        }
+
+        libdirs
+        {
+            "$(VULKAN_SDK)/lib"
+        }
+
+        removelinks
+        {
+            "vulkan-1"
+        }
+
+        links
+        {
+            "vulkan",
+            "stdc++",
+            "pthread",
+            "m"
+        }
+
+        removefiles
+        {
+            "%{wks.location}/GreatCity/Source/Platform/Windows/**",
+            "%{wks.location}/GreatCity/Source/Renderer/Vulkan/Windows/**",
+            "%{wks.location}/GreatCity/Source/ImGui/Platform/Windows/**"
+        }
+
     filter "configurations:Debug"
         defines
         {
@@ -113,9 +169,33 @@ project "GreatCity"
         runtime "Release"
         optimize "On"
 
+    filter { "system:linux", "configurations:Debug or Release" }
+        removelinks
+        {
+            "shaderc_sharedd"
+        }
+
+        links
+        {
+            "shaderc_shared"
+        }
+
+    filter "options:cpu-picking"
+        defines "GC_RENDERER_CPU_PICKING"
+
+    filter "options:cpu-culling"
+        defines "GC_RENDERER_CPU_CULLING"
+
 group "Dependencies"
     include "GreatCity/Source/ThirdParty/libpng/libpng.build.lua"
     include "GreatCity/Source/ThirdParty/zlib/zlib.build.lua"
     include "GreatCity/Source/ThirdParty/Flecs/Flecs.build.lua"
     include "GreatCity/Source/ThirdParty/ImGui/ImGui.build.lua"
-    include "GreatCity/Source/ThirdParty/ImGuizmo/ImGuizmo.build.lua"
\ No newline at end of file
+    include "GreatCity/Source/ThirdParty/ImGuizmo/ImGuizmo.build.lua"
+
+group "Benchmarks"
+    include "GreatCity/Benchmarks/JobSystemBenchmark.build.lua"
+    include "GreatCity/Benchmarks/ModelImportBenchmark.build.lua"
+
+group "Tests"
+    include "GreatCity/Tests/JobSystemTest.build.lua"
\ No newline at end of file
@@ -26,7 +26,9 @@ layout(location = 4) in flat int FragmentEntityID;
 layout(binding = 1) uniform sampler2D TextureSampler;
 
 layout(location = 0) out vec4 Color;
+#ifndef GC_RENDERER_CPU_PICKING
 layout(location = 1) out int EntityID;
+#endif
 
 void main()
 {
@@ -43,5 +45,7 @@ void main()
     const vec3 ColorResult = (Ambient + Diffuse) * vec3(FragmentColor);
 
 	Color = vec4(ColorResult, 1.0);
+#ifndef GC_RENDERER_CPU_PICKING
     EntityID = FragmentEntityID;
+#endif
 }
\ No newline at end of file
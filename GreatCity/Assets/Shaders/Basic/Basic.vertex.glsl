@@ -22,6 +22,7 @@ layout(location = 1) in vec3 Normal;
 layout(location = 2) in vec4 Color;
 layout(location = 3) in vec2 TextureCoordinate;
 layout(location = 4) in int EntityID;
+layout(location = 5) in mat4 ModelMatrix;
 
 layout(binding = 0) uniform UniformBuffer
 {
@@ -36,10 +37,12 @@ layout(location = 4) out int FragmentEntityID;
 
 void main()
 {
-	gl_Position = UniformBufferData.ViewProjectionMatrix * vec4(Position, 1.0);
+	const vec4 WorldPosition = ModelMatrix * vec4(Position, 1.0);
+	gl_Position = UniformBufferData.ViewProjectionMatrix * WorldPosition;
 
+	FragmentPosition = WorldPosition.xyz;
 	FragmentTextureCoordinate = TextureCoordinate;
-    FragmentNormal = Normal;
+    FragmentNormal = mat3(transpose(inverse(ModelMatrix))) * Normal;
 	FragmentColor = Color;
     FragmentEntityID = EntityID;
 }
\ No newline at end of file
@@ -0,0 +1,93 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#version 450
+
+layout(local_size_x = 64) in;
+
+struct InputInstance
+{
+	mat4 Transform;
+	vec4 BoundingSphere;
+	uint EntityID;
+	uint BatchIndex;
+};
+
+struct OutputInstance
+{
+	mat4 Transform;
+	uint EntityID;
+};
+
+struct DrawIndexedIndirectCommand
+{
+	uint IndexCount;
+	uint InstanceCount;
+	uint FirstIndex;
+	int VertexOffset;
+	uint FirstInstance;
+};
+
+layout(std430, binding = 0) readonly buffer InputInstanceBuffer
+{
+	InputInstance InputInstances[];
+};
+
+layout(std430, binding = 1) writeonly buffer OutputInstanceBuffer
+{
+	OutputInstance OutputInstances[];
+};
+
+layout(std430, binding = 2) buffer IndirectCommandBuffer
+{
+	DrawIndexedIndirectCommand IndirectCommands[];
+};
+
+layout(push_constant) uniform PushConstant
+{
+	vec4 FrustumPlanes[6];
+	uint InstanceCount;
+} PushConstantData;
+
+void main()
+{
+	const uint InstanceIndex = gl_GlobalInvocationID.x;
+
+	if (InstanceIndex >= PushConstantData.InstanceCount)
+	{
+		return;
+	}
+
+	const vec4 BoundingSphere = InputInstances[InstanceIndex].BoundingSphere;
+	bool IsVisible = true;
+
+	for (int Counter = 0; Counter < 6; Counter++)
+	{
+		const vec4 Plane = PushConstantData.FrustumPlanes[Counter];
+		IsVisible = IsVisible && dot(Plane.xyz, BoundingSphere.xyz) + Plane.w >= -BoundingSphere.w;
+	}
+
+	if (IsVisible)
+	{
+		const uint BatchIndex = InputInstances[InstanceIndex].BatchIndex;
+		const uint OutputIndex =
+			IndirectCommands[BatchIndex].FirstInstance + atomicAdd(IndirectCommands[BatchIndex].InstanceCount, 1);
+
+		OutputInstances[OutputIndex].Transform = InputInstances[InstanceIndex].Transform;
+		OutputInstances[OutputIndex].EntityID = InputInstances[InstanceIndex].EntityID;
+	}
+}
@@ -0,0 +1,156 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Core/Clock.h"
+#include "Core/Jobs/JobSystem.h"
+#include "Core/Log.h"
+#include "Core/Memory/Allocator.h"
+#include "Core/Thread.h"
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define GC_JOB_SYSTEM_BENCHMARK_ITEM_COUNT (1u << 22)
+#define GC_JOB_SYSTEM_BENCHMARK_GRAIN_SIZE 1024
+#define GC_JOB_SYSTEM_BENCHMARK_SMALL_JOB_COUNT 100000
+#define GC_JOB_SYSTEM_BENCHMARK_ITERATION_COUNT 5
+
+typedef struct GCJobSystemBenchmarkData
+{
+    const float* Inputs;
+    float* Outputs;
+} GCJobSystemBenchmarkData;
+
+static void GCJobSystemBenchmark_UpdateItems(const uint32_t Start, const uint32_t End, void* Data);
+static void GCJobSystemBenchmark_RunSmallJob(void* Data);
+static double GCJobSystemBenchmark_RunParallelFor(GCJobSystemBenchmarkData* const Data);
+static double GCJobSystemBenchmark_RunSmallJobs(void);
+
+int main(void)
+{
+    GCJobSystemBenchmarkData Data;
+    Data.Inputs = (const float*)GCMemory_Allocate(GC_JOB_SYSTEM_BENCHMARK_ITEM_COUNT * sizeof(float));
+    Data.Outputs = (float*)GCMemory_Allocate(GC_JOB_SYSTEM_BENCHMARK_ITEM_COUNT * sizeof(float));
+
+    for (uint32_t Counter = 0; Counter < GC_JOB_SYSTEM_BENCHMARK_ITEM_COUNT; Counter++)
+    {
+        ((float*)Data.Inputs)[Counter] = (float)Counter * 0.001f;
+    }
+
+    const uint32_t HardwareThreadCount = GCThread_GetHardwareThreadCount();
+
+    double SingleThreadTime = 0.0;
+
+    for (uint32_t ThreadCount = 1;; ThreadCount *= 2)
+    {
+        if (ThreadCount > HardwareThreadCount)
+        {
+            ThreadCount = HardwareThreadCount;
+        }
+
+        GCJobSystem_Initialize(ThreadCount - 1);
+
+        const double ParallelForTime = GCJobSystemBenchmark_RunParallelFor(&Data);
+        const double SmallJobTime = GCJobSystemBenchmark_RunSmallJobs();
+
+        if (ThreadCount == 1)
+        {
+            SingleThreadTime = ParallelForTime;
+        }
+
+        GC_LOG_INFORMATION("%3u threads: ParallelFor %8.3f ms (%5.2fx), %u small jobs %8.3f ms (%6.1f ns per job)",
+                           GCJobSystem_GetThreadCount(), ParallelForTime * 1000.0,
+                           SingleThreadTime / ParallelForTime, GC_JOB_SYSTEM_BENCHMARK_SMALL_JOB_COUNT,
+                           SmallJobTime * 1000.0, SmallJobTime * 1000000000.0 / GC_JOB_SYSTEM_BENCHMARK_SMALL_JOB_COUNT);
+
+        GCJobSystem_Terminate();
+
+        if (ThreadCount == HardwareThreadCount)
+        {
+            break;
+        }
+    }
+
+    GCMemory_Free((void*)Data.Inputs);
+    GCMemory_Free(Data.Outputs);
+
+    return 0;
+}
+
+void GCJobSystemBenchmark_UpdateItems(const uint32_t Start, const uint32_t End, void* Data)
+{
+    GCJobSystemBenchmarkData* const BenchmarkData = (GCJobSystemBenchmarkData* const)Data;
+
+    for (uint32_t Counter = Start; Counter < End; Counter++)
+    {
+        const float Input = BenchmarkData->Inputs[Counter];
+        BenchmarkData->Outputs[Counter] = sqrtf(sinf(Input) * sinf(Input) + cosf(Input) * 2.0f + 3.0f);
+    }
+}
+
+void GCJobSystemBenchmark_RunSmallJob(void* Data)
+{
+    (void)Data;
+}
+
+double GCJobSystemBenchmark_RunParallelFor(GCJobSystemBenchmarkData* const Data)
+{
+    GCJobCounter* JobCounter = GCJobCounter_Create();
+
+    double BestTime = 0.0;
+
+    for (uint32_t Iteration = 0; Iteration < GC_JOB_SYSTEM_BENCHMARK_ITERATION_COUNT; Iteration++)
+    {
+        const double StartTime = GCClock_GetTime();
+
+        GCJobSystem_ParallelFor(GC_JOB_SYSTEM_BENCHMARK_ITEM_COUNT, GC_JOB_SYSTEM_BENCHMARK_GRAIN_SIZE,
+                                GCJobSystemBenchmark_UpdateItems, Data, JobCounter);
+        GCJobSystem_Wait(JobCounter);
+
+        const double Time = GCClock_GetTime() - StartTime;
+
+        if (!Iteration || Time < BestTime)
+        {
+            BestTime = Time;
+        }
+    }
+
+    GCJobCounter_Destroy(JobCounter);
+
+    return BestTime;
+}
+
+double GCJobSystemBenchmark_RunSmallJobs(void)
+{
+    GCJobCounter* JobCounter = GCJobCounter_Create();
+
+    const double StartTime = GCClock_GetTime();
+
+    for (uint32_t Counter = 0; Counter < GC_JOB_SYSTEM_BENCHMARK_SMALL_JOB_COUNT; Counter++)
+    {
+        GCJobSystem_Run(GCJobSystemBenchmark_RunSmallJob, NULL, JobCounter);
+    }
+
+    GCJobSystem_Wait(JobCounter);
+
+    const double Time = GCClock_GetTime() - StartTime;
+
+    GCJobCounter_Destroy(JobCounter);
+
+    return Time;
+}
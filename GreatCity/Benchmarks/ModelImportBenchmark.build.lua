@@ -0,0 +1,87 @@
+project "ModelImportBenchmark"
+    kind "ConsoleApp"
+    language "C++"
+    cdialect "C11"
+    cppdialect "C++17"
+    warnings "Extra"
+
+    debugdir "%{wks.location}/GreatCity"
+    targetdir "%{wks.location}/Binaries/%{cfg.architecture}/%{cfg.buildcfg}"
+    objdir "%{wks.location}/Intermediates/%{cfg.architecture}/%{cfg.buildcfg}"
+
+    files
+    {
+        "%{wks.location}/GreatCity/Benchmarks/ModelImportBenchmark.cpp",
+
+        "%{wks.location}/GreatCity/Source/Core/Build/Implementation/tiny_obj_loader.cpp",
+        "%{wks.location}/GreatCity/Source/Core/Log.c",
+        "%{wks.location}/GreatCity/Source/Core/Memory/Allocator.c",
+        "%{wks.location}/GreatCity/Source/Math/**.c",
+        "%{wks.location}/GreatCity/Source/Renderer/RendererModelImport.cpp",
+        "%{wks.location}/GreatCity/Source/Renderer/RendererModelVertexTable.c"
+    }
+
+    includedirs
+    {
+        "%{wks.location}/GreatCity/Source",
+
+        "%{wks.location}/GreatCity/Source/ThirdParty/TinyObjLoader/Include"
+    }
+
+    flags "FatalWarnings"
+
+    filter "system:windows"
+        systemversion "latest"
+
+        defines "GC_PLATFORM_WINDOWS"
+
+        files
+        {
+            "%{wks.location}/GreatCity/Source/Platform/Windows/Core/WindowsAtomic.c",
+            "%{wks.location}/GreatCity/Source/Platform/Windows/Core/WindowsClock.c",
+            "%{wks.location}/GreatCity/Source/Platform/Windows/Core/WindowsLog.c"
+        }
+
+    filter "system:linux"
+        defines
+        {
+            "GC_PLATFORM_LINUX",
+            "_DEFAULT_SOURCE"
+        }
+
+        files
+        {
+            "%{wks.location}/GreatCity/Source/Platform/Linux/Core/LinuxAtomic.c",
+            "%{wks.location}/GreatCity/Source/Platform/Linux/Core/LinuxClock.c",
+            "%{wks.location}/GreatCity/Source/Platform/Linux/Core/LinuxLog.c"
+        }
+
+        links "m"
+
+        disablewarnings "ignored-qualifiers"
+
+    filter "configurations:Debug"
+        defines
+        {
+            "GC_BUILD_TYPE_DEBUG",
+            "GC_ASSERT_ENABLED"
+        }
+
+        runtime "Debug"
+        symbols "On"
+
+    filter "configurations:Release"
+        defines
+        {
+            "GC_BUILD_TYPE_RELEASE",
+            "GC_ASSERT_ENABLED"
+        }
+
+        runtime "Release"
+        symbols "On"
+
+    filter "configurations:Distribution"
+        defines "GC_BUILD_TYPE_DISTRIBUTION"
+
+        runtime "Release"
+        optimize "On"
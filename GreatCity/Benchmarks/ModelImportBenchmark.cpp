@@ -0,0 +1,212 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Core/Clock.h"
+#include "Core/Log.h"
+#include "Renderer/Renderer.h"
+#include "Renderer/RendererModelImport.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include <tiny_obj_loader.h>
+
+#define GC_MODEL_IMPORT_BENCHMARK_MODEL_PATH "Assets/Models/Buildings/Offices/Office.obj"
+#define GC_MODEL_IMPORT_BENCHMARK_MATERIAL_PATH "Assets/Models/Buildings/Offices"
+#define GC_MODEL_IMPORT_BENCHMARK_ITERATION_COUNT 10
+
+typedef struct GCModelImportBenchmarkResult
+{
+    double WeldTime;
+    uint32_t VertexCount;
+    uint32_t IndexCount;
+} GCModelImportBenchmarkResult;
+
+namespace std
+{
+template <> struct hash<GCRendererVertex>
+{
+    size_t operator()(const GCRendererVertex& Vertex) const
+    {
+        const float Values[12] = {Vertex.Position.X,
+                                  Vertex.Position.Y,
+                                  Vertex.Position.Z,
+                                  Vertex.Normal.X,
+                                  Vertex.Normal.Y,
+                                  Vertex.Normal.Z,
+                                  Vertex.Color.X,
+                                  Vertex.Color.Y,
+                                  Vertex.Color.Z,
+                                  Vertex.Color.W,
+                                  Vertex.TextureCoordinate.X,
+                                  Vertex.TextureCoordinate.Y};
+
+        size_t Seed = 0;
+
+        for (const float Value : Values)
+        {
+            Seed ^= std::hash<float>{}(Value) + 0x9e3779b9 + (Seed << 6) + (Seed >> 2);
+        }
+
+        return Seed;
+    }
+};
+} // namespace std
+
+static GCRendererVertex GCModelImportBenchmark_CreateVertex(const tinyobj::ObjReader& Reader,
+                                                            const tinyobj::index_t Index, const int32_t MaterialIndex);
+static void GCModelImportBenchmark_WeldWithUnorderedMap(const tinyobj::ObjReader& Reader,
+                                                        std::vector<GCRendererVertex>& Vertices,
+                                                        std::vector<uint32_t>& Indices);
+static GCModelImportBenchmarkResult GCModelImportBenchmark_Run(
+    const tinyobj::ObjReader& Reader,
+    void (*Weld)(const tinyobj::ObjReader&, std::vector<GCRendererVertex>&, std::vector<uint32_t>&));
+
+int main(void)
+{
+    tinyobj::ObjReaderConfig ReaderConfiguration{};
+    ReaderConfiguration.mtl_search_path = GC_MODEL_IMPORT_BENCHMARK_MATERIAL_PATH;
+
+    tinyobj::ObjReader Reader{};
+
+    const double ParseStartTime = GCClock_GetTime();
+
+    if (!Reader.ParseFromFile(GC_MODEL_IMPORT_BENCHMARK_MODEL_PATH, ReaderConfiguration))
+    {
+        GC_LOG_ERROR("Failed to load an OBJ file: %s with error: %s", GC_MODEL_IMPORT_BENCHMARK_MODEL_PATH,
+                     Reader.Error().c_str());
+
+        return 1;
+    }
+
+    const double ParseTime = GCClock_GetTime() - ParseStartTime;
+
+    GC_LOG_INFORMATION("Parsed %s in %.3f ms", GC_MODEL_IMPORT_BENCHMARK_MODEL_PATH, ParseTime * 1000.0);
+
+    const GCModelImportBenchmarkResult UnorderedMapResult =
+        GCModelImportBenchmark_Run(Reader, GCModelImportBenchmark_WeldWithUnorderedMap);
+    const GCModelImportBenchmarkResult VertexTableResult =
+        GCModelImportBenchmark_Run(Reader, GCRendererModelImport_WeldVertices);
+
+    GC_LOG_INFORMATION("std::unordered_map: weld %8.3f ms, import %8.3f ms, %u vertices, %u indices",
+                       UnorderedMapResult.WeldTime * 1000.0, (ParseTime + UnorderedMapResult.WeldTime) * 1000.0,
+                       UnorderedMapResult.VertexCount, UnorderedMapResult.IndexCount);
+    GC_LOG_INFORMATION("Vertex table:       weld %8.3f ms, import %8.3f ms, %u vertices, %u indices (%.2fx weld)",
+                       VertexTableResult.WeldTime * 1000.0, (ParseTime + VertexTableResult.WeldTime) * 1000.0,
+                       VertexTableResult.VertexCount, VertexTableResult.IndexCount,
+                       UnorderedMapResult.WeldTime / VertexTableResult.WeldTime);
+
+    return 0;
+}
+
+GCRendererVertex GCModelImportBenchmark_CreateVertex(const tinyobj::ObjReader& Reader, const tinyobj::index_t Index,
+                                                     const int32_t MaterialIndex)
+{
+    const tinyobj::attrib_t& Attribute = Reader.GetAttrib();
+
+    GCRendererVertex Vertex{};
+
+    if (Index.vertex_index >= 0)
+    {
+        Vertex.Position = GCVector3_Create(Attribute.vertices[3 * Index.vertex_index + 0],
+                                           Attribute.vertices[3 * Index.vertex_index + 1],
+                                           Attribute.vertices[3 * Index.vertex_index + 2]);
+    }
+
+    if (Index.normal_index >= 0)
+    {
+        Vertex.Normal = GCVector3_Create(Attribute.normals[3 * Index.normal_index + 0],
+                                         Attribute.normals[3 * Index.normal_index + 1],
+                                         Attribute.normals[3 * Index.normal_index + 2]);
+    }
+
+    if (Index.texcoord_index >= 0)
+    {
+        Vertex.TextureCoordinate = GCVector2_Create(Attribute.texcoords[2 * Index.texcoord_index + 0],
+                                                    Attribute.texcoords[2 * Index.texcoord_index + 1]);
+    }
+
+    const tinyobj::material_t& Material = Reader.GetMaterials()[MaterialIndex];
+    Vertex.Color = GCVector4_Create(Material.diffuse[0], Material.diffuse[1], Material.diffuse[2], 1.0f);
+
+    return Vertex;
+}
+
+void GCModelImportBenchmark_WeldWithUnorderedMap(const tinyobj::ObjReader& Reader,
+                                                 std::vector<GCRendererVertex>& Vertices,
+                                                 std::vector<uint32_t>& Indices)
+{
+    std::unordered_map<GCRendererVertex, uint32_t> UniqueVertices{};
+
+    for (const tinyobj::shape_t& Shape : Reader.GetShapes())
+    {
+        uint32_t IndexOffset = 0;
+
+        for (uint32_t FaceIndex = 0; FaceIndex < Shape.mesh.num_face_vertices.size(); FaceIndex++)
+        {
+            const uint32_t Face = Shape.mesh.num_face_vertices[FaceIndex];
+
+            for (uint32_t FaceVertex = 0; FaceVertex < Face; FaceVertex++)
+            {
+                const GCRendererVertex Vertex = GCModelImportBenchmark_CreateVertex(
+                    Reader, Shape.mesh.indices[IndexOffset + FaceVertex], Shape.mesh.material_ids[FaceIndex]);
+
+                if (UniqueVertices.count(Vertex) == 0)
+                {
+                    UniqueVertices[Vertex] = static_cast<uint32_t>(Vertices.size());
+                    Vertices.emplace_back(Vertex);
+                }
+
+                Indices.emplace_back(UniqueVertices[Vertex]);
+            }
+
+            IndexOffset += Face;
+        }
+    }
+}
+
+GCModelImportBenchmarkResult GCModelImportBenchmark_Run(
+    const tinyobj::ObjReader& Reader,
+    void (*Weld)(const tinyobj::ObjReader&, std::vector<GCRendererVertex>&, std::vector<uint32_t>&))
+{
+    GCModelImportBenchmarkResult Result{};
+
+    for (uint32_t Iteration = 0; Iteration < GC_MODEL_IMPORT_BENCHMARK_ITERATION_COUNT; Iteration++)
+    {
+        std::vector<GCRendererVertex> Vertices{};
+        std::vector<uint32_t> Indices{};
+
+        const double StartTime = GCClock_GetTime();
+
+        Weld(Reader, Vertices, Indices);
+
+        const double Time = GCClock_GetTime() - StartTime;
+
+        if (!Iteration || Time < Result.WeldTime)
+        {
+            Result.WeldTime = Time;
+        }
+
+        Result.VertexCount = static_cast<uint32_t>(Vertices.size());
+        Result.IndexCount = static_cast<uint32_t>(Indices.size());
+    }
+
+    return Result;
+}
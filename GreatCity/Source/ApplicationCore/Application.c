@@ -19,7 +19,12 @@
 #include "ApplicationCore/Event/ApplicationEvent.h"
 #include "ApplicationCore/Event/Event.h"
 #include "ApplicationCore/GenericPlatform/Window.h"
+#include "Core/Clock.h"
+#include "Core/Jobs/JobSystem.h"
+#include "Core/Log.h"
 #include "Core/Memory/Allocator.h"
+#include "Core/Memory/FrameAllocator.h"
+#include "Core/Thread.h"
 #include "Math/Matrix4x4.h"
 #include "Math/Utilities.h"
 #include "Renderer/Renderer.h"
@@ -28,13 +33,28 @@
 #include "UI/UI.h"
 #include "World/World.h"
 
+#include <inttypes.h>
 #include <stdbool.h>
+#include <stdint.h>
+
+#define GC_APPLICATION_TICK_TIME (1.0 / 60.0)
+#define GC_APPLICATION_MAXIMUM_FRAME_TIME 0.25
+#define GC_APPLICATION_MAXIMUM_TICK_COUNT 16
 
 typedef struct GCApplication
 {
     GCWindow* Window;
     GCWorld* World;
 
+    double PreviousTime;
+    double TickAccumulator;
+    float TimeScale;
+
+    double StartTime;
+    double MaximumFrameTime;
+    uint64_t FrameCount;
+    uint64_t TickCount;
+
     bool IsRunning;
     bool IsMinimized;
 } GCApplication;
@@ -50,9 +70,19 @@ void GCApplication_Create(void)
     Application = (GCApplication*)GCMemory_Allocate(sizeof(GCApplication));
     Application->Window = NULL;
     Application->World = NULL;
+    Application->PreviousTime = 0.0;
+    Application->TickAccumulator = 0.0;
+    Application->TimeScale = 1.0f;
+    Application->StartTime = 0.0;
+    Application->MaximumFrameTime = 0.0;
+    Application->FrameCount = 0;
+    Application->TickCount = 0;
     Application->IsRunning = true;
     Application->IsMinimized = false;
 
+    const uint32_t HardwareThreadCount = GCThread_GetHardwareThreadCount();
+    GCJobSystem_Initialize(HardwareThreadCount > 1 ? HardwareThreadCount - 1 : 0);
+
     GCWindowProperties WindowProperties;
     WindowProperties.Title = "Great City";
     WindowProperties.Width = 1280;
@@ -70,19 +100,69 @@ void GCApplication_Create(void)
 
 void GCApplication_Run(void)
 {
+    Application->PreviousTime = GCClock_GetTime();
+    Application->StartTime = Application->PreviousTime;
+
     while (Application->IsRunning)
     {
-        GCWorld_OnUpdate(Application->World);
+        const double CurrentTime = GCClock_GetTime();
+        double FrameTime = CurrentTime - Application->PreviousTime;
+        Application->PreviousTime = CurrentTime;
+
+        if (FrameTime > Application->MaximumFrameTime)
+        {
+            Application->MaximumFrameTime = FrameTime;
+        }
+
+        if (FrameTime > GC_APPLICATION_MAXIMUM_FRAME_TIME)
+        {
+            FrameTime = GC_APPLICATION_MAXIMUM_FRAME_TIME;
+        }
+
+        Application->TickAccumulator += FrameTime * Application->TimeScale;
+
+        uint32_t TickCount = 0;
+
+        while (Application->TickAccumulator >= GC_APPLICATION_TICK_TIME &&
+               TickCount < GC_APPLICATION_MAXIMUM_TICK_COUNT)
+        {
+            GCWorld_OnTick(Application->World, (float)GC_APPLICATION_TICK_TIME);
+
+            Application->TickAccumulator -= GC_APPLICATION_TICK_TIME;
+            TickCount++;
+        }
+
+        Application->TickCount += TickCount;
+
+        if (Application->TickAccumulator >= GC_APPLICATION_TICK_TIME)
+        {
+            Application->TickAccumulator = 0.0;
+        }
+
+        GCWorld_OnUpdate(Application->World, (float)(Application->TickAccumulator / GC_APPLICATION_TICK_TIME));
 
         GCUI_Render();
         GCRenderer_Present();
         GCUI_OnUpdate();
 
         GCWindow_ProcessEvents(Application->Window);
+
+        Application->FrameCount++;
+    }
+
+    const double RunTime = Application->PreviousTime - Application->StartTime;
+
+    if (Application->FrameCount && RunTime > 0.0)
+    {
+        GC_LOG_INFORMATION("Ran %" PRIu64 " frames in %.3f s (average frame time %.3f ms, maximum %.3f ms)",
+                           Application->FrameCount, RunTime, RunTime * 1000.0 / (double)Application->FrameCount,
+                           Application->MaximumFrameTime * 1000.0);
+        GC_LOG_INFORMATION("Simulated %" PRIu64 " ticks (%.1f ticks per second)", Application->TickCount,
+                           (double)Application->TickCount / RunTime);
     }
 }
 
-GCWindow* const GCApplication_GetWindow(void)
+GCWindow* GCApplication_GetWindow(void)
 {
     return Application->Window;
 }
@@ -92,13 +172,25 @@ GCWorld* GCApplication_GetWorld(void)
     return Application->World;
 }
 
+void GCApplication_SetTimeScale(const float TimeScale)
+{
+    Application->TimeScale = TimeScale;
+}
+
+float GCApplication_GetTimeScale(void)
+{
+    return Application->TimeScale;
+}
+
 void GCApplication_Destroy(void)
 {
     GCWorld_Destroy(Application->World);
 
     GCUI_Terminate();
     GCRenderer_Terminate();
+    GCFrameAllocator_DestroyThreadAllocator();
     GCWindow_Destroy(Application->Window);
+    GCJobSystem_Terminate();
 
     GCMemory_Free(Application);
 }
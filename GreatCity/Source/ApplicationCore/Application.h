@@ -28,8 +28,10 @@ extern "C"
 
     void GCApplication_Create(void);
     void GCApplication_Run(void);
-    GCWindow* const GCApplication_GetWindow(void);
+    GCWindow* GCApplication_GetWindow(void);
     GCWorld* GCApplication_GetWorld(void);
+    void GCApplication_SetTimeScale(const float TimeScale);
+    float GCApplication_GetTimeScale(void);
     void GCApplication_Destroy(void);
 
 #ifdef __cplusplus
@@ -18,6 +18,8 @@
 #ifndef GC_APPLICATION_CORE_EVENT_APPLICATION_EVENT_H
 #define GC_APPLICATION_CORE_EVENT_APPLICATION_EVENT_H
 
+#include "ApplicationCore/Event/Event.h"
+
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -25,8 +27,6 @@ extern "C"
 {
 #endif
 
-    typedef enum GCEventType GCEventType;
-
     typedef struct GCWindowClosedEvent
     {
         GCEventType EventType;
@@ -18,14 +18,14 @@
 #ifndef GC_APPLICATION_CORE_EVENT_KEY_EVENT_H
 #define GC_APPLICATION_CORE_EVENT_KEY_EVENT_H
 
+#include "ApplicationCore/Event/Event.h"
+#include "ApplicationCore/GenericPlatform/KeyCode.h"
+
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
-    typedef enum GCEventType GCEventType;
-    typedef enum GCKeyCode GCKeyCode;
-
     typedef struct GCKeyEvent
     {
         GCEventType EventType;
@@ -18,14 +18,14 @@
 #ifndef GC_APPLICATION_CORE_EVENT_MOUSE_EVENT_H
 #define GC_APPLICATION_CORE_EVENT_MOUSE_EVENT_H
 
+#include "ApplicationCore/Event/Event.h"
+#include "ApplicationCore/GenericPlatform/MouseButtonCode.h"
+
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
-    typedef enum GCEventType GCEventType;
-    typedef enum GCMouseButtonCode GCMouseButtonCode;
-
     typedef struct GCMouseButtonEvent
     {
         GCEventType EventType;
@@ -25,7 +25,7 @@ extern "C"
 
     typedef enum GCKeyCode
     {
-#ifdef GC_PLATFORM_WINDOWS
+#if defined(GC_PLATFORM_WINDOWS) || defined(GC_PLATFORM_LINUX)
         GCKeyCode_Escape = 0x1B,
         GCKeyCode_Left = 0x25,
         GCKeyCode_Up = 0x26,
@@ -25,7 +25,7 @@ extern "C"
 
     typedef enum GCMouseButtonCode
     {
-#ifdef GC_PLATFORM_WINDOWS
+#if defined(GC_PLATFORM_WINDOWS) || defined(GC_PLATFORM_LINUX)
         GCMouseButtonCode_Left = 0x01,
         GCMouseButtonCode_Right = 0x02,
         GCMouseButtonCode_Middle = 0x04
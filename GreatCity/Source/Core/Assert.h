@@ -18,12 +18,16 @@
 #ifndef GC_CORE_ASSERT_H
 #define GC_CORE_ASSERT_H
 
+#ifdef GC_PLATFORM_WINDOWS
 #include <intrin.h>
+#endif
 
 #ifdef GC_ASSERT_ENABLED
 #ifndef GC_DEBUG_BREAK
 #ifdef GC_PLATFORM_WINDOWS
 #define GC_DEBUG_BREAK __debugbreak
+#elif defined(GC_PLATFORM_LINUX)
+#define GC_DEBUG_BREAK __builtin_trap
 #else
 #define GC_DEBUG_BREAK
 #endif
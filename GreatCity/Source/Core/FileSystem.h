@@ -19,6 +19,8 @@
 #define GC_CORE_FILE_SYSTEM_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #ifdef GC_PLATFORM_WINDOWS
 #include <Windows.h>
@@ -40,20 +42,31 @@ extern "C"
         WORD Minute;
         WORD Second;
         WORD Milliseconds;
+#elif defined(GC_PLATFORM_LINUX)
+        int64_t Seconds;
+        int64_t Nanoseconds;
 #endif
     } GCFileSystemFileTime;
 
     typedef struct GCFileSystemFileAttributes
     {
         GCFileSystemFileTime LastWriteTime;
+        uint64_t Size;
     } GCFileSystemFileAttributes;
 
+    typedef struct GCFileSystemMappedFile GCFileSystemMappedFile;
+
     bool GCFileSystem_Exists(const char* const Path);
     char* GCFileSystem_GetFileName(const char* const Path);
     void GCFileSystem_CreateDirectories(const char* const Path);
 
     GCFileSystemFileAttributes GCFileSystem_GetFileAttributes(const char* const Path);
 
+    GCFileSystemMappedFile* GCFileSystem_MapFile(const char* const Path);
+    void* GCFileSystemMappedFile_GetData(const GCFileSystemMappedFile* const MappedFile);
+    size_t GCFileSystemMappedFile_GetSize(const GCFileSystemMappedFile* const MappedFile);
+    void GCFileSystem_UnmapFile(GCFileSystemMappedFile* MappedFile);
+
     bool GCFileSystemFileTime_IsNewer(const GCFileSystemFileTime FileTime1, const GCFileSystemFileTime FileTime2);
     bool GCFileSystemFileTime_IsEqual(const GCFileSystemFileTime FileTime1, const GCFileSystemFileTime FileTime2);
     bool GCFileSystemFileTime_IsOlder(const GCFileSystemFileTime FileTime1, const GCFileSystemFileTime FileTime2);
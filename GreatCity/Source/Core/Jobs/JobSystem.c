@@ -0,0 +1,686 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Core/Jobs/JobSystem.h"
+#include "Core/Assert.h"
+#include "Core/Atomic.h"
+#include "Core/Log.h"
+#include "Core/Memory/Allocator.h"
+#include "Core/Thread.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define GC_JOB_SYSTEM_DEQUE_CAPACITY 4096
+#define GC_JOB_SYSTEM_CACHE_LINE_SIZE 64
+#define GC_JOB_SYSTEM_SPIN_COUNT 64
+
+typedef struct GCJob
+{
+    GCJobFunction Function;
+    GCJobParallelForFunction ParallelForFunction;
+    void* Data;
+    uint32_t Start, End, GrainSize;
+    GCJobCounter* Counter;
+    bool IsBackground;
+
+    struct GCJob* Next;
+} GCJob;
+
+typedef struct GCJobCounter
+{
+    volatile int64_t Value;
+    volatile int64_t CompletingCount;
+    volatile int64_t ContinuationLock;
+    GCJob* Continuations;
+} GCJobCounter;
+
+typedef struct GCJobDeque
+{
+    volatile int64_t Top;
+    uint8_t TopPadding[GC_JOB_SYSTEM_CACHE_LINE_SIZE - sizeof(int64_t)];
+    volatile int64_t Bottom;
+    uint8_t BottomPadding[GC_JOB_SYSTEM_CACHE_LINE_SIZE - sizeof(int64_t)];
+
+    void* volatile Jobs[GC_JOB_SYSTEM_DEQUE_CAPACITY];
+} GCJobDeque;
+
+typedef struct GCJobWorker
+{
+    GCJobDeque Deque;
+    GCJob* FreeJobs;
+    GCThread* Thread;
+    uint32_t RandomState;
+} GCJobWorker;
+
+typedef struct GCJobSystem
+{
+    GCJobWorker* Workers;
+    uint32_t ThreadCount;
+
+    GCThreadSemaphore* Semaphore;
+    volatile int64_t SleepingWorkerCount;
+    volatile int64_t PendingWakeCount;
+    volatile int64_t IsRunning;
+
+    GCJob* FirstBackgroundJob;
+    GCJob* LastBackgroundJob;
+    volatile int64_t BackgroundJobCount;
+    volatile int64_t BackgroundJobLock;
+} GCJobSystem;
+
+static GCJobSystem* JobSystem = NULL;
+static _Thread_local uint32_t ThreadIndex = UINT32_MAX;
+static _Thread_local bool IsRunningBackgroundJob = false;
+
+static void GCJobSystem_RunWorker(void* Data);
+static GCJob* GCJobSystem_AllocateJob(void);
+static void GCJobSystem_FreeJob(GCJob* const Job);
+static void GCJobSystem_PushJob(GCJob* const Job);
+static void GCJobSystem_PushBackgroundJob(GCJob* const Job);
+static GCJob* GCJobSystem_FindJob(const bool IsBackgroundAllowed);
+static GCJob* GCJobSystem_PopBackgroundJob(void);
+static void GCJobSystem_ExecuteJob(GCJob* const Job);
+static void GCJobSystem_CompleteJob(GCJobCounter* const Counter);
+static void GCJobCounter_LockContinuations(GCJobCounter* const Counter);
+static void GCJobCounter_UnlockContinuations(GCJobCounter* const Counter);
+static void GCJobSystem_LockBackgroundJobs(void);
+static void GCJobSystem_UnlockBackgroundJobs(void);
+static bool GCJobDeque_Push(GCJobDeque* const Deque, GCJob* const Job);
+static GCJob* GCJobDeque_Pop(GCJobDeque* const Deque);
+static GCJob* GCJobDeque_Steal(GCJobDeque* const Deque);
+
+void GCJobSystem_Initialize(const uint32_t WorkerThreadCount)
+{
+    JobSystem = (GCJobSystem*)GCMemory_Allocate(sizeof(GCJobSystem));
+    JobSystem->ThreadCount = WorkerThreadCount + 1;
+    JobSystem->Workers = (GCJobWorker*)GCMemory_AllocateZero(JobSystem->ThreadCount * sizeof(GCJobWorker));
+    JobSystem->Semaphore = GCThreadSemaphore_Create(0);
+    JobSystem->SleepingWorkerCount = 0;
+    JobSystem->PendingWakeCount = 0;
+    JobSystem->IsRunning = 1;
+    JobSystem->FirstBackgroundJob = NULL;
+    JobSystem->LastBackgroundJob = NULL;
+    JobSystem->BackgroundJobCount = 0;
+    JobSystem->BackgroundJobLock = 0;
+
+    for (uint32_t Counter = 0; Counter < JobSystem->ThreadCount; Counter++)
+    {
+        JobSystem->Workers[Counter].RandomState = 0x9E3779B9u * (Counter + 1);
+    }
+
+    ThreadIndex = 0;
+
+    for (uint32_t Counter = 1; Counter < JobSystem->ThreadCount; Counter++)
+    {
+        JobSystem->Workers[Counter].Thread = GCThread_Create(GCJobSystem_RunWorker, (void*)(uintptr_t)Counter);
+    }
+
+    GC_LOG_INFORMATION("Started the job system with %u worker threads", WorkerThreadCount);
+}
+
+void GCJobSystem_Run(const GCJobFunction Function, void* const Data, GCJobCounter* const Counter)
+{
+    GCJob* const Job = GCJobSystem_AllocateJob();
+    Job->Function = Function;
+    Job->Data = Data;
+    Job->Counter = Counter;
+
+    if (Counter)
+    {
+        GCAtomic_Add(&Counter->Value, 1);
+    }
+
+    GCJobSystem_PushJob(Job);
+}
+
+void GCJobSystem_RunBackground(const GCJobFunction Function, void* const Data, GCJobCounter* const Counter)
+{
+    GCJob* const Job = GCJobSystem_AllocateJob();
+    Job->Function = Function;
+    Job->Data = Data;
+    Job->Counter = Counter;
+    Job->IsBackground = true;
+
+    if (Counter)
+    {
+        GCAtomic_Add(&Counter->Value, 1);
+    }
+
+    GCJobSystem_PushJob(Job);
+}
+
+void GCJobSystem_RunAfter(GCJobCounter* const Dependency, const GCJobFunction Function, void* const Data,
+                          GCJobCounter* const Counter)
+{
+    GCJob* const Job = GCJobSystem_AllocateJob();
+    Job->Function = Function;
+    Job->Data = Data;
+    Job->Counter = Counter;
+
+    if (Counter)
+    {
+        GCAtomic_Add(&Counter->Value, 1);
+    }
+
+    GCJobCounter_LockContinuations(Dependency);
+
+    if (GCAtomic_Load(&Dependency->Value))
+    {
+        Job->Next = Dependency->Continuations;
+        Dependency->Continuations = Job;
+
+        GCJobCounter_UnlockContinuations(Dependency);
+
+        return;
+    }
+
+    GCJobCounter_UnlockContinuations(Dependency);
+
+    GCJobSystem_PushJob(Job);
+}
+
+void GCJobSystem_ParallelFor(const uint32_t Count, const uint32_t GrainSize,
+                             const GCJobParallelForFunction Function, void* const Data, GCJobCounter* const Counter)
+{
+    if (!Count)
+    {
+        return;
+    }
+
+    GCJob* const Job = GCJobSystem_AllocateJob();
+    Job->ParallelForFunction = Function;
+    Job->Data = Data;
+    Job->Start = 0;
+    Job->End = Count;
+    Job->GrainSize = GrainSize ? GrainSize : 1;
+    Job->Counter = Counter;
+
+    if (Counter)
+    {
+        GCAtomic_Add(&Counter->Value, 1);
+    }
+
+    GCJobSystem_PushJob(Job);
+}
+
+void GCJobSystem_Wait(const GCJobCounter* const Counter)
+{
+    while (!GCJobCounter_IsDone(Counter))
+    {
+        GCJob* const Job = GCJobSystem_FindJob(IsRunningBackgroundJob);
+
+        if (Job)
+        {
+            GCJobSystem_ExecuteJob(Job);
+        }
+        else
+        {
+            GCThread_Yield();
+        }
+    }
+}
+
+uint32_t GCJobSystem_GetThreadCount(void)
+{
+    return JobSystem->ThreadCount;
+}
+
+uint32_t GCJobSystem_GetThreadIndex(void)
+{
+    return ThreadIndex;
+}
+
+void GCJobSystem_Terminate(void)
+{
+    GCAtomic_Store(&JobSystem->IsRunning, 0);
+    GCAtomic_Add(&JobSystem->PendingWakeCount, JobSystem->ThreadCount - 1);
+    GCThreadSemaphore_Signal(JobSystem->Semaphore, JobSystem->ThreadCount - 1);
+
+    for (uint32_t Counter = 1; Counter < JobSystem->ThreadCount; Counter++)
+    {
+        GCThread_Join(JobSystem->Workers[Counter].Thread);
+    }
+
+    for (uint32_t Counter = 0; Counter < JobSystem->ThreadCount; Counter++)
+    {
+        GCJob* Job = JobSystem->Workers[Counter].FreeJobs;
+
+        while (Job)
+        {
+            GCJob* const NextJob = Job->Next;
+            GCMemory_Free(Job);
+
+            Job = NextJob;
+        }
+    }
+
+    GCThreadSemaphore_Destroy(JobSystem->Semaphore);
+
+    GCMemory_Free(JobSystem->Workers);
+    GCMemory_Free(JobSystem);
+
+    JobSystem = NULL;
+}
+
+GCJobCounter* GCJobCounter_Create(void)
+{
+    GCJobCounter* Counter = (GCJobCounter*)GCMemory_Allocate(sizeof(GCJobCounter));
+    Counter->Value = 0;
+    Counter->CompletingCount = 0;
+    Counter->ContinuationLock = 0;
+    Counter->Continuations = NULL;
+
+    return Counter;
+}
+
+bool GCJobCounter_IsDone(const GCJobCounter* const Counter)
+{
+    return !GCAtomic_Load(&Counter->Value) && !GCAtomic_Load(&Counter->CompletingCount);
+}
+
+void GCJobCounter_Destroy(GCJobCounter* Counter)
+{
+    GC_ASSERT(GCJobCounter_IsDone(Counter));
+
+    GCMemory_Free(Counter);
+}
+
+void GCJobSystem_RunWorker(void* Data)
+{
+    ThreadIndex = (uint32_t)(uintptr_t)Data;
+
+    uint32_t SpinCount = 0;
+
+    while (GCAtomic_Load(&JobSystem->IsRunning))
+    {
+        GCJob* Job = GCJobSystem_FindJob(true);
+
+        if (Job)
+        {
+            GCJobSystem_ExecuteJob(Job);
+            SpinCount = 0;
+
+            continue;
+        }
+
+        if (++SpinCount < GC_JOB_SYSTEM_SPIN_COUNT)
+        {
+            GCThread_Yield();
+
+            continue;
+        }
+
+        GCAtomic_Add(&JobSystem->SleepingWorkerCount, 1);
+
+        Job = GCJobSystem_FindJob(true);
+
+        if (!Job)
+        {
+            GCThreadSemaphore_Wait(JobSystem->Semaphore);
+            GCAtomic_Add(&JobSystem->PendingWakeCount, -1);
+        }
+
+        GCAtomic_Add(&JobSystem->SleepingWorkerCount, -1);
+
+        if (Job)
+        {
+            GCJobSystem_ExecuteJob(Job);
+        }
+
+        SpinCount = 0;
+    }
+}
+
+GCJob* GCJobSystem_AllocateJob(void)
+{
+    GC_ASSERT_WITH_MESSAGE(ThreadIndex < JobSystem->ThreadCount,
+                           "Jobs can only be scheduled from the main thread or a job system worker");
+
+    GCJobWorker* const Worker = &JobSystem->Workers[ThreadIndex];
+    GCJob* Job = Worker->FreeJobs;
+
+    if (Job)
+    {
+        Worker->FreeJobs = Job->Next;
+    }
+    else
+    {
+        Job = (GCJob*)GCMemory_Allocate(sizeof(GCJob));
+    }
+
+    Job->Function = NULL;
+    Job->ParallelForFunction = NULL;
+    Job->Data = NULL;
+    Job->Start = 0;
+    Job->End = 0;
+    Job->GrainSize = 0;
+    Job->Counter = NULL;
+    Job->IsBackground = IsRunningBackgroundJob;
+    Job->Next = NULL;
+
+    return Job;
+}
+
+void GCJobSystem_FreeJob(GCJob* const Job)
+{
+    GCJobWorker* const Worker = &JobSystem->Workers[ThreadIndex];
+
+    Job->Next = Worker->FreeJobs;
+    Worker->FreeJobs = Job;
+}
+
+void GCJobSystem_PushJob(GCJob* const Job)
+{
+    if (Job->IsBackground)
+    {
+        if (JobSystem->ThreadCount == 1)
+        {
+            GCJobSystem_ExecuteJob(Job);
+
+            return;
+        }
+
+        GCJobSystem_PushBackgroundJob(Job);
+    }
+    else if (!GCJobDeque_Push(&JobSystem->Workers[ThreadIndex].Deque, Job))
+    {
+        GCJobSystem_ExecuteJob(Job);
+
+        return;
+    }
+
+    GCAtomic_ThreadFence();
+
+    int64_t PendingWakeCount = GCAtomic_Load(&JobSystem->PendingWakeCount);
+
+    while (GCAtomic_Load(&JobSystem->SleepingWorkerCount) > PendingWakeCount)
+    {
+        if (GCAtomic_CompareExchange(&JobSystem->PendingWakeCount, PendingWakeCount, PendingWakeCount + 1))
+        {
+            GCThreadSemaphore_Signal(JobSystem->Semaphore, 1);
+
+            break;
+        }
+
+        PendingWakeCount = GCAtomic_Load(&JobSystem->PendingWakeCount);
+    }
+}
+
+void GCJobSystem_PushBackgroundJob(GCJob* const Job)
+{
+    GCJobSystem_LockBackgroundJobs();
+
+    if (JobSystem->LastBackgroundJob)
+    {
+        JobSystem->LastBackgroundJob->Next = Job;
+    }
+    else
+    {
+        JobSystem->FirstBackgroundJob = Job;
+    }
+
+    JobSystem->LastBackgroundJob = Job;
+    GCAtomic_Add(&JobSystem->BackgroundJobCount, 1);
+
+    GCJobSystem_UnlockBackgroundJobs();
+}
+
+GCJob* GCJobSystem_FindJob(const bool IsBackgroundAllowed)
+{
+    GCJobWorker* const Worker = &JobSystem->Workers[ThreadIndex];
+    GCJob* Job = GCJobDeque_Pop(&Worker->Deque);
+
+    if (Job)
+    {
+        return Job;
+    }
+
+    Worker->RandomState ^= Worker->RandomState << 13;
+    Worker->RandomState ^= Worker->RandomState >> 17;
+    Worker->RandomState ^= Worker->RandomState << 5;
+
+    const uint32_t FirstVictimIndex = Worker->RandomState % JobSystem->ThreadCount;
+
+    for (uint32_t Counter = 0; Counter < JobSystem->ThreadCount; Counter++)
+    {
+        const uint32_t VictimIndex = (FirstVictimIndex + Counter) % JobSystem->ThreadCount;
+
+        if (VictimIndex == ThreadIndex)
+        {
+            continue;
+        }
+
+        Job = GCJobDeque_Steal(&JobSystem->Workers[VictimIndex].Deque);
+
+        if (Job)
+        {
+            return Job;
+        }
+    }
+
+    if (IsBackgroundAllowed)
+    {
+        return GCJobSystem_PopBackgroundJob();
+    }
+
+    return NULL;
+}
+
+GCJob* GCJobSystem_PopBackgroundJob(void)
+{
+    if (!GCAtomic_Load(&JobSystem->BackgroundJobCount))
+    {
+        return NULL;
+    }
+
+    GCJobSystem_LockBackgroundJobs();
+
+    GCJob* const Job = JobSystem->FirstBackgroundJob;
+
+    if (Job)
+    {
+        JobSystem->FirstBackgroundJob = Job->Next;
+
+        if (!JobSystem->FirstBackgroundJob)
+        {
+            JobSystem->LastBackgroundJob = NULL;
+        }
+
+        Job->Next = NULL;
+        GCAtomic_Add(&JobSystem->BackgroundJobCount, -1);
+    }
+
+    GCJobSystem_UnlockBackgroundJobs();
+
+    return Job;
+}
+
+void GCJobSystem_ExecuteJob(GCJob* const Job)
+{
+    const bool WasRunningBackgroundJob = IsRunningBackgroundJob;
+    IsRunningBackgroundJob = Job->IsBackground;
+
+    if (Job->ParallelForFunction)
+    {
+        uint32_t End = Job->End;
+
+        while (End - Job->Start > Job->GrainSize)
+        {
+            const uint32_t Middle = Job->Start + (End - Job->Start) / 2;
+
+            GCJob* const SplitJob = GCJobSystem_AllocateJob();
+            SplitJob->ParallelForFunction = Job->ParallelForFunction;
+            SplitJob->Data = Job->Data;
+            SplitJob->Start = Middle;
+            SplitJob->End = End;
+            SplitJob->GrainSize = Job->GrainSize;
+            SplitJob->Counter = Job->Counter;
+
+            if (Job->Counter)
+            {
+                GCAtomic_Add(&Job->Counter->Value, 1);
+            }
+
+            GCJobSystem_PushJob(SplitJob);
+
+            End = Middle;
+        }
+
+        Job->ParallelForFunction(Job->Start, End, Job->Data);
+    }
+    else
+    {
+        Job->Function(Job->Data);
+    }
+
+    GCJobCounter* const Counter = Job->Counter;
+
+    GCJobSystem_FreeJob(Job);
+    GCJobSystem_CompleteJob(Counter);
+
+    IsRunningBackgroundJob = WasRunningBackgroundJob;
+}
+
+void GCJobSystem_CompleteJob(GCJobCounter* const Counter)
+{
+    if (!Counter)
+    {
+        return;
+    }
+
+    GCAtomic_Add(&Counter->CompletingCount, 1);
+
+    if (!GCAtomic_Add(&Counter->Value, -1))
+    {
+        GCJobCounter_LockContinuations(Counter);
+
+        GCJob* Continuation = Counter->Continuations;
+        Counter->Continuations = NULL;
+
+        GCJobCounter_UnlockContinuations(Counter);
+
+        while (Continuation)
+        {
+            GCJob* const NextContinuation = Continuation->Next;
+            Continuation->Next = NULL;
+
+            GCJobSystem_PushJob(Continuation);
+
+            Continuation = NextContinuation;
+        }
+    }
+
+    GCAtomic_Add(&Counter->CompletingCount, -1);
+}
+
+void GCJobCounter_LockContinuations(GCJobCounter* const Counter)
+{
+    while (!GCAtomic_CompareExchange(&Counter->ContinuationLock, 0, 1))
+    {
+        GCThread_Yield();
+    }
+}
+
+void GCJobCounter_UnlockContinuations(GCJobCounter* const Counter)
+{
+    GCAtomic_Store(&Counter->ContinuationLock, 0);
+}
+
+void GCJobSystem_LockBackgroundJobs(void)
+{
+    while (!GCAtomic_CompareExchange(&JobSystem->BackgroundJobLock, 0, 1))
+    {
+        GCThread_Yield();
+    }
+}
+
+void GCJobSystem_UnlockBackgroundJobs(void)
+{
+    GCAtomic_Store(&JobSystem->BackgroundJobLock, 0);
+}
+
+bool GCJobDeque_Push(GCJobDeque* const Deque, GCJob* const Job)
+{
+    const int64_t Bottom = GCAtomic_Load(&Deque->Bottom);
+    const int64_t Top = GCAtomic_Load(&Deque->Top);
+
+    if (Bottom - Top >= GC_JOB_SYSTEM_DEQUE_CAPACITY)
+    {
+        return false;
+    }
+
+    GCAtomic_StorePointer(&Deque->Jobs[Bottom & (GC_JOB_SYSTEM_DEQUE_CAPACITY - 1)], Job);
+    GCAtomic_Store(&Deque->Bottom, Bottom + 1);
+
+    return true;
+}
+
+GCJob* GCJobDeque_Pop(GCJobDeque* const Deque)
+{
+    const int64_t Bottom = GCAtomic_Load(&Deque->Bottom) - 1;
+    GCAtomic_Store(&Deque->Bottom, Bottom);
+
+    GCAtomic_ThreadFence();
+
+    const int64_t Top = GCAtomic_Load(&Deque->Top);
+
+    if (Top > Bottom)
+    {
+        GCAtomic_Store(&Deque->Bottom, Bottom + 1);
+
+        return NULL;
+    }
+
+    GCJob* Job = (GCJob*)GCAtomic_LoadPointer(&Deque->Jobs[Bottom & (GC_JOB_SYSTEM_DEQUE_CAPACITY - 1)]);
+
+    if (Top == Bottom)
+    {
+        if (!GCAtomic_CompareExchange(&Deque->Top, Top, Top + 1))
+        {
+            Job = NULL;
+        }
+
+        GCAtomic_Store(&Deque->Bottom, Bottom + 1);
+    }
+
+    return Job;
+}
+
+GCJob* GCJobDeque_Steal(GCJobDeque* const Deque)
+{
+    const int64_t Top = GCAtomic_Load(&Deque->Top);
+
+    GCAtomic_ThreadFence();
+
+    const int64_t Bottom = GCAtomic_Load(&Deque->Bottom);
+
+    if (Top >= Bottom)
+    {
+        return NULL;
+    }
+
+    GCJob* const Job = (GCJob*)GCAtomic_LoadPointer(&Deque->Jobs[Top & (GC_JOB_SYSTEM_DEQUE_CAPACITY - 1)]);
+
+    if (!GCAtomic_CompareExchange(&Deque->Top, Top, Top + 1))
+    {
+        return NULL;
+    }
+
+    return Job;
+}
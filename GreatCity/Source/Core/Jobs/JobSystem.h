@@ -0,0 +1,55 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GC_CORE_JOBS_JOB_SYSTEM_H
+#define GC_CORE_JOBS_JOB_SYSTEM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct GCJobCounter GCJobCounter;
+
+    typedef void (*GCJobFunction)(void*);
+    typedef void (*GCJobParallelForFunction)(const uint32_t, const uint32_t, void*);
+
+    void GCJobSystem_Initialize(const uint32_t WorkerThreadCount);
+    void GCJobSystem_Run(const GCJobFunction Function, void* const Data, GCJobCounter* const Counter);
+    void GCJobSystem_RunBackground(const GCJobFunction Function, void* const Data, GCJobCounter* const Counter);
+    void GCJobSystem_RunAfter(GCJobCounter* const Dependency, const GCJobFunction Function, void* const Data,
+                              GCJobCounter* const Counter);
+    void GCJobSystem_ParallelFor(const uint32_t Count, const uint32_t GrainSize,
+                                 const GCJobParallelForFunction Function, void* const Data,
+                                 GCJobCounter* const Counter);
+    void GCJobSystem_Wait(const GCJobCounter* const Counter);
+    uint32_t GCJobSystem_GetThreadCount(void);
+    uint32_t GCJobSystem_GetThreadIndex(void);
+    void GCJobSystem_Terminate(void);
+
+    GCJobCounter* GCJobCounter_Create(void);
+    bool GCJobCounter_IsDone(const GCJobCounter* const Counter);
+    void GCJobCounter_Destroy(GCJobCounter* Counter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
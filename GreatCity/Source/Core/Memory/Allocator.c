@@ -16,26 +16,40 @@
 */
 
 #include "Core/Memory/Allocator.h"
+#include "Core/Atomic.h"
 
 #include <stdint.h>
 #include <stdlib.h>
 
+static volatile int64_t AllocationCount = 0;
+
 void* GCMemory_Allocate(const size_t Size)
 {
+    GCAtomic_Add(&AllocationCount, 1);
+
     return malloc(Size);
 }
 
 void* GCMemory_AllocateZero(const size_t Size)
 {
+    GCAtomic_Add(&AllocationCount, 1);
+
     return calloc(1, Size);
 }
 
 void* GCMemory_Reallocate(void* Data, const size_t NewSize)
 {
+    GCAtomic_Add(&AllocationCount, 1);
+
     return realloc(Data, NewSize);
 }
 
 void GCMemory_Free(void* Data)
 {
     free(Data);
+}
+
+uint64_t GCMemory_GetAllocationCount(void)
+{
+    return (uint64_t)GCAtomic_Load(&AllocationCount);
 }
\ No newline at end of file
@@ -18,6 +18,7 @@
 #ifndef GC_CORE_MEMORY_ALLOCATOR_H
 #define GC_CORE_MEMORY_ALLOCATOR_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -30,6 +31,8 @@ extern "C"
     void* GCMemory_Reallocate(void* Data, const size_t NewSize);
     void GCMemory_Free(void* Data);
 
+    uint64_t GCMemory_GetAllocationCount(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,199 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Core/Memory/FrameAllocator.h"
+#include "Core/Memory/Allocator.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define GC_FRAME_ALLOCATOR_ALIGNMENT 16
+#define GC_FRAME_ALLOCATOR_THREAD_CAPACITY (1024 * 1024)
+
+typedef struct GCFrameAllocatorBlock
+{
+    struct GCFrameAllocatorBlock* Next;
+    uint8_t* Data;
+    size_t Capacity;
+    size_t UsedSize;
+} GCFrameAllocatorBlock;
+
+typedef struct GCFrameAllocator
+{
+    GCFrameAllocatorBlock* Blocks;
+    void* LastAllocation;
+    size_t Capacity;
+    size_t UsedSize;
+} GCFrameAllocator;
+
+static GCFrameAllocatorBlock* GCFrameAllocator_CreateBlock(const size_t Capacity);
+static size_t GCFrameAllocator_AlignSize(const size_t Size);
+
+static _Thread_local GCFrameAllocator* ThreadFrameAllocator = NULL;
+
+GCFrameAllocator* GCFrameAllocator_Create(const size_t Capacity)
+{
+    GCFrameAllocator* FrameAllocator = (GCFrameAllocator*)GCMemory_Allocate(sizeof(GCFrameAllocator));
+    FrameAllocator->Blocks = GCFrameAllocator_CreateBlock(GCFrameAllocator_AlignSize(Capacity));
+    FrameAllocator->LastAllocation = NULL;
+    FrameAllocator->Capacity = FrameAllocator->Blocks->Capacity;
+    FrameAllocator->UsedSize = 0;
+
+    return FrameAllocator;
+}
+
+void* GCFrameAllocator_Allocate(GCFrameAllocator* const FrameAllocator, const size_t Size)
+{
+    const size_t AlignedSize = GCFrameAllocator_AlignSize(Size);
+
+    if (FrameAllocator->Blocks->UsedSize + AlignedSize > FrameAllocator->Blocks->Capacity)
+    {
+        const size_t BlockCapacity =
+            AlignedSize > FrameAllocator->Blocks->Capacity * 2 ? AlignedSize : FrameAllocator->Blocks->Capacity * 2;
+
+        GCFrameAllocatorBlock* const Block = GCFrameAllocator_CreateBlock(BlockCapacity);
+        Block->Next = FrameAllocator->Blocks;
+
+        FrameAllocator->Blocks = Block;
+        FrameAllocator->Capacity += BlockCapacity;
+    }
+
+    void* const Data = FrameAllocator->Blocks->Data + FrameAllocator->Blocks->UsedSize;
+
+    FrameAllocator->Blocks->UsedSize += AlignedSize;
+    FrameAllocator->UsedSize += AlignedSize;
+    FrameAllocator->LastAllocation = Data;
+
+    return Data;
+}
+
+void* GCFrameAllocator_AllocateZero(GCFrameAllocator* const FrameAllocator, const size_t Size)
+{
+    void* const Data = GCFrameAllocator_Allocate(FrameAllocator, Size);
+    memset(Data, 0, Size);
+
+    return Data;
+}
+
+void* GCFrameAllocator_Reallocate(GCFrameAllocator* const FrameAllocator, void* Data, const size_t OldSize,
+                                  const size_t NewSize)
+{
+    if (Data && Data == FrameAllocator->LastAllocation)
+    {
+        const size_t OldAlignedSize = GCFrameAllocator_AlignSize(OldSize);
+        const size_t NewAlignedSize = GCFrameAllocator_AlignSize(NewSize);
+        const size_t BlockUsedSize = FrameAllocator->Blocks->UsedSize - OldAlignedSize;
+
+        if (BlockUsedSize + NewAlignedSize <= FrameAllocator->Blocks->Capacity)
+        {
+            FrameAllocator->Blocks->UsedSize = BlockUsedSize + NewAlignedSize;
+            FrameAllocator->UsedSize = FrameAllocator->UsedSize - OldAlignedSize + NewAlignedSize;
+
+            return Data;
+        }
+    }
+
+    void* const NewData = GCFrameAllocator_Allocate(FrameAllocator, NewSize);
+
+    if (Data)
+    {
+        memcpy(NewData, Data, OldSize < NewSize ? OldSize : NewSize);
+    }
+
+    return NewData;
+}
+
+void GCFrameAllocator_Reset(GCFrameAllocator* const FrameAllocator)
+{
+    if (FrameAllocator->Blocks->Next)
+    {
+        while (FrameAllocator->Blocks)
+        {
+            GCFrameAllocatorBlock* const NextBlock = FrameAllocator->Blocks->Next;
+
+            GCMemory_Free(FrameAllocator->Blocks);
+            FrameAllocator->Blocks = NextBlock;
+        }
+
+        FrameAllocator->Blocks = GCFrameAllocator_CreateBlock(FrameAllocator->Capacity);
+    }
+
+    FrameAllocator->Blocks->UsedSize = 0;
+    FrameAllocator->LastAllocation = NULL;
+    FrameAllocator->UsedSize = 0;
+}
+
+size_t GCFrameAllocator_GetUsedSize(const GCFrameAllocator* const FrameAllocator)
+{
+    return FrameAllocator->UsedSize;
+}
+
+size_t GCFrameAllocator_GetCapacity(const GCFrameAllocator* const FrameAllocator)
+{
+    return FrameAllocator->Capacity;
+}
+
+void GCFrameAllocator_Destroy(GCFrameAllocator* FrameAllocator)
+{
+    while (FrameAllocator->Blocks)
+    {
+        GCFrameAllocatorBlock* const NextBlock = FrameAllocator->Blocks->Next;
+
+        GCMemory_Free(FrameAllocator->Blocks);
+        FrameAllocator->Blocks = NextBlock;
+    }
+
+    GCMemory_Free(FrameAllocator);
+}
+
+GCFrameAllocator* GCFrameAllocator_GetThreadAllocator(void)
+{
+    if (!ThreadFrameAllocator)
+    {
+        ThreadFrameAllocator = GCFrameAllocator_Create(GC_FRAME_ALLOCATOR_THREAD_CAPACITY);
+    }
+
+    return ThreadFrameAllocator;
+}
+
+void GCFrameAllocator_DestroyThreadAllocator(void)
+{
+    if (ThreadFrameAllocator)
+    {
+        GCFrameAllocator_Destroy(ThreadFrameAllocator);
+        ThreadFrameAllocator = NULL;
+    }
+}
+
+GCFrameAllocatorBlock* GCFrameAllocator_CreateBlock(const size_t Capacity)
+{
+    const size_t HeaderSize = GCFrameAllocator_AlignSize(sizeof(GCFrameAllocatorBlock));
+
+    GCFrameAllocatorBlock* const Block = (GCFrameAllocatorBlock*)GCMemory_Allocate(HeaderSize + Capacity);
+    Block->Next = NULL;
+    Block->Data = (uint8_t*)Block + HeaderSize;
+    Block->Capacity = Capacity;
+    Block->UsedSize = 0;
+
+    return Block;
+}
+
+size_t GCFrameAllocator_AlignSize(const size_t Size)
+{
+    return (Size + GC_FRAME_ALLOCATOR_ALIGNMENT - 1) & ~((size_t)GC_FRAME_ALLOCATOR_ALIGNMENT - 1);
+}
@@ -0,0 +1,48 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GC_CORE_MEMORY_FRAME_ALLOCATOR_H
+#define GC_CORE_MEMORY_FRAME_ALLOCATOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct GCFrameAllocator GCFrameAllocator;
+
+    GCFrameAllocator* GCFrameAllocator_Create(const size_t Capacity);
+    void* GCFrameAllocator_Allocate(GCFrameAllocator* const FrameAllocator, const size_t Size);
+    void* GCFrameAllocator_AllocateZero(GCFrameAllocator* const FrameAllocator, const size_t Size);
+    void* GCFrameAllocator_Reallocate(GCFrameAllocator* const FrameAllocator, void* Data, const size_t OldSize,
+                                      const size_t NewSize);
+    void GCFrameAllocator_Reset(GCFrameAllocator* const FrameAllocator);
+    size_t GCFrameAllocator_GetUsedSize(const GCFrameAllocator* const FrameAllocator);
+    size_t GCFrameAllocator_GetCapacity(const GCFrameAllocator* const FrameAllocator);
+    void GCFrameAllocator_Destroy(GCFrameAllocator* FrameAllocator);
+
+    GCFrameAllocator* GCFrameAllocator_GetThreadAllocator(void);
+    void GCFrameAllocator_DestroyThreadAllocator(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,251 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Core/Memory/FreeListAllocator.h"
+#include "Core/Assert.h"
+#include "Core/Log.h"
+#include "Core/Memory/Allocator.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef struct GCFreeListAllocatorRange
+{
+    uint64_t Offset;
+    uint64_t Size;
+} GCFreeListAllocatorRange;
+
+typedef struct GCFreeListAllocator
+{
+    GCFreeListAllocatorRange* FreeRanges;
+    uint32_t FreeRangeCount;
+    uint32_t MaximumFreeRangeCount;
+
+    uint64_t Size;
+    uint64_t UsedSize;
+} GCFreeListAllocator;
+
+static void GCFreeListAllocator_InsertFreeRange(GCFreeListAllocator* const Allocator, const uint32_t Index,
+                                                const uint64_t Offset, const uint64_t Size);
+static void GCFreeListAllocator_RemoveFreeRange(GCFreeListAllocator* const Allocator, const uint32_t Index);
+static void GCFreeListAllocator_AddFreeRange(GCFreeListAllocator* const Allocator, const uint64_t Offset,
+                                             const uint64_t Size);
+
+GCFreeListAllocator* GCFreeListAllocator_Create(const uint64_t Size)
+{
+    GCFreeListAllocator* Allocator = (GCFreeListAllocator*)GCMemory_Allocate(sizeof(GCFreeListAllocator));
+    Allocator->FreeRanges = NULL;
+    Allocator->FreeRangeCount = 0;
+    Allocator->MaximumFreeRangeCount = 0;
+    Allocator->Size = Size;
+    Allocator->UsedSize = 0;
+
+    if (Size)
+    {
+        GCFreeListAllocator_InsertFreeRange(Allocator, 0, 0, Size);
+    }
+
+    return Allocator;
+}
+
+bool GCFreeListAllocator_Allocate(GCFreeListAllocator* const Allocator, const uint64_t Size, const uint64_t Alignment,
+                                  uint64_t* const Offset)
+{
+    GC_ASSERT_WITH_MESSAGE(Alignment && !(Alignment & (Alignment - 1)), "Alignment must be a power of two");
+
+    if (!Size)
+    {
+        return false;
+    }
+
+    for (uint32_t Counter = 0; Counter < Allocator->FreeRangeCount; Counter++)
+    {
+        GCFreeListAllocatorRange* const FreeRange = &Allocator->FreeRanges[Counter];
+
+        const uint64_t AlignedOffset = (FreeRange->Offset + Alignment - 1) & ~(Alignment - 1);
+        const uint64_t Padding = AlignedOffset - FreeRange->Offset;
+
+        if (FreeRange->Size < Padding + Size)
+        {
+            continue;
+        }
+
+        const uint64_t RemainingOffset = AlignedOffset + Size;
+        const uint64_t RemainingSize = FreeRange->Size - Padding - Size;
+
+        if (Padding)
+        {
+            FreeRange->Size = Padding;
+
+            if (RemainingSize)
+            {
+                GCFreeListAllocator_InsertFreeRange(Allocator, Counter + 1, RemainingOffset, RemainingSize);
+            }
+        }
+        else if (RemainingSize)
+        {
+            FreeRange->Offset = RemainingOffset;
+            FreeRange->Size = RemainingSize;
+        }
+        else
+        {
+            GCFreeListAllocator_RemoveFreeRange(Allocator, Counter);
+        }
+
+        Allocator->UsedSize += Size;
+        *Offset = AlignedOffset;
+
+        return true;
+    }
+
+    return false;
+}
+
+void GCFreeListAllocator_Free(GCFreeListAllocator* const Allocator, const uint64_t Offset, const uint64_t Size)
+{
+    if (!Size)
+    {
+        return;
+    }
+
+    GC_ASSERT_WITH_MESSAGE(Offset + Size <= Allocator->Size, "Freed range is outside of the allocator");
+
+    GCFreeListAllocator_AddFreeRange(Allocator, Offset, Size);
+
+    Allocator->UsedSize -= Size;
+}
+
+void GCFreeListAllocator_Grow(GCFreeListAllocator* const Allocator, const uint64_t NewSize)
+{
+    if (NewSize <= Allocator->Size)
+    {
+        return;
+    }
+
+    const uint64_t OldSize = Allocator->Size;
+    Allocator->Size = NewSize;
+
+    GCFreeListAllocator_AddFreeRange(Allocator, OldSize, NewSize - OldSize);
+}
+
+uint64_t GCFreeListAllocator_GetSize(const GCFreeListAllocator* const Allocator)
+{
+    return Allocator->Size;
+}
+
+uint64_t GCFreeListAllocator_GetUsedSize(const GCFreeListAllocator* const Allocator)
+{
+    return Allocator->UsedSize;
+}
+
+uint64_t GCFreeListAllocator_GetLargestFreeSize(const GCFreeListAllocator* const Allocator)
+{
+    uint64_t LargestFreeSize = 0;
+
+    for (uint32_t Counter = 0; Counter < Allocator->FreeRangeCount; Counter++)
+    {
+        if (Allocator->FreeRanges[Counter].Size > LargestFreeSize)
+        {
+            LargestFreeSize = Allocator->FreeRanges[Counter].Size;
+        }
+    }
+
+    return LargestFreeSize;
+}
+
+void GCFreeListAllocator_Destroy(GCFreeListAllocator* Allocator)
+{
+    GCMemory_Free(Allocator->FreeRanges);
+    GCMemory_Free(Allocator);
+}
+
+void GCFreeListAllocator_InsertFreeRange(GCFreeListAllocator* const Allocator, const uint32_t Index,
+                                         const uint64_t Offset, const uint64_t Size)
+{
+    if (Allocator->FreeRangeCount >= Allocator->MaximumFreeRangeCount)
+    {
+        Allocator->MaximumFreeRangeCount = Allocator->MaximumFreeRangeCount ? Allocator->MaximumFreeRangeCount * 2 : 16;
+        Allocator->FreeRanges = (GCFreeListAllocatorRange*)GCMemory_Reallocate(
+            Allocator->FreeRanges, Allocator->MaximumFreeRangeCount * sizeof(GCFreeListAllocatorRange));
+    }
+
+    memmove(&Allocator->FreeRanges[Index + 1], &Allocator->FreeRanges[Index],
+            (Allocator->FreeRangeCount - Index) * sizeof(GCFreeListAllocatorRange));
+
+    Allocator->FreeRanges[Index].Offset = Offset;
+    Allocator->FreeRanges[Index].Size = Size;
+    Allocator->FreeRangeCount++;
+}
+
+void GCFreeListAllocator_RemoveFreeRange(GCFreeListAllocator* const Allocator, const uint32_t Index)
+{
+    memmove(&Allocator->FreeRanges[Index], &Allocator->FreeRanges[Index + 1],
+            (Allocator->FreeRangeCount - Index - 1) * sizeof(GCFreeListAllocatorRange));
+
+    Allocator->FreeRangeCount--;
+}
+
+void GCFreeListAllocator_AddFreeRange(GCFreeListAllocator* const Allocator, const uint64_t Offset, const uint64_t Size)
+{
+    uint32_t Lower = 0, Upper = Allocator->FreeRangeCount;
+
+    while (Lower < Upper)
+    {
+        const uint32_t Middle = Lower + (Upper - Lower) / 2;
+
+        if (Allocator->FreeRanges[Middle].Offset < Offset)
+        {
+            Lower = Middle + 1;
+        }
+        else
+        {
+            Upper = Middle;
+        }
+    }
+
+    GCFreeListAllocatorRange* const PreviousRange = Lower > 0 ? &Allocator->FreeRanges[Lower - 1] : NULL;
+    GCFreeListAllocatorRange* const NextRange =
+        Lower < Allocator->FreeRangeCount ? &Allocator->FreeRanges[Lower] : NULL;
+
+    GC_ASSERT_WITH_MESSAGE(!PreviousRange || PreviousRange->Offset + PreviousRange->Size <= Offset,
+                           "Freed range overlaps a free range");
+    GC_ASSERT_WITH_MESSAGE(!NextRange || Offset + Size <= NextRange->Offset, "Freed range overlaps a free range");
+
+    const bool IsMergingPrevious = PreviousRange && PreviousRange->Offset + PreviousRange->Size == Offset;
+    const bool IsMergingNext = NextRange && Offset + Size == NextRange->Offset;
+
+    if (IsMergingPrevious && IsMergingNext)
+    {
+        PreviousRange->Size += Size + NextRange->Size;
+
+        GCFreeListAllocator_RemoveFreeRange(Allocator, Lower);
+    }
+    else if (IsMergingPrevious)
+    {
+        PreviousRange->Size += Size;
+    }
+    else if (IsMergingNext)
+    {
+        NextRange->Offset = Offset;
+        NextRange->Size += Size;
+    }
+    else
+    {
+        GCFreeListAllocator_InsertFreeRange(Allocator, Lower, Offset, Size);
+    }
+}
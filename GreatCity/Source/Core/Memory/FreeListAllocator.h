@@ -0,0 +1,45 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GC_CORE_MEMORY_FREE_LIST_ALLOCATOR_H
+#define GC_CORE_MEMORY_FREE_LIST_ALLOCATOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct GCFreeListAllocator GCFreeListAllocator;
+
+    GCFreeListAllocator* GCFreeListAllocator_Create(const uint64_t Size);
+    bool GCFreeListAllocator_Allocate(GCFreeListAllocator* const Allocator, const uint64_t Size,
+                                      const uint64_t Alignment, uint64_t* const Offset);
+    void GCFreeListAllocator_Free(GCFreeListAllocator* const Allocator, const uint64_t Offset, const uint64_t Size);
+    void GCFreeListAllocator_Grow(GCFreeListAllocator* const Allocator, const uint64_t NewSize);
+    uint64_t GCFreeListAllocator_GetSize(const GCFreeListAllocator* const Allocator);
+    uint64_t GCFreeListAllocator_GetUsedSize(const GCFreeListAllocator* const Allocator);
+    uint64_t GCFreeListAllocator_GetLargestFreeSize(const GCFreeListAllocator* const Allocator);
+    void GCFreeListAllocator_Destroy(GCFreeListAllocator* Allocator);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
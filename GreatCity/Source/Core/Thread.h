@@ -0,0 +1,47 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GC_CORE_THREAD_H
+#define GC_CORE_THREAD_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct GCThread GCThread;
+    typedef struct GCThreadSemaphore GCThreadSemaphore;
+
+    typedef void (*GCThreadFunction)(void*);
+
+    GCThread* GCThread_Create(const GCThreadFunction Function, void* const Data);
+    void GCThread_Join(GCThread* Thread);
+    void GCThread_Yield(void);
+    uint32_t GCThread_GetHardwareThreadCount(void);
+
+    GCThreadSemaphore* GCThreadSemaphore_Create(const uint32_t InitialCount);
+    void GCThreadSemaphore_Wait(GCThreadSemaphore* const Semaphore);
+    void GCThreadSemaphore_Signal(GCThreadSemaphore* const Semaphore, const uint32_t Count);
+    void GCThreadSemaphore_Destroy(GCThreadSemaphore* Semaphore);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -16,6 +16,7 @@
 */
 
 #include "ImGui/ImGuiManager.h"
+#include "Core/Memory/Allocator.h"
 
 // clang-format off
 #include <imgui.h>
@@ -24,11 +25,14 @@
 
 extern "C" void GCImGuiManager_RenderDrawData(void);
 
+static void* GCImGuiManager_Allocate(size_t Size, void* UserData);
+static void GCImGuiManager_Free(void* Data, void* UserData);
 static void GCImGuiManager_SetDarkTheme(void);
 
 extern "C" void GCImGuiManager_Initialize(void)
 {
     IMGUI_CHECKVERSION();
+    ImGui::SetAllocatorFunctions(GCImGuiManager_Allocate, GCImGuiManager_Free);
     ImGui::CreateContext();
 
     ImGuiIO& IO = ImGui::GetIO();
@@ -59,6 +63,20 @@ extern "C" void GCImGuiManager_Terminate(void)
     ImGui::DestroyContext();
 }
 
+void* GCImGuiManager_Allocate(size_t Size, void* UserData)
+{
+    (void)UserData;
+
+    return GCMemory_Allocate(Size);
+}
+
+void GCImGuiManager_Free(void* Data, void* UserData)
+{
+    (void)UserData;
+
+    GCMemory_Free(Data);
+}
+
 void GCImGuiManager_SetDarkTheme(void)
 {
     ImGuiStyle& Style = ImGui::GetStyle();
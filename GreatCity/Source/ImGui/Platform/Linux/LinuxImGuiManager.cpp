@@ -0,0 +1,80 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "ApplicationCore/Application.h"
+#include "ApplicationCore/GenericPlatform/MouseButtonCode.h"
+#include "ApplicationCore/GenericPlatform/Window.h"
+#include "Core/Clock.h"
+#include "Math/Vector2.h"
+
+#include <stdint.h>
+
+#include <imgui.h>
+
+typedef struct GCPlatformWindow GCLinuxWindow;
+
+extern "C" bool GCLinuxWindow_IsMouseButtonPressed(const GCLinuxWindow* const Window,
+                                                   const GCMouseButtonCode MouseButtonCode);
+extern "C" GCVector2 GCLinuxWindow_GetMousePosition(const GCLinuxWindow* const Window);
+extern "C" float GCLinuxWindow_ConsumeMouseScrollOffset(GCLinuxWindow* const Window);
+
+static double PreviousTime = 0.0;
+
+extern "C" void GCImGuiManager_InitializePlatform(void)
+{
+    ImGuiIO& IO = ImGui::GetIO();
+    IO.BackendPlatformName = "GreatCityLinuxHeadless";
+
+    PreviousTime = GCClock_GetTime();
+}
+
+extern "C" void GCImGuiManager_BeginFramePlatform(void)
+{
+    GCWindow* const Window = GCApplication_GetWindow();
+    ImGuiIO& IO = ImGui::GetIO();
+
+    uint32_t Width = 0, Height = 0;
+    GCWindow_GetWindowSize(Window, &Width, &Height);
+
+    IO.DisplaySize = ImVec2(static_cast<float>(Width), static_cast<float>(Height));
+
+    const double CurrentTime = GCClock_GetTime();
+    IO.DeltaTime = CurrentTime > PreviousTime ? static_cast<float>(CurrentTime - PreviousTime) : 1.0f / 60.0f;
+    PreviousTime = CurrentTime;
+
+    const GCVector2 MousePosition = GCLinuxWindow_GetMousePosition(Window);
+    IO.AddMousePosEvent(MousePosition.X, MousePosition.Y);
+
+    IO.AddMouseButtonEvent(ImGuiMouseButton_Left, GCLinuxWindow_IsMouseButtonPressed(Window, GCMouseButtonCode_Left));
+    IO.AddMouseButtonEvent(ImGuiMouseButton_Right,
+                           GCLinuxWindow_IsMouseButtonPressed(Window, GCMouseButtonCode_Right));
+    IO.AddMouseButtonEvent(ImGuiMouseButton_Middle,
+                           GCLinuxWindow_IsMouseButtonPressed(Window, GCMouseButtonCode_Middle));
+
+    const float MouseScrollOffset = GCLinuxWindow_ConsumeMouseScrollOffset(Window);
+
+    if (MouseScrollOffset != 0.0f)
+    {
+        IO.AddMouseWheelEvent(0.0f, MouseScrollOffset);
+    }
+}
+
+extern "C" void GCImGuiManager_TerminatePlatform(void)
+{
+    ImGuiIO& IO = ImGui::GetIO();
+    IO.BackendPlatformName = nullptr;
+}
@@ -150,7 +150,7 @@ void GCImGuiManager_UpdateDescriptorSet(void)
     const GCRendererFramebuffer* const RendererFramebuffer = GCRenderer_GetFramebuffer();
 
     const ImGui_ImplVulkan_InitInfo* const VulkanInformation =
-        static_cast<const ImGui_ImplVulkan_InitInfo* const>(ImGui::GetIO().BackendRendererUserData);
+        static_cast<const ImGui_ImplVulkan_InitInfo*>(ImGui::GetIO().BackendRendererUserData);
 
     VkDescriptorImageInfo DescriptorImageInformation{};
     DescriptorImageInformation.sampler =
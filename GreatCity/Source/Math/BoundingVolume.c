@@ -0,0 +1,159 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Math/BoundingVolume.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Vector3.h"
+#include "Math/Vector4.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+GCBoundingBox GCBoundingBox_Create(const GCVector3 Minimum, const GCVector3 Maximum)
+{
+    GCBoundingBox Result;
+    Result.Minimum = Minimum;
+    Result.Maximum = Maximum;
+
+    return Result;
+}
+
+GCBoundingBox GCBoundingBox_CreateFromPoints(const GCVector3* const Points, const uint32_t PointCount,
+                                             const uint32_t PointStride)
+{
+    if (!PointCount)
+    {
+        return GCBoundingBox_Create(GCVector3_CreateZero(), GCVector3_CreateZero());
+    }
+
+    GCBoundingBox Result = GCBoundingBox_Create(GCVector3_Create(FLT_MAX, FLT_MAX, FLT_MAX),
+                                                GCVector3_Create(-FLT_MAX, -FLT_MAX, -FLT_MAX));
+
+    for (uint32_t Counter = 0; Counter < PointCount; Counter++)
+    {
+        const GCVector3 Point = *(const GCVector3*)((const uint8_t*)Points + (size_t)Counter * PointStride);
+
+        Result.Minimum.X = fminf(Result.Minimum.X, Point.X);
+        Result.Minimum.Y = fminf(Result.Minimum.Y, Point.Y);
+        Result.Minimum.Z = fminf(Result.Minimum.Z, Point.Z);
+
+        Result.Maximum.X = fmaxf(Result.Maximum.X, Point.X);
+        Result.Maximum.Y = fmaxf(Result.Maximum.Y, Point.Y);
+        Result.Maximum.Z = fmaxf(Result.Maximum.Z, Point.Z);
+    }
+
+    return Result;
+}
+
+GCBoundingBox GCBoundingBox_Transform(const GCBoundingBox* const BoundingBox, const GCMatrix4x4* const Matrix)
+{
+    const float Minimum[3] = {BoundingBox->Minimum.X, BoundingBox->Minimum.Y, BoundingBox->Minimum.Z};
+    const float Maximum[3] = {BoundingBox->Maximum.X, BoundingBox->Maximum.Y, BoundingBox->Maximum.Z};
+
+    float ResultMinimum[3] = {Matrix->Data[3][0], Matrix->Data[3][1], Matrix->Data[3][2]};
+    float ResultMaximum[3] = {Matrix->Data[3][0], Matrix->Data[3][1], Matrix->Data[3][2]};
+
+    for (uint32_t Row = 0; Row < 3; Row++)
+    {
+        for (uint32_t Column = 0; Column < 3; Column++)
+        {
+            const float A = Matrix->Data[Column][Row] * Minimum[Column];
+            const float B = Matrix->Data[Column][Row] * Maximum[Column];
+
+            ResultMinimum[Row] += fminf(A, B);
+            ResultMaximum[Row] += fmaxf(A, B);
+        }
+    }
+
+    return GCBoundingBox_Create(GCVector3_Create(ResultMinimum[0], ResultMinimum[1], ResultMinimum[2]),
+                                GCVector3_Create(ResultMaximum[0], ResultMaximum[1], ResultMaximum[2]));
+}
+
+GCBoundingBox GCBoundingBox_Merge(const GCBoundingBox* const BoundingBox1, const GCBoundingBox* const BoundingBox2)
+{
+    return GCBoundingBox_Create(GCVector3_Create(fminf(BoundingBox1->Minimum.X, BoundingBox2->Minimum.X),
+                                                 fminf(BoundingBox1->Minimum.Y, BoundingBox2->Minimum.Y),
+                                                 fminf(BoundingBox1->Minimum.Z, BoundingBox2->Minimum.Z)),
+                                GCVector3_Create(fmaxf(BoundingBox1->Maximum.X, BoundingBox2->Maximum.X),
+                                                 fmaxf(BoundingBox1->Maximum.Y, BoundingBox2->Maximum.Y),
+                                                 fmaxf(BoundingBox1->Maximum.Z, BoundingBox2->Maximum.Z)));
+}
+
+GCVector3 GCBoundingBox_GetCenter(const GCBoundingBox* const BoundingBox)
+{
+    return GCVector3_MultiplyByScalar(GCVector3_Add(BoundingBox->Minimum, BoundingBox->Maximum), 0.5f);
+}
+
+float GCBoundingBox_GetSurfaceArea(const GCBoundingBox* const BoundingBox)
+{
+    const GCVector3 Extent = GCVector3_Subtract(BoundingBox->Maximum, BoundingBox->Minimum);
+
+    if (Extent.X < 0.0f || Extent.Y < 0.0f || Extent.Z < 0.0f)
+    {
+        return 0.0f;
+    }
+
+    return 2.0f * (Extent.X * Extent.Y + Extent.Y * Extent.Z + Extent.Z * Extent.X);
+}
+
+bool GCBoundingBox_Intersects(const GCBoundingBox* const BoundingBox1, const GCBoundingBox* const BoundingBox2)
+{
+    return BoundingBox1->Minimum.X < BoundingBox2->Maximum.X && BoundingBox1->Maximum.X > BoundingBox2->Minimum.X &&
+           BoundingBox1->Minimum.Y < BoundingBox2->Maximum.Y && BoundingBox1->Maximum.Y > BoundingBox2->Minimum.Y &&
+           BoundingBox1->Minimum.Z < BoundingBox2->Maximum.Z && BoundingBox1->Maximum.Z > BoundingBox2->Minimum.Z;
+}
+
+GCBoundingSphere GCBoundingSphere_CreateFromPoints(const GCBoundingBox* const BoundingBox,
+                                                   const GCVector3* const Points, const uint32_t PointCount,
+                                                   const uint32_t PointStride)
+{
+    GCBoundingSphere Result;
+    Result.Center = GCBoundingBox_GetCenter(BoundingBox);
+    Result.Radius = 0.0f;
+
+    for (uint32_t Counter = 0; Counter < PointCount; Counter++)
+    {
+        const GCVector3 Point = *(const GCVector3*)((const uint8_t*)Points + (size_t)Counter * PointStride);
+
+        Result.Radius = fmaxf(Result.Radius, GCVector3_Magnitude(GCVector3_Subtract(Point, Result.Center)));
+    }
+
+    return Result;
+}
+
+GCBoundingSphere GCBoundingSphere_Transform(const GCBoundingSphere* const BoundingSphere,
+                                            const GCMatrix4x4* const Matrix)
+{
+    const GCVector4 Center = GCMatrix4x4_MultiplyByVector(
+        Matrix, GCVector4_Create(BoundingSphere->Center.X, BoundingSphere->Center.Y, BoundingSphere->Center.Z, 1.0f));
+
+    const float ScaleX =
+        GCVector3_Magnitude(GCVector3_Create(Matrix->Data[0][0], Matrix->Data[0][1], Matrix->Data[0][2]));
+    const float ScaleY =
+        GCVector3_Magnitude(GCVector3_Create(Matrix->Data[1][0], Matrix->Data[1][1], Matrix->Data[1][2]));
+    const float ScaleZ =
+        GCVector3_Magnitude(GCVector3_Create(Matrix->Data[2][0], Matrix->Data[2][1], Matrix->Data[2][2]));
+
+    GCBoundingSphere Result;
+    Result.Center = GCVector3_Create(Center.X, Center.Y, Center.Z);
+    Result.Radius = BoundingSphere->Radius * fmaxf(ScaleX, fmaxf(ScaleY, ScaleZ));
+
+    return Result;
+}
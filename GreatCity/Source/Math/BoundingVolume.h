@@ -0,0 +1,64 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GC_MATH_BOUNDING_VOLUME_H
+#define GC_MATH_BOUNDING_VOLUME_H
+
+#include "Math/Vector3.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct GCMatrix4x4 GCMatrix4x4;
+
+    typedef struct GCBoundingBox
+    {
+        GCVector3 Minimum;
+        GCVector3 Maximum;
+    } GCBoundingBox;
+
+    typedef struct GCBoundingSphere
+    {
+        GCVector3 Center;
+        float Radius;
+    } GCBoundingSphere;
+
+    GCBoundingBox GCBoundingBox_Create(const GCVector3 Minimum, const GCVector3 Maximum);
+    GCBoundingBox GCBoundingBox_CreateFromPoints(const GCVector3* const Points, const uint32_t PointCount,
+                                                 const uint32_t PointStride);
+    GCBoundingBox GCBoundingBox_Transform(const GCBoundingBox* const BoundingBox, const GCMatrix4x4* const Matrix);
+    GCBoundingBox GCBoundingBox_Merge(const GCBoundingBox* const BoundingBox1, const GCBoundingBox* const BoundingBox2);
+    GCVector3 GCBoundingBox_GetCenter(const GCBoundingBox* const BoundingBox);
+    float GCBoundingBox_GetSurfaceArea(const GCBoundingBox* const BoundingBox);
+    bool GCBoundingBox_Intersects(const GCBoundingBox* const BoundingBox1, const GCBoundingBox* const BoundingBox2);
+
+    GCBoundingSphere GCBoundingSphere_CreateFromPoints(const GCBoundingBox* const BoundingBox,
+                                                       const GCVector3* const Points, const uint32_t PointCount,
+                                                       const uint32_t PointStride);
+    GCBoundingSphere GCBoundingSphere_Transform(const GCBoundingSphere* const BoundingSphere,
+                                                const GCMatrix4x4* const Matrix);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
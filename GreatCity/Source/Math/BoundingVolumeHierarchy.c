@@ -0,0 +1,546 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Math/BoundingVolumeHierarchy.h"
+#include "Core/Memory/Allocator.h"
+#include "Math/BoundingVolume.h"
+#include "Math/Ray.h"
+#include "Math/Vector3.h"
+
+#include <float.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define GC_BOUNDING_VOLUME_HIERARCHY_BIN_COUNT 16
+#define GC_BOUNDING_VOLUME_HIERARCHY_MAXIMUM_LEAF_SIZE 4
+#define GC_BOUNDING_VOLUME_HIERARCHY_MAXIMUM_DEPTH 64
+
+typedef struct GCBoundingVolumeHierarchyNode
+{
+    GCBoundingBox BoundingBox;
+    uint32_t FirstIndex;
+    uint32_t PrimitiveCount;
+} GCBoundingVolumeHierarchyNode;
+
+typedef struct GCBoundingVolumeHierarchyBuildTask
+{
+    uint32_t NodeIndex;
+    uint32_t Depth;
+} GCBoundingVolumeHierarchyBuildTask;
+
+typedef struct GCBoundingVolumeHierarchyTraversalEntry
+{
+    uint32_t NodeIndex;
+    float Distance;
+} GCBoundingVolumeHierarchyTraversalEntry;
+
+typedef struct GCBoundingVolumeHierarchy
+{
+    GCBoundingVolumeHierarchyNode* Nodes;
+    uint32_t* ParentNodeIndices;
+    uint32_t NodeCount;
+
+    uint32_t* PrimitiveIndices;
+    GCBoundingBox* PrimitiveBoundingBoxes;
+    uint32_t* PrimitiveSlots;
+    uint32_t* PrimitiveLeafNodeIndices;
+    uint32_t PrimitiveCount;
+} GCBoundingVolumeHierarchy;
+
+static GCBoundingBox GCBoundingVolumeHierarchy_CreateEmptyBoundingBox(void);
+static float GCBoundingVolumeHierarchy_GetAxis(const GCVector3 Vector, const uint32_t Axis);
+static bool GCBoundingVolumeHierarchy_SplitNode(GCBoundingVolumeHierarchy* const BoundingVolumeHierarchy,
+                                                const GCBoundingBox* const PrimitiveBoundingBoxes,
+                                                const GCVector3* const PrimitiveCenters,
+                                                const GCBoundingVolumeHierarchyNode* const Node,
+                                                uint32_t* const LeftPrimitiveCount);
+static bool GCBoundingVolumeHierarchy_Overlaps(const GCBoundingBox* const BoundingBox1,
+                                               const GCBoundingBox* const BoundingBox2);
+static bool GCBoundingVolumeHierarchy_IsEqual(const GCBoundingBox* const BoundingBox1,
+                                              const GCBoundingBox* const BoundingBox2);
+
+GCBoundingVolumeHierarchy* GCBoundingVolumeHierarchy_Create(const GCBoundingBox* const PrimitiveBoundingBoxes,
+                                                            const uint32_t PrimitiveCount)
+{
+    GCBoundingVolumeHierarchy* BoundingVolumeHierarchy =
+        (GCBoundingVolumeHierarchy*)GCMemory_Allocate(sizeof(GCBoundingVolumeHierarchy));
+    BoundingVolumeHierarchy->Nodes = NULL;
+    BoundingVolumeHierarchy->ParentNodeIndices = NULL;
+    BoundingVolumeHierarchy->NodeCount = 0;
+    BoundingVolumeHierarchy->PrimitiveIndices = NULL;
+    BoundingVolumeHierarchy->PrimitiveBoundingBoxes = NULL;
+    BoundingVolumeHierarchy->PrimitiveSlots = NULL;
+    BoundingVolumeHierarchy->PrimitiveLeafNodeIndices = NULL;
+    BoundingVolumeHierarchy->PrimitiveCount = PrimitiveCount;
+
+    if (!PrimitiveCount)
+    {
+        return BoundingVolumeHierarchy;
+    }
+
+    BoundingVolumeHierarchy->Nodes = (GCBoundingVolumeHierarchyNode*)GCMemory_Allocate(
+        (2 * (size_t)PrimitiveCount - 1) * sizeof(GCBoundingVolumeHierarchyNode));
+    BoundingVolumeHierarchy->ParentNodeIndices =
+        (uint32_t*)GCMemory_Allocate((2 * (size_t)PrimitiveCount - 1) * sizeof(uint32_t));
+    BoundingVolumeHierarchy->PrimitiveIndices = (uint32_t*)GCMemory_Allocate(PrimitiveCount * sizeof(uint32_t));
+
+    GCVector3* const PrimitiveCenters = (GCVector3*)GCMemory_Allocate(PrimitiveCount * sizeof(GCVector3));
+
+    for (uint32_t Counter = 0; Counter < PrimitiveCount; Counter++)
+    {
+        BoundingVolumeHierarchy->PrimitiveIndices[Counter] = Counter;
+        PrimitiveCenters[Counter] = GCBoundingBox_GetCenter(&PrimitiveBoundingBoxes[Counter]);
+    }
+
+    GCBoundingVolumeHierarchyBuildTask* const BuildTasks = (GCBoundingVolumeHierarchyBuildTask*)GCMemory_Allocate(
+        PrimitiveCount * sizeof(GCBoundingVolumeHierarchyBuildTask));
+    uint32_t BuildTaskCount = 0;
+
+    BoundingVolumeHierarchy->Nodes[0].FirstIndex = 0;
+    BoundingVolumeHierarchy->Nodes[0].PrimitiveCount = PrimitiveCount;
+    BoundingVolumeHierarchy->ParentNodeIndices[0] = UINT32_MAX;
+    BoundingVolumeHierarchy->NodeCount = 1;
+
+    BuildTasks[BuildTaskCount++] = (GCBoundingVolumeHierarchyBuildTask){0, 0};
+
+    while (BuildTaskCount)
+    {
+        const GCBoundingVolumeHierarchyBuildTask BuildTask = BuildTasks[--BuildTaskCount];
+        GCBoundingVolumeHierarchyNode* const Node = &BoundingVolumeHierarchy->Nodes[BuildTask.NodeIndex];
+
+        Node->BoundingBox = GCBoundingVolumeHierarchy_CreateEmptyBoundingBox();
+
+        for (uint32_t Counter = 0; Counter < Node->PrimitiveCount; Counter++)
+        {
+            const uint32_t PrimitiveIndex = BoundingVolumeHierarchy->PrimitiveIndices[Node->FirstIndex + Counter];
+
+            Node->BoundingBox = GCBoundingBox_Merge(&Node->BoundingBox, &PrimitiveBoundingBoxes[PrimitiveIndex]);
+        }
+
+        uint32_t LeftPrimitiveCount = 0;
+
+        if (Node->PrimitiveCount <= GC_BOUNDING_VOLUME_HIERARCHY_MAXIMUM_LEAF_SIZE ||
+            BuildTask.Depth + 1 >= GC_BOUNDING_VOLUME_HIERARCHY_MAXIMUM_DEPTH ||
+            !GCBoundingVolumeHierarchy_SplitNode(BoundingVolumeHierarchy, PrimitiveBoundingBoxes, PrimitiveCenters,
+                                                 Node, &LeftPrimitiveCount))
+        {
+            continue;
+        }
+
+        const uint32_t LeftNodeIndex = BoundingVolumeHierarchy->NodeCount;
+        BoundingVolumeHierarchy->NodeCount += 2;
+
+        GCBoundingVolumeHierarchyNode* const LeftNode = &BoundingVolumeHierarchy->Nodes[LeftNodeIndex];
+        LeftNode->FirstIndex = Node->FirstIndex;
+        LeftNode->PrimitiveCount = LeftPrimitiveCount;
+
+        GCBoundingVolumeHierarchyNode* const RightNode = &BoundingVolumeHierarchy->Nodes[LeftNodeIndex + 1];
+        RightNode->FirstIndex = Node->FirstIndex + LeftPrimitiveCount;
+        RightNode->PrimitiveCount = Node->PrimitiveCount - LeftPrimitiveCount;
+
+        Node->FirstIndex = LeftNodeIndex;
+        Node->PrimitiveCount = 0;
+
+        BoundingVolumeHierarchy->ParentNodeIndices[LeftNodeIndex] = BuildTask.NodeIndex;
+        BoundingVolumeHierarchy->ParentNodeIndices[LeftNodeIndex + 1] = BuildTask.NodeIndex;
+
+        BuildTasks[BuildTaskCount++] = (GCBoundingVolumeHierarchyBuildTask){LeftNodeIndex, BuildTask.Depth + 1};
+        BuildTasks[BuildTaskCount++] = (GCBoundingVolumeHierarchyBuildTask){LeftNodeIndex + 1, BuildTask.Depth + 1};
+    }
+
+    BoundingVolumeHierarchy->PrimitiveBoundingBoxes =
+        (GCBoundingBox*)GCMemory_Allocate(PrimitiveCount * sizeof(GCBoundingBox));
+    BoundingVolumeHierarchy->PrimitiveSlots = (uint32_t*)GCMemory_Allocate(PrimitiveCount * sizeof(uint32_t));
+    BoundingVolumeHierarchy->PrimitiveLeafNodeIndices =
+        (uint32_t*)GCMemory_Allocate(PrimitiveCount * sizeof(uint32_t));
+
+    for (uint32_t Counter = 0; Counter < PrimitiveCount; Counter++)
+    {
+        BoundingVolumeHierarchy->PrimitiveBoundingBoxes[Counter] =
+            PrimitiveBoundingBoxes[BoundingVolumeHierarchy->PrimitiveIndices[Counter]];
+        BoundingVolumeHierarchy->PrimitiveSlots[BoundingVolumeHierarchy->PrimitiveIndices[Counter]] = Counter;
+    }
+
+    for (uint32_t NodeIndex = 0; NodeIndex < BoundingVolumeHierarchy->NodeCount; NodeIndex++)
+    {
+        const GCBoundingVolumeHierarchyNode* const Node = &BoundingVolumeHierarchy->Nodes[NodeIndex];
+
+        for (uint32_t Counter = 0; Counter < Node->PrimitiveCount; Counter++)
+        {
+            BoundingVolumeHierarchy
+                ->PrimitiveLeafNodeIndices[BoundingVolumeHierarchy->PrimitiveIndices[Node->FirstIndex + Counter]] =
+                NodeIndex;
+        }
+    }
+
+    GCMemory_Free(BuildTasks);
+    GCMemory_Free(PrimitiveCenters);
+
+    return BoundingVolumeHierarchy;
+}
+
+void GCBoundingVolumeHierarchy_Refit(GCBoundingVolumeHierarchy* const BoundingVolumeHierarchy,
+                                     const uint32_t* const PrimitiveIndices,
+                                     const GCBoundingBox* const PrimitiveBoundingBoxes,
+                                     const uint32_t PrimitiveIndexCount)
+{
+    for (uint32_t Counter = 0; Counter < PrimitiveIndexCount; Counter++)
+    {
+        const uint32_t PrimitiveIndex = PrimitiveIndices[Counter];
+
+        BoundingVolumeHierarchy->PrimitiveBoundingBoxes[BoundingVolumeHierarchy->PrimitiveSlots[PrimitiveIndex]] =
+            PrimitiveBoundingBoxes[PrimitiveIndex];
+    }
+
+    for (uint32_t Counter = 0; Counter < PrimitiveIndexCount; Counter++)
+    {
+        uint32_t NodeIndex = BoundingVolumeHierarchy->PrimitiveLeafNodeIndices[PrimitiveIndices[Counter]];
+
+        while (NodeIndex != UINT32_MAX)
+        {
+            GCBoundingVolumeHierarchyNode* const Node = &BoundingVolumeHierarchy->Nodes[NodeIndex];
+            GCBoundingBox BoundingBox = GCBoundingVolumeHierarchy_CreateEmptyBoundingBox();
+
+            if (Node->PrimitiveCount)
+            {
+                for (uint32_t Slot = Node->FirstIndex; Slot < Node->FirstIndex + Node->PrimitiveCount; Slot++)
+                {
+                    BoundingBox =
+                        GCBoundingBox_Merge(&BoundingBox, &BoundingVolumeHierarchy->PrimitiveBoundingBoxes[Slot]);
+                }
+            }
+            else
+            {
+                BoundingBox = GCBoundingBox_Merge(&BoundingVolumeHierarchy->Nodes[Node->FirstIndex].BoundingBox,
+                                                  &BoundingVolumeHierarchy->Nodes[Node->FirstIndex + 1].BoundingBox);
+            }
+
+            if (GCBoundingVolumeHierarchy_IsEqual(&Node->BoundingBox, &BoundingBox))
+            {
+                break;
+            }
+
+            Node->BoundingBox = BoundingBox;
+            NodeIndex = BoundingVolumeHierarchy->ParentNodeIndices[NodeIndex];
+        }
+    }
+}
+
+bool GCBoundingVolumeHierarchy_CastRay(const GCBoundingVolumeHierarchy* const BoundingVolumeHierarchy,
+                                       const GCRay* const Ray, const float MaximumDistance,
+                                       const GCBoundingVolumeHierarchyRayCastCallbackFunction CallbackFunction,
+                                       void* const Context, uint32_t* const PrimitiveIndex, float* const Distance)
+{
+    float ClosestDistance = MaximumDistance;
+    bool IsHit = false;
+
+    float RootDistance = 0.0f;
+
+    if (!BoundingVolumeHierarchy->NodeCount ||
+        !GCRay_IntersectsBoundingBox(Ray, &BoundingVolumeHierarchy->Nodes[0].BoundingBox, ClosestDistance,
+                                     &RootDistance))
+    {
+        return false;
+    }
+
+    GCBoundingVolumeHierarchyTraversalEntry TraversalEntries[GC_BOUNDING_VOLUME_HIERARCHY_MAXIMUM_DEPTH];
+    uint32_t TraversalEntryCount = 0;
+
+    TraversalEntries[TraversalEntryCount++] = (GCBoundingVolumeHierarchyTraversalEntry){0, RootDistance};
+
+    while (TraversalEntryCount)
+    {
+        const GCBoundingVolumeHierarchyTraversalEntry TraversalEntry = TraversalEntries[--TraversalEntryCount];
+
+        if (TraversalEntry.Distance > ClosestDistance)
+        {
+            continue;
+        }
+
+        const GCBoundingVolumeHierarchyNode* const Node = &BoundingVolumeHierarchy->Nodes[TraversalEntry.NodeIndex];
+
+        if (Node->PrimitiveCount)
+        {
+            for (uint32_t Counter = 0; Counter < Node->PrimitiveCount; Counter++)
+            {
+                const uint32_t CandidateIndex = BoundingVolumeHierarchy->PrimitiveIndices[Node->FirstIndex + Counter];
+                float CandidateDistance = 0.0f;
+
+                if (CallbackFunction(Context, CandidateIndex, Ray, ClosestDistance, &CandidateDistance) &&
+                    CandidateDistance <= ClosestDistance)
+                {
+                    ClosestDistance = CandidateDistance;
+                    *PrimitiveIndex = CandidateIndex;
+                    IsHit = true;
+                }
+            }
+
+            continue;
+        }
+
+        float LeftDistance = 0.0f, RightDistance = 0.0f;
+        const bool IsLeftHit = GCRay_IntersectsBoundingBox(
+            Ray, &BoundingVolumeHierarchy->Nodes[Node->FirstIndex].BoundingBox, ClosestDistance, &LeftDistance);
+        const bool IsRightHit = GCRay_IntersectsBoundingBox(
+            Ray, &BoundingVolumeHierarchy->Nodes[Node->FirstIndex + 1].BoundingBox, ClosestDistance, &RightDistance);
+
+        if (IsLeftHit && IsRightHit)
+        {
+            const bool IsLeftNearer = LeftDistance <= RightDistance;
+
+            TraversalEntries[TraversalEntryCount++] = (GCBoundingVolumeHierarchyTraversalEntry){
+                IsLeftNearer ? Node->FirstIndex + 1 : Node->FirstIndex, IsLeftNearer ? RightDistance : LeftDistance};
+            TraversalEntries[TraversalEntryCount++] = (GCBoundingVolumeHierarchyTraversalEntry){
+                IsLeftNearer ? Node->FirstIndex : Node->FirstIndex + 1, IsLeftNearer ? LeftDistance : RightDistance};
+        }
+        else if (IsLeftHit)
+        {
+            TraversalEntries[TraversalEntryCount++] =
+                (GCBoundingVolumeHierarchyTraversalEntry){Node->FirstIndex, LeftDistance};
+        }
+        else if (IsRightHit)
+        {
+            TraversalEntries[TraversalEntryCount++] =
+                (GCBoundingVolumeHierarchyTraversalEntry){Node->FirstIndex + 1, RightDistance};
+        }
+    }
+
+    if (IsHit)
+    {
+        *Distance = ClosestDistance;
+    }
+
+    return IsHit;
+}
+
+uint32_t GCBoundingVolumeHierarchy_Query(const GCBoundingVolumeHierarchy* const BoundingVolumeHierarchy,
+                                         const GCBoundingBox* const BoundingBox, uint32_t* const PrimitiveIndices,
+                                         const uint32_t MaximumPrimitiveIndexCount)
+{
+    if (!BoundingVolumeHierarchy->NodeCount)
+    {
+        return 0;
+    }
+
+    uint32_t NodeIndices[GC_BOUNDING_VOLUME_HIERARCHY_MAXIMUM_DEPTH];
+    uint32_t NodeIndexCount = 0;
+    uint32_t PrimitiveIndexCount = 0;
+
+    NodeIndices[NodeIndexCount++] = 0;
+
+    while (NodeIndexCount && PrimitiveIndexCount < MaximumPrimitiveIndexCount)
+    {
+        const GCBoundingVolumeHierarchyNode* const Node =
+            &BoundingVolumeHierarchy->Nodes[NodeIndices[--NodeIndexCount]];
+
+        if (!GCBoundingVolumeHierarchy_Overlaps(&Node->BoundingBox, BoundingBox))
+        {
+            continue;
+        }
+
+        if (!Node->PrimitiveCount)
+        {
+            NodeIndices[NodeIndexCount++] = Node->FirstIndex + 1;
+            NodeIndices[NodeIndexCount++] = Node->FirstIndex;
+
+            continue;
+        }
+
+        for (uint32_t Counter = Node->FirstIndex;
+             Counter < Node->FirstIndex + Node->PrimitiveCount && PrimitiveIndexCount < MaximumPrimitiveIndexCount;
+             Counter++)
+        {
+            if (GCBoundingVolumeHierarchy_Overlaps(&BoundingVolumeHierarchy->PrimitiveBoundingBoxes[Counter],
+                                                   BoundingBox))
+            {
+                PrimitiveIndices[PrimitiveIndexCount++] = BoundingVolumeHierarchy->PrimitiveIndices[Counter];
+            }
+        }
+    }
+
+    return PrimitiveIndexCount;
+}
+
+GCBoundingBox GCBoundingVolumeHierarchy_GetBoundingBox(const GCBoundingVolumeHierarchy* const BoundingVolumeHierarchy)
+{
+    if (!BoundingVolumeHierarchy->NodeCount)
+    {
+        return GCBoundingBox_Create(GCVector3_CreateZero(), GCVector3_CreateZero());
+    }
+
+    return BoundingVolumeHierarchy->Nodes[0].BoundingBox;
+}
+
+void GCBoundingVolumeHierarchy_Destroy(GCBoundingVolumeHierarchy* BoundingVolumeHierarchy)
+{
+    GCMemory_Free(BoundingVolumeHierarchy->PrimitiveLeafNodeIndices);
+    GCMemory_Free(BoundingVolumeHierarchy->PrimitiveSlots);
+    GCMemory_Free(BoundingVolumeHierarchy->PrimitiveBoundingBoxes);
+    GCMemory_Free(BoundingVolumeHierarchy->PrimitiveIndices);
+    GCMemory_Free(BoundingVolumeHierarchy->ParentNodeIndices);
+    GCMemory_Free(BoundingVolumeHierarchy->Nodes);
+    GCMemory_Free(BoundingVolumeHierarchy);
+}
+
+GCBoundingBox GCBoundingVolumeHierarchy_CreateEmptyBoundingBox(void)
+{
+    return GCBoundingBox_Create(GCVector3_Create(FLT_MAX, FLT_MAX, FLT_MAX),
+                                GCVector3_Create(-FLT_MAX, -FLT_MAX, -FLT_MAX));
+}
+
+float GCBoundingVolumeHierarchy_GetAxis(const GCVector3 Vector, const uint32_t Axis)
+{
+    return Axis == 0 ? Vector.X : (Axis == 1 ? Vector.Y : Vector.Z);
+}
+
+bool GCBoundingVolumeHierarchy_SplitNode(GCBoundingVolumeHierarchy* const BoundingVolumeHierarchy,
+                                         const GCBoundingBox* const PrimitiveBoundingBoxes,
+                                         const GCVector3* const PrimitiveCenters,
+                                         const GCBoundingVolumeHierarchyNode* const Node,
+                                         uint32_t* const LeftPrimitiveCount)
+{
+    uint32_t* const PrimitiveIndices = BoundingVolumeHierarchy->PrimitiveIndices + Node->FirstIndex;
+
+    GCBoundingBox CenterBoundingBox = GCBoundingVolumeHierarchy_CreateEmptyBoundingBox();
+
+    for (uint32_t Counter = 0; Counter < Node->PrimitiveCount; Counter++)
+    {
+        const GCVector3 Center = PrimitiveCenters[PrimitiveIndices[Counter]];
+        const GCBoundingBox CenterPoint = GCBoundingBox_Create(Center, Center);
+
+        CenterBoundingBox = GCBoundingBox_Merge(&CenterBoundingBox, &CenterPoint);
+    }
+
+    const GCVector3 CenterExtent = GCVector3_Subtract(CenterBoundingBox.Maximum, CenterBoundingBox.Minimum);
+    const uint32_t Axis = CenterExtent.X > CenterExtent.Y ? (CenterExtent.X > CenterExtent.Z ? 0 : 2)
+                                                          : (CenterExtent.Y > CenterExtent.Z ? 1 : 2);
+    const float AxisMinimum = GCBoundingVolumeHierarchy_GetAxis(CenterBoundingBox.Minimum, Axis);
+    const float AxisExtent = GCBoundingVolumeHierarchy_GetAxis(CenterExtent, Axis);
+
+    if (AxisExtent <= 0.0f)
+    {
+        return false;
+    }
+
+    GCBoundingBox BinBoundingBoxes[GC_BOUNDING_VOLUME_HIERARCHY_BIN_COUNT];
+    uint32_t BinPrimitiveCounts[GC_BOUNDING_VOLUME_HIERARCHY_BIN_COUNT] = {0};
+
+    for (uint32_t Counter = 0; Counter < GC_BOUNDING_VOLUME_HIERARCHY_BIN_COUNT; Counter++)
+    {
+        BinBoundingBoxes[Counter] = GCBoundingVolumeHierarchy_CreateEmptyBoundingBox();
+    }
+
+    const float BinScale = (float)GC_BOUNDING_VOLUME_HIERARCHY_BIN_COUNT / AxisExtent;
+
+    for (uint32_t Counter = 0; Counter < Node->PrimitiveCount; Counter++)
+    {
+        const uint32_t PrimitiveIndex = PrimitiveIndices[Counter];
+        uint32_t BinIndex = (uint32_t)(
+            (GCBoundingVolumeHierarchy_GetAxis(PrimitiveCenters[PrimitiveIndex], Axis) - AxisMinimum) * BinScale);
+        BinIndex = BinIndex < GC_BOUNDING_VOLUME_HIERARCHY_BIN_COUNT ? BinIndex
+                                                                    : GC_BOUNDING_VOLUME_HIERARCHY_BIN_COUNT - 1;
+
+        BinBoundingBoxes[BinIndex] =
+            GCBoundingBox_Merge(&BinBoundingBoxes[BinIndex], &PrimitiveBoundingBoxes[PrimitiveIndex]);
+        BinPrimitiveCounts[BinIndex]++;
+    }
+
+    float RightCosts[GC_BOUNDING_VOLUME_HIERARCHY_BIN_COUNT] = {0};
+    GCBoundingBox RightBoundingBox = GCBoundingVolumeHierarchy_CreateEmptyBoundingBox();
+    uint32_t RightPrimitiveCount = 0;
+
+    for (uint32_t Counter = GC_BOUNDING_VOLUME_HIERARCHY_BIN_COUNT - 1; Counter > 0; Counter--)
+    {
+        RightBoundingBox = GCBoundingBox_Merge(&RightBoundingBox, &BinBoundingBoxes[Counter]);
+        RightPrimitiveCount += BinPrimitiveCounts[Counter];
+        RightCosts[Counter] = (float)RightPrimitiveCount * GCBoundingBox_GetSurfaceArea(&RightBoundingBox);
+    }
+
+    GCBoundingBox LeftBoundingBox = GCBoundingVolumeHierarchy_CreateEmptyBoundingBox();
+    uint32_t LeftCount = 0;
+    float BestCost = (float)Node->PrimitiveCount * GCBoundingBox_GetSurfaceArea(&Node->BoundingBox);
+    uint32_t BestSplit = 0;
+
+    for (uint32_t Counter = 1; Counter < GC_BOUNDING_VOLUME_HIERARCHY_BIN_COUNT; Counter++)
+    {
+        LeftBoundingBox = GCBoundingBox_Merge(&LeftBoundingBox, &BinBoundingBoxes[Counter - 1]);
+        LeftCount += BinPrimitiveCounts[Counter - 1];
+
+        if (!LeftCount || LeftCount == Node->PrimitiveCount)
+        {
+            continue;
+        }
+
+        const float Cost = (float)LeftCount * GCBoundingBox_GetSurfaceArea(&LeftBoundingBox) + RightCosts[Counter];
+
+        if (Cost < BestCost)
+        {
+            BestCost = Cost;
+            BestSplit = Counter;
+        }
+    }
+
+    if (!BestSplit)
+    {
+        return false;
+    }
+
+    uint32_t Left = 0, Right = Node->PrimitiveCount;
+
+    while (Left < Right)
+    {
+        uint32_t BinIndex = (uint32_t)(
+            (GCBoundingVolumeHierarchy_GetAxis(PrimitiveCenters[PrimitiveIndices[Left]], Axis) - AxisMinimum) *
+            BinScale);
+        BinIndex = BinIndex < GC_BOUNDING_VOLUME_HIERARCHY_BIN_COUNT ? BinIndex
+                                                                    : GC_BOUNDING_VOLUME_HIERARCHY_BIN_COUNT - 1;
+
+        if (BinIndex < BestSplit)
+        {
+            Left++;
+        }
+        else
+        {
+            Right--;
+
+            const uint32_t TemporaryIndex = PrimitiveIndices[Left];
+            PrimitiveIndices[Left] = PrimitiveIndices[Right];
+            PrimitiveIndices[Right] = TemporaryIndex;
+        }
+    }
+
+    *LeftPrimitiveCount = Left;
+
+    return Left > 0 && Left < Node->PrimitiveCount;
+}
+
+bool GCBoundingVolumeHierarchy_Overlaps(const GCBoundingBox* const BoundingBox1,
+                                        const GCBoundingBox* const BoundingBox2)
+{
+    return BoundingBox1->Minimum.X <= BoundingBox2->Maximum.X && BoundingBox1->Maximum.X >= BoundingBox2->Minimum.X &&
+           BoundingBox1->Minimum.Y <= BoundingBox2->Maximum.Y && BoundingBox1->Maximum.Y >= BoundingBox2->Minimum.Y &&
+           BoundingBox1->Minimum.Z <= BoundingBox2->Maximum.Z && BoundingBox1->Maximum.Z >= BoundingBox2->Minimum.Z;
+}
+
+bool GCBoundingVolumeHierarchy_IsEqual(const GCBoundingBox* const BoundingBox1,
+                                       const GCBoundingBox* const BoundingBox2)
+{
+    return BoundingBox1->Minimum.X == BoundingBox2->Minimum.X && BoundingBox1->Minimum.Y == BoundingBox2->Minimum.Y &&
+           BoundingBox1->Minimum.Z == BoundingBox2->Minimum.Z && BoundingBox1->Maximum.X == BoundingBox2->Maximum.X &&
+           BoundingBox1->Maximum.Y == BoundingBox2->Maximum.Y && BoundingBox1->Maximum.Z == BoundingBox2->Maximum.Z;
+}
@@ -0,0 +1,62 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GC_MATH_BOUNDING_VOLUME_HIERARCHY_H
+#define GC_MATH_BOUNDING_VOLUME_HIERARCHY_H
+
+#include "Math/BoundingVolume.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct GCBoundingVolumeHierarchy GCBoundingVolumeHierarchy;
+    typedef struct GCRay GCRay;
+
+    typedef bool (*GCBoundingVolumeHierarchyRayCastCallbackFunction)(void* const Context,
+                                                                      const uint32_t PrimitiveIndex,
+                                                                      const GCRay* const Ray,
+                                                                      const float MaximumDistance,
+                                                                      float* const Distance);
+
+    GCBoundingVolumeHierarchy* GCBoundingVolumeHierarchy_Create(const GCBoundingBox* const PrimitiveBoundingBoxes,
+                                                                const uint32_t PrimitiveCount);
+    void GCBoundingVolumeHierarchy_Refit(GCBoundingVolumeHierarchy* const BoundingVolumeHierarchy,
+                                         const uint32_t* const PrimitiveIndices,
+                                         const GCBoundingBox* const PrimitiveBoundingBoxes,
+                                         const uint32_t PrimitiveIndexCount);
+    bool GCBoundingVolumeHierarchy_CastRay(const GCBoundingVolumeHierarchy* const BoundingVolumeHierarchy,
+                                           const GCRay* const Ray, const float MaximumDistance,
+                                           const GCBoundingVolumeHierarchyRayCastCallbackFunction CallbackFunction,
+                                           void* const Context, uint32_t* const PrimitiveIndex,
+                                           float* const Distance);
+    uint32_t GCBoundingVolumeHierarchy_Query(const GCBoundingVolumeHierarchy* const BoundingVolumeHierarchy,
+                                             const GCBoundingBox* const BoundingBox, uint32_t* const PrimitiveIndices,
+                                             const uint32_t MaximumPrimitiveIndexCount);
+    GCBoundingBox GCBoundingVolumeHierarchy_GetBoundingBox(
+        const GCBoundingVolumeHierarchy* const BoundingVolumeHierarchy);
+    void GCBoundingVolumeHierarchy_Destroy(GCBoundingVolumeHierarchy* BoundingVolumeHierarchy);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
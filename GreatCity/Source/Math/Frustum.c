@@ -0,0 +1,84 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Math/Frustum.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Vector4.h"
+
+#include <math.h>
+#include <stdint.h>
+
+GCFrustum GCFrustum_CreateFromMatrix(const GCMatrix4x4* const ViewProjectionMatrix)
+{
+    const GCMatrix4x4* const Matrix = ViewProjectionMatrix;
+
+    GCVector4 Rows[4];
+
+    for (uint32_t Counter = 0; Counter < 4; Counter++)
+    {
+        Rows[Counter] = GCVector4_Create(Matrix->Data[0][Counter], Matrix->Data[1][Counter], Matrix->Data[2][Counter],
+                                         Matrix->Data[3][Counter]);
+    }
+
+    GCFrustum Frustum;
+    Frustum.Planes[0] = GCVector4_Add(Rows[3], Rows[0]);
+    Frustum.Planes[1] = GCVector4_Subtract(Rows[3], Rows[0]);
+    Frustum.Planes[2] = GCVector4_Add(Rows[3], Rows[1]);
+    Frustum.Planes[3] = GCVector4_Subtract(Rows[3], Rows[1]);
+    Frustum.Planes[4] = GCVector4_Add(Rows[3], Rows[2]);
+    Frustum.Planes[5] = GCVector4_Subtract(Rows[3], Rows[2]);
+
+    for (uint32_t Counter = 0; Counter < 6; Counter++)
+    {
+        const GCVector4 Plane = Frustum.Planes[Counter];
+        const float Length = sqrtf(Plane.X * Plane.X + Plane.Y * Plane.Y + Plane.Z * Plane.Z);
+
+        if (Length > 0.0f)
+        {
+            Frustum.Planes[Counter] = GCVector4_Create(Plane.X / Length, Plane.Y / Length, Plane.Z / Length,
+                                                       Plane.W / Length);
+        }
+    }
+
+    return Frustum;
+}
+
+void GCFrustum_CullSpheres(const GCFrustum* const Frustum, const float* const CentersX, const float* const CentersY,
+                           const float* const CentersZ, const float* const Radii, const uint32_t SphereCount,
+                           uint8_t* const Visibilities)
+{
+    for (uint32_t Counter = 0; Counter < SphereCount; Counter++)
+    {
+        Visibilities[Counter] = 1;
+    }
+
+    for (uint32_t PlaneIndex = 0; PlaneIndex < 6; PlaneIndex++)
+    {
+        const float PlaneX = Frustum->Planes[PlaneIndex].X;
+        const float PlaneY = Frustum->Planes[PlaneIndex].Y;
+        const float PlaneZ = Frustum->Planes[PlaneIndex].Z;
+        const float PlaneW = Frustum->Planes[PlaneIndex].W;
+
+        for (uint32_t Counter = 0; Counter < SphereCount; Counter++)
+        {
+            const float Distance =
+                PlaneX * CentersX[Counter] + PlaneY * CentersY[Counter] + PlaneZ * CentersZ[Counter] + PlaneW;
+
+            Visibilities[Counter] &= (uint8_t)(Distance >= -Radii[Counter]);
+        }
+    }
+}
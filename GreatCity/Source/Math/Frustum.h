@@ -0,0 +1,46 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GC_MATH_FRUSTUM_H
+#define GC_MATH_FRUSTUM_H
+
+#include "Math/Vector4.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct GCMatrix4x4 GCMatrix4x4;
+
+    typedef struct GCFrustum
+    {
+        GCVector4 Planes[6];
+    } GCFrustum;
+
+    GCFrustum GCFrustum_CreateFromMatrix(const GCMatrix4x4* const ViewProjectionMatrix);
+    void GCFrustum_CullSpheres(const GCFrustum* const Frustum, const float* const CentersX,
+                               const float* const CentersY, const float* const CentersZ, const float* const Radii,
+                               const uint32_t SphereCount, uint8_t* const Visibilities);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
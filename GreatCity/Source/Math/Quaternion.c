@@ -146,6 +146,37 @@ GCQuaternion GCQuaternion_Normalize(const GCQuaternion Quaternion)
     return Result;
 }
 
+GCQuaternion GCQuaternion_Slerp(const GCQuaternion Quaternion1, const GCQuaternion Quaternion2, const float Factor)
+{
+    float Cosine = Quaternion1.W * Quaternion2.W + Quaternion1.X * Quaternion2.X + Quaternion1.Y * Quaternion2.Y +
+                   Quaternion1.Z * Quaternion2.Z;
+    float Sign = 1.0f;
+
+    if (Cosine < 0.0f)
+    {
+        Cosine = -Cosine;
+        Sign = -1.0f;
+    }
+
+    float Factor1 = 1.0f - Factor, Factor2 = Factor;
+
+    if (Cosine < 0.9995f)
+    {
+        const float Angle = acosf(Cosine);
+        const float Sine = sinf(Angle);
+
+        Factor1 = sinf((1.0f - Factor) * Angle) / Sine;
+        Factor2 = sinf(Factor * Angle) / Sine;
+    }
+
+    Factor2 *= Sign;
+
+    return GCQuaternion_Normalize(GCQuaternion_Create(Quaternion1.W * Factor1 + Quaternion2.W * Factor2,
+                                                      Quaternion1.X * Factor1 + Quaternion2.X * Factor2,
+                                                      Quaternion1.Y * Factor1 + Quaternion2.Y * Factor2,
+                                                      Quaternion1.Z * Factor1 + Quaternion2.Z * Factor2));
+}
+
 GCVector3 GCQuaternion_RotateVector(const GCQuaternion Quaternion, const GCVector3 Vector)
 {
     const float Scalar = Quaternion.W;
@@ -43,6 +43,8 @@ extern "C"
     GCQuaternion GCQuaternion_Conjugate(const GCQuaternion Quaternion);
     float GCQuaternion_Magnitude(const GCQuaternion Quaternion);
     GCQuaternion GCQuaternion_Normalize(const GCQuaternion Quaternion);
+    GCQuaternion GCQuaternion_Slerp(const GCQuaternion Quaternion1, const GCQuaternion Quaternion2,
+                                    const float Factor);
     GCVector3 GCQuaternion_RotateVector(const GCQuaternion Quaternion, const GCVector3 Vector);
 
     char* GCQuaternion_ToString(const GCQuaternion Quaternion);
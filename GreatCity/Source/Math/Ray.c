@@ -0,0 +1,120 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Math/Ray.h"
+#include "Math/BoundingVolume.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Vector3.h"
+#include "Math/Vector4.h"
+
+#include <math.h>
+#include <stdbool.h>
+
+GCRay GCRay_Create(const GCVector3 Origin, const GCVector3 Direction)
+{
+    GCRay Result;
+    Result.Origin = Origin;
+    Result.Direction = Direction;
+    Result.InverseDirection = GCVector3_Create(1.0f / Direction.X, 1.0f / Direction.Y, 1.0f / Direction.Z);
+
+    return Result;
+}
+
+GCRay GCRay_Transform(const GCRay* const Ray, const GCMatrix4x4* const Matrix)
+{
+    const GCVector4 Origin =
+        GCMatrix4x4_MultiplyByVector(Matrix, GCVector4_Create(Ray->Origin.X, Ray->Origin.Y, Ray->Origin.Z, 1.0f));
+    const GCVector4 Direction = GCMatrix4x4_MultiplyByVector(
+        Matrix, GCVector4_Create(Ray->Direction.X, Ray->Direction.Y, Ray->Direction.Z, 0.0f));
+
+    return GCRay_Create(GCVector3_Create(Origin.X, Origin.Y, Origin.Z),
+                        GCVector3_Create(Direction.X, Direction.Y, Direction.Z));
+}
+
+GCVector3 GCRay_GetPoint(const GCRay* const Ray, const float Distance)
+{
+    return GCVector3_Add(Ray->Origin, GCVector3_MultiplyByScalar(Ray->Direction, Distance));
+}
+
+bool GCRay_IntersectsBoundingBox(const GCRay* const Ray, const GCBoundingBox* const BoundingBox,
+                                 const float MaximumDistance, float* const Distance)
+{
+    const float MinimumX = (BoundingBox->Minimum.X - Ray->Origin.X) * Ray->InverseDirection.X;
+    const float MaximumX = (BoundingBox->Maximum.X - Ray->Origin.X) * Ray->InverseDirection.X;
+    const float MinimumY = (BoundingBox->Minimum.Y - Ray->Origin.Y) * Ray->InverseDirection.Y;
+    const float MaximumY = (BoundingBox->Maximum.Y - Ray->Origin.Y) * Ray->InverseDirection.Y;
+    const float MinimumZ = (BoundingBox->Minimum.Z - Ray->Origin.Z) * Ray->InverseDirection.Z;
+    const float MaximumZ = (BoundingBox->Maximum.Z - Ray->Origin.Z) * Ray->InverseDirection.Z;
+
+    const float Near =
+        fmaxf(fmaxf(fminf(MinimumX, MaximumX), fminf(MinimumY, MaximumY)), fmaxf(fminf(MinimumZ, MaximumZ), 0.0f));
+    const float Far = fminf(fminf(fmaxf(MinimumX, MaximumX), fmaxf(MinimumY, MaximumY)),
+                            fminf(fmaxf(MinimumZ, MaximumZ), MaximumDistance));
+
+    if (Near > Far)
+    {
+        return false;
+    }
+
+    *Distance = Near;
+
+    return true;
+}
+
+bool GCRay_IntersectsTriangle(const GCRay* const Ray, const GCVector3 Vertex1, const GCVector3 Vertex2,
+                              const GCVector3 Vertex3, const float MaximumDistance, float* const Distance)
+{
+    const GCVector3 Edge1 = GCVector3_Subtract(Vertex2, Vertex1);
+    const GCVector3 Edge2 = GCVector3_Subtract(Vertex3, Vertex1);
+
+    const GCVector3 DirectionCrossEdge2 = GCVector3_Cross(Ray->Direction, Edge2);
+    const float Determinant = GCVector3_Dot(Edge1, DirectionCrossEdge2);
+
+    if (fabsf(Determinant) < 1e-12f)
+    {
+        return false;
+    }
+
+    const float InverseDeterminant = 1.0f / Determinant;
+    const GCVector3 OriginToVertex1 = GCVector3_Subtract(Ray->Origin, Vertex1);
+
+    const float U = GCVector3_Dot(OriginToVertex1, DirectionCrossEdge2) * InverseDeterminant;
+
+    if (U < 0.0f || U > 1.0f)
+    {
+        return false;
+    }
+
+    const GCVector3 OriginCrossEdge1 = GCVector3_Cross(OriginToVertex1, Edge1);
+    const float V = GCVector3_Dot(Ray->Direction, OriginCrossEdge1) * InverseDeterminant;
+
+    if (V < 0.0f || U + V > 1.0f)
+    {
+        return false;
+    }
+
+    const float TriangleDistance = GCVector3_Dot(Edge2, OriginCrossEdge1) * InverseDeterminant;
+
+    if (TriangleDistance < 0.0f || TriangleDistance > MaximumDistance)
+    {
+        return false;
+    }
+
+    *Distance = TriangleDistance;
+
+    return true;
+}
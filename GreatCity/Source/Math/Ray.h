@@ -0,0 +1,52 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GC_MATH_RAY_H
+#define GC_MATH_RAY_H
+
+#include "Math/Vector3.h"
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct GCMatrix4x4 GCMatrix4x4;
+    typedef struct GCBoundingBox GCBoundingBox;
+
+    typedef struct GCRay
+    {
+        GCVector3 Origin;
+        GCVector3 Direction;
+        GCVector3 InverseDirection;
+    } GCRay;
+
+    GCRay GCRay_Create(const GCVector3 Origin, const GCVector3 Direction);
+    GCRay GCRay_Transform(const GCRay* const Ray, const GCMatrix4x4* const Matrix);
+    GCVector3 GCRay_GetPoint(const GCRay* const Ray, const float Distance);
+    bool GCRay_IntersectsBoundingBox(const GCRay* const Ray, const GCBoundingBox* const BoundingBox,
+                                     const float MaximumDistance, float* const Distance);
+    bool GCRay_IntersectsTriangle(const GCRay* const Ray, const GCVector3 Vertex1, const GCVector3 Vertex2,
+                                  const GCVector3 Vertex3, const float MaximumDistance, float* const Distance);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,46 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "ApplicationCore/Application.h"
+#include "ApplicationCore/GenericPlatform/Input.h"
+#include "ApplicationCore/GenericPlatform/KeyCode.h"
+#include "ApplicationCore/GenericPlatform/MouseButtonCode.h"
+#include "Math/Vector2.h"
+
+#include <stdbool.h>
+
+typedef struct GCPlatformWindow GCLinuxWindow;
+
+extern bool GCLinuxWindow_IsKeyPressed(const GCLinuxWindow* const Window, const GCKeyCode KeyCode);
+extern bool GCLinuxWindow_IsMouseButtonPressed(const GCLinuxWindow* const Window,
+                                               const GCMouseButtonCode MouseButtonCode);
+extern GCVector2 GCLinuxWindow_GetMousePosition(const GCLinuxWindow* const Window);
+
+bool GCInput_IsKeyPressed(const GCKeyCode KeyCode)
+{
+    return GCLinuxWindow_IsKeyPressed(GCApplication_GetWindow(), KeyCode);
+}
+
+bool GCInput_IsMouseButtonPressed(const GCMouseButtonCode MouseButtonCode)
+{
+    return GCLinuxWindow_IsMouseButtonPressed(GCApplication_GetWindow(), MouseButtonCode);
+}
+
+GCVector2 GCInput_GetMousePosition(void)
+{
+    return GCLinuxWindow_GetMousePosition(GCApplication_GetWindow());
+}
@@ -0,0 +1,388 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "ApplicationCore/GenericPlatform/Window.h"
+#include "ApplicationCore/Event/ApplicationEvent.h"
+#include "ApplicationCore/Event/Event.h"
+#include "ApplicationCore/Event/KeyEvent.h"
+#include "ApplicationCore/Event/MouseEvent.h"
+#include "ApplicationCore/GenericPlatform/KeyCode.h"
+#include "ApplicationCore/GenericPlatform/MouseButtonCode.h"
+#include "Core/Log.h"
+#include "Core/Memory/Allocator.h"
+#include "Math/Vector2.h"
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GC_LINUX_WINDOW_KEY_COUNT 256
+#define GC_LINUX_WINDOW_MOUSE_BUTTON_COUNT 8
+#define GC_LINUX_WINDOW_INPUT_SCRIPT_LINE_SIZE 256
+
+typedef struct GCPlatformWindow
+{
+    GCWindowProperties Properties;
+    uint32_t Width, Height;
+
+    bool KeyStates[GC_LINUX_WINDOW_KEY_COUNT];
+    bool MouseButtonStates[GC_LINUX_WINDOW_MOUSE_BUTTON_COUNT];
+    GCVector2 MousePosition;
+    float MouseScrollOffset;
+
+    FILE* InputScriptFile;
+    char InputScriptLine[GC_LINUX_WINDOW_INPUT_SCRIPT_LINE_SIZE];
+    uint64_t InputScriptLineFrameIndex;
+    bool IsInputScriptLinePending;
+
+    uint64_t FrameIndex;
+    uint64_t MaximumFrameCount;
+    bool IsClosed;
+} GCWindow, GCLinuxWindow;
+
+void GCLinuxWindow_PressKey(GCLinuxWindow* const Window, const GCKeyCode KeyCode);
+void GCLinuxWindow_ReleaseKey(GCLinuxWindow* const Window, const GCKeyCode KeyCode);
+void GCLinuxWindow_PressMouseButton(GCLinuxWindow* const Window, const GCMouseButtonCode MouseButtonCode);
+void GCLinuxWindow_ReleaseMouseButton(GCLinuxWindow* const Window, const GCMouseButtonCode MouseButtonCode);
+void GCLinuxWindow_MoveMouse(GCLinuxWindow* const Window, const float X, const float Y);
+void GCLinuxWindow_ScrollMouse(GCLinuxWindow* const Window, const float YOffset);
+void GCLinuxWindow_Resize(GCLinuxWindow* const Window, const uint32_t Width, const uint32_t Height);
+void GCLinuxWindow_Close(GCLinuxWindow* const Window);
+bool GCLinuxWindow_IsKeyPressed(const GCLinuxWindow* const Window, const GCKeyCode KeyCode);
+bool GCLinuxWindow_IsMouseButtonPressed(const GCLinuxWindow* const Window, const GCMouseButtonCode MouseButtonCode);
+GCVector2 GCLinuxWindow_GetMousePosition(const GCLinuxWindow* const Window);
+float GCLinuxWindow_ConsumeMouseScrollOffset(GCLinuxWindow* const Window);
+
+static GCLinuxWindow* GCLinuxWindow_Create(const GCWindowProperties* const Properties);
+static uint64_t GCLinuxWindow_GetEnvironmentVariable(const char* const Name, const uint64_t DefaultValue);
+static bool GCLinuxWindow_ReadInputScriptLine(GCLinuxWindow* const Window);
+static void GCLinuxWindow_ExecuteInputScriptLine(GCLinuxWindow* const Window);
+static void GCLinuxWindow_ProcessEvents(GCLinuxWindow* const Window);
+static void GCLinuxWindow_GetWindowSize(const GCLinuxWindow* const Window, uint32_t* const Width,
+                                        uint32_t* const Height);
+static void GCLinuxWindow_Destroy(GCLinuxWindow* Window);
+
+GCWindow* GCWindow_Create(const GCWindowProperties* const Properties)
+{
+    return GCLinuxWindow_Create(Properties);
+}
+
+void GCWindow_ProcessEvents(GCWindow* const Window)
+{
+    GCLinuxWindow_ProcessEvents(Window);
+}
+
+void GCWindow_GetWindowSize(const GCWindow* const Window, uint32_t* const Width, uint32_t* const Height)
+{
+    GCLinuxWindow_GetWindowSize(Window, Width, Height);
+}
+
+void GCWindow_Destroy(GCWindow* Window)
+{
+    GCLinuxWindow_Destroy(Window);
+}
+
+GCLinuxWindow* GCLinuxWindow_Create(const GCWindowProperties* const Properties)
+{
+    GCLinuxWindow* Window = (GCLinuxWindow*)GCMemory_AllocateZero(sizeof(GCLinuxWindow));
+    Window->Properties = *Properties;
+    Window->Width = (uint32_t)GCLinuxWindow_GetEnvironmentVariable("GC_HEADLESS_WIDTH", Properties->Width);
+    Window->Height = (uint32_t)GCLinuxWindow_GetEnvironmentVariable("GC_HEADLESS_HEIGHT", Properties->Height);
+    Window->MousePosition = GCVector2_CreateZero();
+    Window->MaximumFrameCount = GCLinuxWindow_GetEnvironmentVariable("GC_HEADLESS_FRAME_COUNT", 0);
+
+    const char* const InputScriptPath = getenv("GC_HEADLESS_INPUT_SCRIPT");
+
+    if (InputScriptPath && *InputScriptPath)
+    {
+        Window->InputScriptFile = fopen(InputScriptPath, "r");
+
+        if (!Window->InputScriptFile)
+        {
+            GC_LOG_ERROR("Failed to open the input script '%s'", InputScriptPath);
+        }
+    }
+
+    return Window;
+}
+
+uint64_t GCLinuxWindow_GetEnvironmentVariable(const char* const Name, const uint64_t DefaultValue)
+{
+    const char* const Value = getenv(Name);
+
+    if (!Value || !*Value)
+    {
+        return DefaultValue;
+    }
+
+    char* ValueEnd = NULL;
+    const unsigned long long TheValue = strtoull(Value, &ValueEnd, 0);
+
+    return *ValueEnd == '\0' ? (uint64_t)TheValue : DefaultValue;
+}
+
+bool GCLinuxWindow_ReadInputScriptLine(GCLinuxWindow* const Window)
+{
+    while (fgets(Window->InputScriptLine, GC_LINUX_WINDOW_INPUT_SCRIPT_LINE_SIZE, Window->InputScriptFile))
+    {
+        int32_t CommandOffset = 0;
+
+        const int32_t ScannedCount =
+            sscanf(Window->InputScriptLine, "%" SCNu64 " %n", &Window->InputScriptLineFrameIndex, &CommandOffset);
+
+        if (ScannedCount != 1 || !CommandOffset)
+        {
+            continue;
+        }
+
+        memmove(Window->InputScriptLine, Window->InputScriptLine + CommandOffset,
+                strlen(Window->InputScriptLine + CommandOffset) + 1);
+        Window->InputScriptLine[strcspn(Window->InputScriptLine, "\r\n")] = '\0';
+
+        return true;
+    }
+
+    return false;
+}
+
+void GCLinuxWindow_ExecuteInputScriptLine(GCLinuxWindow* const Window)
+{
+    char Command[32] = {0};
+    int32_t ArgumentOffset = 0;
+
+    if (sscanf(Window->InputScriptLine, "%31s %n", Command, &ArgumentOffset) != 1)
+    {
+        return;
+    }
+
+    const char* const Arguments = Window->InputScriptLine + ArgumentOffset;
+
+    int32_t Code = 0;
+    uint32_t Width = 0, Height = 0;
+    float X = 0.0f, Y = 0.0f;
+
+    if (strcmp(Command, "KeyPress") == 0 && sscanf(Arguments, "%i", &Code) == 1)
+    {
+        GCLinuxWindow_PressKey(Window, (GCKeyCode)Code);
+    }
+    else if (strcmp(Command, "KeyRelease") == 0 && sscanf(Arguments, "%i", &Code) == 1)
+    {
+        GCLinuxWindow_ReleaseKey(Window, (GCKeyCode)Code);
+    }
+    else if (strcmp(Command, "MousePress") == 0 && sscanf(Arguments, "%i", &Code) == 1)
+    {
+        GCLinuxWindow_PressMouseButton(Window, (GCMouseButtonCode)Code);
+    }
+    else if (strcmp(Command, "MouseRelease") == 0 && sscanf(Arguments, "%i", &Code) == 1)
+    {
+        GCLinuxWindow_ReleaseMouseButton(Window, (GCMouseButtonCode)Code);
+    }
+    else if (strcmp(Command, "MouseMove") == 0 && sscanf(Arguments, "%f %f", &X, &Y) == 2)
+    {
+        GCLinuxWindow_MoveMouse(Window, X, Y);
+    }
+    else if (strcmp(Command, "MouseScroll") == 0 && sscanf(Arguments, "%f", &Y) == 1)
+    {
+        GCLinuxWindow_ScrollMouse(Window, Y);
+    }
+    else if (strcmp(Command, "Resize") == 0 && sscanf(Arguments, "%u %u", &Width, &Height) == 2)
+    {
+        GCLinuxWindow_Resize(Window, Width, Height);
+    }
+    else if (strcmp(Command, "Close") == 0)
+    {
+        GCLinuxWindow_Close(Window);
+    }
+    else
+    {
+        GC_LOG_WARNING("Unknown input script command '%s'", Window->InputScriptLine);
+    }
+}
+
+void GCLinuxWindow_ProcessEvents(GCLinuxWindow* const Window)
+{
+    Window->FrameIndex++;
+
+    if (Window->InputScriptFile)
+    {
+        while (!Window->IsClosed)
+        {
+            if (!Window->IsInputScriptLinePending)
+            {
+                Window->IsInputScriptLinePending = GCLinuxWindow_ReadInputScriptLine(Window);
+
+                if (!Window->IsInputScriptLinePending)
+                {
+                    break;
+                }
+            }
+
+            if (Window->InputScriptLineFrameIndex > Window->FrameIndex)
+            {
+                break;
+            }
+
+            GCLinuxWindow_ExecuteInputScriptLine(Window);
+            Window->IsInputScriptLinePending = false;
+        }
+    }
+
+    if (Window->MaximumFrameCount && Window->FrameIndex >= Window->MaximumFrameCount)
+    {
+        GCLinuxWindow_Close(Window);
+    }
+}
+
+void GCLinuxWindow_GetWindowSize(const GCLinuxWindow* const Window, uint32_t* const Width, uint32_t* const Height)
+{
+    if (Width)
+    {
+        *Width = Window->Width;
+    }
+
+    if (Height)
+    {
+        *Height = Window->Height;
+    }
+}
+
+void GCLinuxWindow_Destroy(GCLinuxWindow* Window)
+{
+    if (Window->InputScriptFile)
+    {
+        fclose(Window->InputScriptFile);
+    }
+
+    GCMemory_Free(Window);
+}
+
+void GCLinuxWindow_PressKey(GCLinuxWindow* const Window, const GCKeyCode KeyCode)
+{
+    if ((uint32_t)KeyCode < GC_LINUX_WINDOW_KEY_COUNT)
+    {
+        Window->KeyStates[KeyCode] = true;
+    }
+
+    const GCKeyPressedEvent EventDetail = GCKeyPressedEvent_Create(KeyCode);
+    GCEvent Event = GCEvent_Create(GCEventType_KeyPressed, &EventDetail);
+    Window->Properties.EventCallback(Window, &Event);
+}
+
+void GCLinuxWindow_ReleaseKey(GCLinuxWindow* const Window, const GCKeyCode KeyCode)
+{
+    if ((uint32_t)KeyCode < GC_LINUX_WINDOW_KEY_COUNT)
+    {
+        Window->KeyStates[KeyCode] = false;
+    }
+
+    const GCKeyReleasedEvent EventDetail = GCKeyReleasedEvent_Create(KeyCode);
+    GCEvent Event = GCEvent_Create(GCEventType_KeyReleased, &EventDetail);
+    Window->Properties.EventCallback(Window, &Event);
+}
+
+void GCLinuxWindow_PressMouseButton(GCLinuxWindow* const Window, const GCMouseButtonCode MouseButtonCode)
+{
+    if ((uint32_t)MouseButtonCode < GC_LINUX_WINDOW_MOUSE_BUTTON_COUNT)
+    {
+        Window->MouseButtonStates[MouseButtonCode] = true;
+    }
+
+    const GCMouseButtonPressedEvent EventDetail = GCMouseButtonPressedEvent_Create(MouseButtonCode);
+    GCEvent Event = GCEvent_Create(GCEventType_MouseButtonPressed, &EventDetail);
+    Window->Properties.EventCallback(Window, &Event);
+}
+
+void GCLinuxWindow_ReleaseMouseButton(GCLinuxWindow* const Window, const GCMouseButtonCode MouseButtonCode)
+{
+    if ((uint32_t)MouseButtonCode < GC_LINUX_WINDOW_MOUSE_BUTTON_COUNT)
+    {
+        Window->MouseButtonStates[MouseButtonCode] = false;
+    }
+
+    const GCMouseButtonReleasedEvent EventDetail = GCMouseButtonReleasedEvent_Create(MouseButtonCode);
+    GCEvent Event = GCEvent_Create(GCEventType_MouseButtonReleased, &EventDetail);
+    Window->Properties.EventCallback(Window, &Event);
+}
+
+void GCLinuxWindow_MoveMouse(GCLinuxWindow* const Window, const float X, const float Y)
+{
+    Window->MousePosition = GCVector2_Create(X, Y);
+
+    const GCMouseMovedEvent EventDetail = GCMouseMovedEvent_Create(X, Y);
+    GCEvent Event = GCEvent_Create(GCEventType_MouseMoved, &EventDetail);
+    Window->Properties.EventCallback(Window, &Event);
+}
+
+void GCLinuxWindow_ScrollMouse(GCLinuxWindow* const Window, const float YOffset)
+{
+    Window->MouseScrollOffset += YOffset;
+
+    const GCMouseScrolledEvent EventDetail = GCMouseScrolledEvent_Create(0.0f, YOffset);
+    GCEvent Event = GCEvent_Create(GCEventType_MouseScrolled, &EventDetail);
+    Window->Properties.EventCallback(Window, &Event);
+}
+
+void GCLinuxWindow_Resize(GCLinuxWindow* const Window, const uint32_t Width, const uint32_t Height)
+{
+    Window->Width = Width;
+    Window->Height = Height;
+
+    const GCWindowResizedEvent EventDetail = GCWindowResizedEvent_Create(Width, Height);
+    GCEvent Event = GCEvent_Create(GCEventType_WindowResized, &EventDetail);
+    Window->Properties.EventCallback(Window, &Event);
+}
+
+void GCLinuxWindow_Close(GCLinuxWindow* const Window)
+{
+    if (Window->IsClosed)
+    {
+        return;
+    }
+
+    Window->IsClosed = true;
+
+    const GCWindowClosedEvent EventDetail = GCWindowClosedEvent_Create();
+    GCEvent Event = GCEvent_Create(GCEventType_WindowClosed, &EventDetail);
+    Window->Properties.EventCallback(Window, &Event);
+}
+
+bool GCLinuxWindow_IsKeyPressed(const GCLinuxWindow* const Window, const GCKeyCode KeyCode)
+{
+    return (uint32_t)KeyCode < GC_LINUX_WINDOW_KEY_COUNT && Window->KeyStates[KeyCode];
+}
+
+bool GCLinuxWindow_IsMouseButtonPressed(const GCLinuxWindow* const Window, const GCMouseButtonCode MouseButtonCode)
+{
+    return (uint32_t)MouseButtonCode < GC_LINUX_WINDOW_MOUSE_BUTTON_COUNT &&
+           Window->MouseButtonStates[MouseButtonCode];
+}
+
+GCVector2 GCLinuxWindow_GetMousePosition(const GCLinuxWindow* const Window)
+{
+    return Window->MousePosition;
+}
+
+float GCLinuxWindow_ConsumeMouseScrollOffset(GCLinuxWindow* const Window)
+{
+    const float MouseScrollOffset = Window->MouseScrollOffset;
+    Window->MouseScrollOffset = 0.0f;
+
+    return MouseScrollOffset;
+}
@@ -0,0 +1,63 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Core/Atomic.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+int64_t GCAtomic_Load(const volatile int64_t* const Value)
+{
+    return __atomic_load_n(Value, __ATOMIC_ACQUIRE);
+}
+
+void GCAtomic_Store(volatile int64_t* const Value, const int64_t NewValue)
+{
+    __atomic_store_n(Value, NewValue, __ATOMIC_RELEASE);
+}
+
+int64_t GCAtomic_Add(volatile int64_t* const Value, const int64_t Addend)
+{
+    return __atomic_add_fetch(Value, Addend, __ATOMIC_SEQ_CST);
+}
+
+int64_t GCAtomic_Exchange(volatile int64_t* const Value, const int64_t NewValue)
+{
+    return __atomic_exchange_n(Value, NewValue, __ATOMIC_SEQ_CST);
+}
+
+bool GCAtomic_CompareExchange(volatile int64_t* const Value, const int64_t Expected, const int64_t Desired)
+{
+    int64_t TheExpected = Expected;
+
+    return __atomic_compare_exchange_n(Value, &TheExpected, Desired, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+}
+
+void* GCAtomic_LoadPointer(void* volatile const* const Pointer)
+{
+    return __atomic_load_n(Pointer, __ATOMIC_ACQUIRE);
+}
+
+void GCAtomic_StorePointer(void* volatile* const Pointer, void* const NewPointer)
+{
+    __atomic_store_n(Pointer, NewPointer, __ATOMIC_RELEASE);
+}
+
+void GCAtomic_ThreadFence(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
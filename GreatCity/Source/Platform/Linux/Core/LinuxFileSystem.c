@@ -0,0 +1,159 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Core/FileSystem.h"
+#include "Core/Memory/Allocator.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+typedef struct GCFileSystemMappedFile
+{
+    void* Data;
+    size_t Size;
+} GCFileSystemMappedFile;
+
+bool GCFileSystem_Exists(const char* const Path)
+{
+    struct stat Status;
+
+    return stat(Path, &Status) == 0;
+}
+
+char* GCFileSystem_GetFileName(const char* const Path)
+{
+    const char* FileName = strrchr(Path, '/');
+    FileName = FileName ? FileName + 1 : Path;
+
+    const size_t FileNameLength = strlen(FileName);
+
+    char* TheFileName = (char*)GCMemory_Allocate((FileNameLength + 1) * sizeof(char));
+    memcpy(TheFileName, FileName, (FileNameLength + 1) * sizeof(char));
+
+    return TheFileName;
+}
+
+void GCFileSystem_CreateDirectories(const char* const Path)
+{
+    char* ThePath = (char*)GCMemory_AllocateZero((strlen(Path) + 1) * sizeof(char));
+
+    for (uint32_t Counter = 0; Counter < strlen(Path) + 1; Counter++)
+    {
+        ThePath[Counter] = Path[Counter];
+
+        if (ThePath[Counter] == '/' || ThePath[Counter] == '\\')
+        {
+            mkdir(ThePath, 0755);
+        }
+    }
+
+    GCMemory_Free(ThePath);
+}
+
+GCFileSystemFileAttributes GCFileSystem_GetFileAttributes(const char* const Path)
+{
+    GCFileSystemFileAttributes FileAttributes = {0};
+
+    struct stat Status;
+
+    if (stat(Path, &Status) == 0)
+    {
+        FileAttributes.LastWriteTime.Seconds = (int64_t)Status.st_mtim.tv_sec;
+        FileAttributes.LastWriteTime.Nanoseconds = (int64_t)Status.st_mtim.tv_nsec;
+        FileAttributes.Size = (uint64_t)Status.st_size;
+    }
+
+    return FileAttributes;
+}
+
+GCFileSystemMappedFile* GCFileSystem_MapFile(const char* const Path)
+{
+    const int FileHandle = open(Path, O_RDONLY);
+
+    if (FileHandle < 0)
+    {
+        return NULL;
+    }
+
+    struct stat Status;
+
+    if (fstat(FileHandle, &Status) != 0 || !Status.st_size)
+    {
+        close(FileHandle);
+
+        return NULL;
+    }
+
+    void* const Data = mmap(NULL, (size_t)Status.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, FileHandle, 0);
+    close(FileHandle);
+
+    if (Data == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    GCFileSystemMappedFile* MappedFile = (GCFileSystemMappedFile*)GCMemory_Allocate(sizeof(GCFileSystemMappedFile));
+    MappedFile->Data = Data;
+    MappedFile->Size = (size_t)Status.st_size;
+
+    return MappedFile;
+}
+
+void* GCFileSystemMappedFile_GetData(const GCFileSystemMappedFile* const MappedFile)
+{
+    return MappedFile->Data;
+}
+
+size_t GCFileSystemMappedFile_GetSize(const GCFileSystemMappedFile* const MappedFile)
+{
+    return MappedFile->Size;
+}
+
+void GCFileSystem_UnmapFile(GCFileSystemMappedFile* MappedFile)
+{
+    munmap(MappedFile->Data, MappedFile->Size);
+
+    GCMemory_Free(MappedFile);
+}
+
+bool GCFileSystemFileTime_IsNewer(const GCFileSystemFileTime FileTime1, const GCFileSystemFileTime FileTime2)
+{
+    if (FileTime1.Seconds != FileTime2.Seconds)
+    {
+        return FileTime1.Seconds > FileTime2.Seconds;
+    }
+
+    return FileTime1.Nanoseconds > FileTime2.Nanoseconds;
+}
+
+bool GCFileSystemFileTime_IsEqual(const GCFileSystemFileTime FileTime1, const GCFileSystemFileTime FileTime2)
+{
+    return FileTime1.Seconds == FileTime2.Seconds && FileTime1.Nanoseconds == FileTime2.Nanoseconds;
+}
+
+bool GCFileSystemFileTime_IsOlder(const GCFileSystemFileTime FileTime1, const GCFileSystemFileTime FileTime2)
+{
+    return GCFileSystemFileTime_IsNewer(FileTime2, FileTime1);
+}
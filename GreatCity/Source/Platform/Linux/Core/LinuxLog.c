@@ -0,0 +1,73 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Core/Log.h"
+
+#include <stdio.h>
+
+#include <unistd.h>
+
+void GCLog_ChangeConsoleColor(const GCLogLevel Level)
+{
+    FILE* OutputHandle = NULL;
+    const char* ConsoleColor = "";
+
+    if (Level < GCLogLevel_Error)
+    {
+        OutputHandle = stdout;
+    }
+    else
+    {
+        OutputHandle = stderr;
+    }
+
+    if (!isatty(fileno(OutputHandle)))
+    {
+        return;
+    }
+
+    switch (Level)
+    {
+    case GCLogLevel_Trace: {
+        ConsoleColor = "\033[0;37m";
+
+        break;
+    }
+    case GCLogLevel_Information: {
+        ConsoleColor = "\033[0;32m";
+
+        break;
+    }
+    case GCLogLevel_Warning: {
+        ConsoleColor = "\033[0;33m";
+
+        break;
+    }
+    case GCLogLevel_Error: {
+        ConsoleColor = "\033[0;31m";
+
+        break;
+    }
+    case GCLogLevel_Fatal: {
+        ConsoleColor = "\033[0;41m";
+
+        break;
+    }
+    }
+
+    fputs(ConsoleColor, OutputHandle);
+}
@@ -0,0 +1,108 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Core/Thread.h"
+#include "Core/Memory/Allocator.h"
+
+#include <stdint.h>
+
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <unistd.h>
+
+typedef struct GCThread
+{
+    pthread_t ThreadHandle;
+    GCThreadFunction Function;
+    void* Data;
+} GCThread;
+
+typedef struct GCThreadSemaphore
+{
+    sem_t SemaphoreHandle;
+} GCThreadSemaphore;
+
+static void* GCThread_Run(void* Data);
+
+GCThread* GCThread_Create(const GCThreadFunction Function, void* const Data)
+{
+    GCThread* Thread = (GCThread*)GCMemory_Allocate(sizeof(GCThread));
+    Thread->Function = Function;
+    Thread->Data = Data;
+
+    pthread_create(&Thread->ThreadHandle, NULL, GCThread_Run, Thread);
+
+    return Thread;
+}
+
+void GCThread_Join(GCThread* Thread)
+{
+    pthread_join(Thread->ThreadHandle, NULL);
+
+    GCMemory_Free(Thread);
+}
+
+void GCThread_Yield(void)
+{
+    sched_yield();
+}
+
+uint32_t GCThread_GetHardwareThreadCount(void)
+{
+    const long ProcessorCount = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return ProcessorCount > 0 ? (uint32_t)ProcessorCount : 1;
+}
+
+GCThreadSemaphore* GCThreadSemaphore_Create(const uint32_t InitialCount)
+{
+    GCThreadSemaphore* Semaphore = (GCThreadSemaphore*)GCMemory_Allocate(sizeof(GCThreadSemaphore));
+    sem_init(&Semaphore->SemaphoreHandle, 0, InitialCount);
+
+    return Semaphore;
+}
+
+void GCThreadSemaphore_Wait(GCThreadSemaphore* const Semaphore)
+{
+    while (sem_wait(&Semaphore->SemaphoreHandle) != 0)
+    {
+    }
+}
+
+void GCThreadSemaphore_Signal(GCThreadSemaphore* const Semaphore, const uint32_t Count)
+{
+    for (uint32_t Counter = 0; Counter < Count; Counter++)
+    {
+        sem_post(&Semaphore->SemaphoreHandle);
+    }
+}
+
+void GCThreadSemaphore_Destroy(GCThreadSemaphore* Semaphore)
+{
+    sem_destroy(&Semaphore->SemaphoreHandle);
+
+    GCMemory_Free(Semaphore);
+}
+
+void* GCThread_Run(void* Data)
+{
+    GCThread* const Thread = (GCThread* const)Data;
+    Thread->Function(Thread->Data);
+
+    return NULL;
+}
@@ -0,0 +1,63 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Core/Atomic.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <Windows.h>
+
+int64_t GCAtomic_Load(const volatile int64_t* const Value)
+{
+    return ReadAcquire64((const volatile LONG64*)Value);
+}
+
+void GCAtomic_Store(volatile int64_t* const Value, const int64_t NewValue)
+{
+    WriteRelease64((volatile LONG64*)Value, NewValue);
+}
+
+int64_t GCAtomic_Add(volatile int64_t* const Value, const int64_t Addend)
+{
+    return InterlockedAdd64((volatile LONG64*)Value, Addend);
+}
+
+int64_t GCAtomic_Exchange(volatile int64_t* const Value, const int64_t NewValue)
+{
+    return InterlockedExchange64((volatile LONG64*)Value, NewValue);
+}
+
+bool GCAtomic_CompareExchange(volatile int64_t* const Value, const int64_t Expected, const int64_t Desired)
+{
+    return InterlockedCompareExchange64((volatile LONG64*)Value, Desired, Expected) == Expected;
+}
+
+void* GCAtomic_LoadPointer(void* volatile const* const Pointer)
+{
+    return ReadPointerAcquire((PVOID const volatile*)Pointer);
+}
+
+void GCAtomic_StorePointer(void* volatile* const Pointer, void* const NewPointer)
+{
+    WritePointerRelease((PVOID volatile*)Pointer, NewPointer);
+}
+
+void GCAtomic_ThreadFence(void)
+{
+    MemoryBarrier();
+}
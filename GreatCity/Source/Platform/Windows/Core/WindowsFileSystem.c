@@ -20,11 +20,18 @@
 #include "Core/Memory/Allocator.h"
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <string.h>
 
 #include <Shlwapi.h>
 #include <Windows.h>
 
+typedef struct GCFileSystemMappedFile
+{
+    void* Data;
+    size_t Size;
+} GCFileSystemMappedFile;
+
 bool GCFileSystem_Exists(const char* const Path)
 {
     wchar_t* PathUTF16 = GCString_UTF8ToUTF16(Path);
@@ -78,10 +85,72 @@ GCFileSystemFileAttributes GCFileSystem_GetFileAttributes(const char* const Path
     FileTimeToSystemTime(&FileAttributeData.ftLastWriteTime, &LastWriteSystemTime);
 
     FileAttributes.LastWriteTime = *(GCFileSystemFileTime*)&LastWriteSystemTime;
+    FileAttributes.Size = ((uint64_t)FileAttributeData.nFileSizeHigh << 32) | FileAttributeData.nFileSizeLow;
 
     return FileAttributes;
 }
 
+GCFileSystemMappedFile* GCFileSystem_MapFile(const char* const Path)
+{
+    wchar_t* PathUTF16 = GCString_UTF8ToUTF16(Path);
+    const HANDLE FileHandle =
+        CreateFileW(PathUTF16, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    GCMemory_Free(PathUTF16);
+
+    if (FileHandle == INVALID_HANDLE_VALUE)
+    {
+        return NULL;
+    }
+
+    LARGE_INTEGER FileSize = {0};
+
+    if (!GetFileSizeEx(FileHandle, &FileSize) || !FileSize.QuadPart)
+    {
+        CloseHandle(FileHandle);
+
+        return NULL;
+    }
+
+    const HANDLE FileMappingHandle = CreateFileMappingW(FileHandle, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    CloseHandle(FileHandle);
+
+    if (!FileMappingHandle)
+    {
+        return NULL;
+    }
+
+    void* const Data = MapViewOfFile(FileMappingHandle, FILE_MAP_COPY, 0, 0, 0);
+    CloseHandle(FileMappingHandle);
+
+    if (!Data)
+    {
+        return NULL;
+    }
+
+    GCFileSystemMappedFile* MappedFile = (GCFileSystemMappedFile*)GCMemory_Allocate(sizeof(GCFileSystemMappedFile));
+    MappedFile->Data = Data;
+    MappedFile->Size = (size_t)FileSize.QuadPart;
+
+    return MappedFile;
+}
+
+void* GCFileSystemMappedFile_GetData(const GCFileSystemMappedFile* const MappedFile)
+{
+    return MappedFile->Data;
+}
+
+size_t GCFileSystemMappedFile_GetSize(const GCFileSystemMappedFile* const MappedFile)
+{
+    return MappedFile->Size;
+}
+
+void GCFileSystem_UnmapFile(GCFileSystemMappedFile* MappedFile)
+{
+    UnmapViewOfFile(MappedFile->Data);
+
+    GCMemory_Free(MappedFile);
+}
+
 bool GCFileSystemFileTime_IsNewer(const GCFileSystemFileTime FileTime1, const GCFileSystemFileTime FileTime2)
 {
     FILETIME TheFileTime1 = {0};
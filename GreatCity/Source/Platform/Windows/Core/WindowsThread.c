@@ -0,0 +1,101 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Core/Thread.h"
+#include "Core/Memory/Allocator.h"
+
+#include <stdint.h>
+
+#include <Windows.h>
+
+typedef struct GCThread
+{
+    HANDLE ThreadHandle;
+    GCThreadFunction Function;
+    void* Data;
+} GCThread;
+
+typedef struct GCThreadSemaphore
+{
+    HANDLE SemaphoreHandle;
+} GCThreadSemaphore;
+
+static DWORD WINAPI GCThread_Run(LPVOID Data);
+
+GCThread* GCThread_Create(const GCThreadFunction Function, void* const Data)
+{
+    GCThread* Thread = (GCThread*)GCMemory_Allocate(sizeof(GCThread));
+    Thread->Function = Function;
+    Thread->Data = Data;
+    Thread->ThreadHandle = CreateThread(NULL, 0, GCThread_Run, Thread, 0, NULL);
+
+    return Thread;
+}
+
+void GCThread_Join(GCThread* Thread)
+{
+    WaitForSingleObject(Thread->ThreadHandle, INFINITE);
+    CloseHandle(Thread->ThreadHandle);
+
+    GCMemory_Free(Thread);
+}
+
+void GCThread_Yield(void)
+{
+    SwitchToThread();
+}
+
+uint32_t GCThread_GetHardwareThreadCount(void)
+{
+    SYSTEM_INFO SystemInformation;
+    GetSystemInfo(&SystemInformation);
+
+    return (uint32_t)SystemInformation.dwNumberOfProcessors;
+}
+
+GCThreadSemaphore* GCThreadSemaphore_Create(const uint32_t InitialCount)
+{
+    GCThreadSemaphore* Semaphore = (GCThreadSemaphore*)GCMemory_Allocate(sizeof(GCThreadSemaphore));
+    Semaphore->SemaphoreHandle = CreateSemaphoreW(NULL, (LONG)InitialCount, MAXLONG, NULL);
+
+    return Semaphore;
+}
+
+void GCThreadSemaphore_Wait(GCThreadSemaphore* const Semaphore)
+{
+    WaitForSingleObject(Semaphore->SemaphoreHandle, INFINITE);
+}
+
+void GCThreadSemaphore_Signal(GCThreadSemaphore* const Semaphore, const uint32_t Count)
+{
+    ReleaseSemaphore(Semaphore->SemaphoreHandle, (LONG)Count, NULL);
+}
+
+void GCThreadSemaphore_Destroy(GCThreadSemaphore* Semaphore)
+{
+    CloseHandle(Semaphore->SemaphoreHandle);
+
+    GCMemory_Free(Semaphore);
+}
+
+DWORD WINAPI GCThread_Run(LPVOID Data)
+{
+    GCThread* const Thread = (GCThread* const)Data;
+    Thread->Function(Thread->Data);
+
+    return 0;
+}
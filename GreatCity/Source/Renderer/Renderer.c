@@ -19,24 +19,29 @@
 #include "ApplicationCore/Application.h"
 #include "ApplicationCore/GenericPlatform/Window.h"
 #include "Core/Memory/Allocator.h"
+#include "Core/Memory/FrameAllocator.h"
 #include "ImGui/ImGuiManager.h"
+#include "Math/BoundingVolume.h"
+#include "Math/Frustum.h"
 #include "Math/Matrix4x4.h"
 #include "Math/Quaternion.h"
 #include "Math/Vector2.h"
 #include "Math/Vector3.h"
 #include "Math/Vector4.h"
 #include "Renderer/RendererCommandList.h"
+#include "Renderer/RendererComputePipeline.h"
 #include "Renderer/RendererDevice.h"
 #include "Renderer/RendererEnums.h"
 #include "Renderer/RendererFramebuffer.h"
+#include "Renderer/RendererGeometryPool.h"
 #include "Renderer/RendererGraphicsPipeline.h"
-#include "Renderer/RendererIndexBuffer.h"
 #include "Renderer/RendererMesh.h"
+#include "Renderer/RendererModel.h"
+#include "Renderer/RendererRingBuffer.h"
 #include "Renderer/RendererShader.h"
+#include "Renderer/RendererStorageBuffer.h"
 #include "Renderer/RendererSwapChain.h"
 #include "Renderer/RendererTexture2D.h"
-#include "Renderer/RendererUniformBuffer.h"
-#include "Renderer/RendererVertexBuffer.h"
 #include "World/Camera/WorldCamera.h"
 #include "World/Components.h"
 #include "World/Entity.h"
@@ -46,30 +51,101 @@
 #include <stdint.h>
 #include <string.h>
 
+#define GC_RENDERER_SORT_KEY_MESH_SHIFT 24
+#define GC_RENDERER_SORT_KEY_MESH_MASK ((1ull << GC_RENDERER_MESH_SORT_KEY_BIT_COUNT) - 1)
+#define GC_RENDERER_SORT_KEY_DEPTH_MASK 0xFFFFFFull
+#define GC_RENDERER_CULLING_GROUP_SIZE 64
+#define GC_RENDERER_GEOMETRY_POOL_VERTEX_CAPACITY (1u << 20)
+#define GC_RENDERER_GEOMETRY_POOL_INDEX_CAPACITY (1u << 22)
+#define GC_RENDERER_LOD_HYSTERESIS 0.15f
+#define GC_RENDERER_RING_BUFFER_FRAME_SIZE (64 * 1024)
+
+#ifdef GC_RENDERER_CPU_PICKING
+#define GC_RENDERER_ATTACHMENT_COUNT 2
+#else
+#define GC_RENDERER_ATTACHMENT_COUNT 3
+#endif
+
 typedef struct GCRendererDrawData
 {
-    const GCRendererVertexBuffer* VertexBuffer;
-    uint32_t VertexCount;
+    GCRendererGeometryAllocation Geometry;
 
-    const GCRendererIndexBuffer* IndexBuffer;
-    uint32_t IndexCount;
+    GCMatrix4x4 Transform;
+    GCBoundingSphere BoundingSphere;
+    GCEntity Entity;
 } GCRendererDrawData;
 
+typedef struct GCRendererDrawKey
+{
+    uint64_t SortKey;
+    uint32_t DrawDataIndex;
+} GCRendererDrawKey;
+
+typedef struct GCRendererCullingInstanceData
+{
+    GCMatrix4x4 Transform;
+    GCVector4 BoundingSphere;
+    uint32_t EntityID;
+    uint32_t BatchIndex;
+    uint32_t Padding[2];
+} GCRendererCullingInstanceData;
+
+typedef struct GCRendererInstanceData
+{
+    GCMatrix4x4 Transform;
+    uint32_t EntityID;
+    uint32_t Padding[3];
+} GCRendererInstanceData;
+
+typedef struct GCRendererCullingPushConstantData
+{
+    GCVector4 FrustumPlanes[6];
+    uint32_t InstanceCount;
+} GCRendererCullingPushConstantData;
+
+typedef struct GCRendererCullingFrame
+{
+    GCRendererStorageBuffer* InputInstanceBuffer;
+    GCRendererStorageBuffer* OutputInstanceBuffer;
+    GCRendererStorageBuffer* IndirectCommandBuffer;
+    uint32_t Capacity;
+    uint32_t InstanceCount;
+    uint32_t IndirectCommandCount;
+} GCRendererCullingFrame;
+
 typedef struct GCRenderer
 {
     GCRendererDevice* Device;
     GCRendererSwapChain* SwapChain;
     GCRendererCommandList* CommandList;
-    GCRendererUniformBuffer* UniformBuffer;
+    GCRendererGeometryPool* GeometryPool;
+    GCRendererRingBuffer* RingBuffer;
     GCRendererShader* BasicShader;
+    GCRendererShader* CullingShader;
     GCRendererTexture2D** Texture2Ds;
     uint32_t Texture2DCount;
     GCRendererGraphicsPipeline* GraphicsPipeline;
+    GCRendererComputePipeline* CullingPipeline;
     GCRendererFramebuffer* Framebuffer;
 
+    GCFrameAllocator* FrameAllocator;
+    uint64_t FrameAllocationCount;
+    uint64_t HeapAllocationCount;
+
     uint32_t MaximumDrawDataCount;
     GCRendererDrawData* DrawData;
+    GCRendererDrawKey* DrawKeys;
+    GCRendererDrawKey* SortedDrawKeys;
     uint32_t DrawDataCount;
+
+    GCMatrix4x4 ViewProjectionMatrix;
+    uint32_t UniformOffset;
+    GCVector3 CameraPosition;
+    float ProjectionScale;
+    GCRendererStatistics Statistics;
+
+    GCRendererCullingFrame* CullingFrames;
+    uint32_t FrameCount;
 } GCRenderer;
 
 typedef struct GCRendererUniformBufferData
@@ -77,6 +153,20 @@ typedef struct GCRendererUniformBufferData
     alignas(16) GCMatrix4x4 ViewProjectionMatrix;
 } GCRendererUniformBufferData;
 
+static uint64_t GCRenderer_CreateSortKey(const uint32_t MeshID, const float Depth);
+static uint32_t GCRenderer_SelectLOD(const GCRendererModel* const Model, const GCBoundingSphere* const BoundingSphere,
+                                     const uint32_t CurrentLODIndex);
+static void GCRenderer_AllocateDrawData(const uint32_t PreviousCount);
+static void GCRenderer_UpdateCullingStatistics(void);
+static void GCRenderer_SortDrawKeys(void);
+static void GCRenderer_UpdateCullingBuffers(void);
+#ifdef GC_RENDERER_CPU_CULLING
+static void GCRenderer_CullInstances(void);
+#else
+static void GCRenderer_DispatchCulling(void);
+#endif
+static void GCRenderer_DrawIndirectCommands(const GCRendererCullingFrame* const CullingFrame,
+                                            const uint32_t FirstCommand, const uint32_t CommandCount);
 static void GCRenderer_ResizeSwapChain(void);
 
 static GCRenderer* Renderer = NULL;
@@ -95,11 +185,20 @@ void GCRenderer_PreInitialize(void)
     CommandListDescription.SwapChain = Renderer->SwapChain;
     Renderer->CommandList = GCRendererCommandList_Create(&CommandListDescription);
 
-    GCRendererUniformBufferDescription UniformBufferDescription = {0};
-    UniformBufferDescription.Device = Renderer->Device;
-    UniformBufferDescription.CommandList = Renderer->CommandList;
-    UniformBufferDescription.DataSize = sizeof(GCRendererUniformBufferData);
-    Renderer->UniformBuffer = GCRendererUniformBuffer_Create(&UniformBufferDescription);
+    GCRendererGeometryPoolDescription GeometryPoolDescription = {0};
+    GeometryPoolDescription.Device = Renderer->Device;
+    GeometryPoolDescription.CommandList = Renderer->CommandList;
+    GeometryPoolDescription.VertexSize = sizeof(GCRendererVertex);
+    GeometryPoolDescription.VertexCapacity = GC_RENDERER_GEOMETRY_POOL_VERTEX_CAPACITY;
+    GeometryPoolDescription.IndexCapacity = GC_RENDERER_GEOMETRY_POOL_INDEX_CAPACITY;
+    Renderer->GeometryPool = GCRendererGeometryPool_Create(&GeometryPoolDescription);
+
+    GCRendererRingBufferDescription RingBufferDescription = {0};
+    RingBufferDescription.Device = Renderer->Device;
+    RingBufferDescription.CommandList = Renderer->CommandList;
+    RingBufferDescription.Flags = GCRendererRingBufferFlags_Uniform;
+    RingBufferDescription.FrameSize = GC_RENDERER_RING_BUFFER_FRAME_SIZE;
+    Renderer->RingBuffer = GCRendererRingBuffer_Create(&RingBufferDescription);
 
     GCRendererShaderDescription ShaderDescription = {0};
     ShaderDescription.Device = Renderer->Device;
@@ -107,6 +206,13 @@ void GCRenderer_PreInitialize(void)
     ShaderDescription.FragmentShaderPath = "Assets/Shaders/Basic/Basic.fragment.glsl";
     Renderer->BasicShader = GCRendererShader_Create(&ShaderDescription);
 
+#ifndef GC_RENDERER_CPU_CULLING
+    GCRendererShaderDescription CullingShaderDescription = {0};
+    CullingShaderDescription.Device = Renderer->Device;
+    CullingShaderDescription.ComputeShaderPath = "Assets/Shaders/Culling/Culling.compute.glsl";
+    Renderer->CullingShader = GCRendererShader_Create(&CullingShaderDescription);
+#endif
+
     Renderer->Texture2Ds = NULL;
     Renderer->Texture2DCount = 0;
 
@@ -115,22 +221,29 @@ void GCRenderer_PreInitialize(void)
 
 void GCRenderer_Initialize(void)
 {
-    GCRendererGraphicsPipelineAttachment GraphicsPipelineAttachments[3] = {0};
+    GCRendererGraphicsPipelineAttachment GraphicsPipelineAttachments[GC_RENDERER_ATTACHMENT_COUNT] = {0};
     GraphicsPipelineAttachments[0].Type = GCRendererAttachmentType_Color;
     GraphicsPipelineAttachments[0].Format = GCRendererAttachmentFormat_SRGB;
     GraphicsPipelineAttachments[0].SampleCount = GCRendererAttachmentSampleCount_2;
+#ifndef GC_RENDERER_CPU_PICKING
     GraphicsPipelineAttachments[1].Type = GCRendererAttachmentType_Color;
     GraphicsPipelineAttachments[1].Format = GCRendererAttachmentFormat_Integer;
     GraphicsPipelineAttachments[1].SampleCount = GCRendererAttachmentSampleCount_2;
-    GraphicsPipelineAttachments[2].Type = GCRendererAttachmentType_DepthStencil;
-    GraphicsPipelineAttachments[2].Format = GCRendererAttachmentFormat_D32;
-    GraphicsPipelineAttachments[2].SampleCount = GCRendererAttachmentSampleCount_2;
+#endif
+    GraphicsPipelineAttachments[GC_RENDERER_ATTACHMENT_COUNT - 1].Type = GCRendererAttachmentType_DepthStencil;
+    GraphicsPipelineAttachments[GC_RENDERER_ATTACHMENT_COUNT - 1].Format = GCRendererAttachmentFormat_D32;
+    GraphicsPipelineAttachments[GC_RENDERER_ATTACHMENT_COUNT - 1].SampleCount = GCRendererAttachmentSampleCount_2;
 
-    GCRendererGraphicsPipelineVertexInputBinding GraphicsPipelineVertexInputBindings[1] = {0};
+    GCRendererGraphicsPipelineVertexInputBinding GraphicsPipelineVertexInputBindings[2] = {0};
     GraphicsPipelineVertexInputBindings[0].Binding = 0;
     GraphicsPipelineVertexInputBindings[0].Stride = sizeof(GCRendererVertex);
+    GraphicsPipelineVertexInputBindings[0].InputRate = GCRendererGraphicsPipelineVertexInputRate_Vertex;
 
-    GCRendererGraphicsPipelineVertexInputAttribute GraphicsPipelineVertexInputAttributes[5] = {0};
+    GraphicsPipelineVertexInputBindings[1].Binding = 1;
+    GraphicsPipelineVertexInputBindings[1].Stride = sizeof(GCRendererInstanceData);
+    GraphicsPipelineVertexInputBindings[1].InputRate = GCRendererGraphicsPipelineVertexInputRate_Instance;
+
+    GCRendererGraphicsPipelineVertexInputAttribute GraphicsPipelineVertexInputAttributes[9] = {0};
     GraphicsPipelineVertexInputAttributes[0].Location = 0;
     GraphicsPipelineVertexInputAttributes[0].Format = GCRendererGraphicsPipelineVertexInputAttributeFormat_Vector3;
     GraphicsPipelineVertexInputAttributes[0].Offset = offsetof(GCRendererVertex, Position);
@@ -147,9 +260,20 @@ void GCRenderer_Initialize(void)
     GraphicsPipelineVertexInputAttributes[3].Format = GCRendererGraphicsPipelineVertexInputAttributeFormat_Vector2;
     GraphicsPipelineVertexInputAttributes[3].Offset = offsetof(GCRendererVertex, TextureCoordinate);
 
+    GraphicsPipelineVertexInputAttributes[4].Binding = 1;
     GraphicsPipelineVertexInputAttributes[4].Location = 4;
     GraphicsPipelineVertexInputAttributes[4].Format = GCRendererGraphicsPipelineVertexInputAttributeFormat_Integer;
-    GraphicsPipelineVertexInputAttributes[4].Offset = offsetof(GCRendererVertex, EntityID);
+    GraphicsPipelineVertexInputAttributes[4].Offset = offsetof(GCRendererInstanceData, EntityID);
+
+    for (uint32_t Counter = 0; Counter < 4; Counter++)
+    {
+        GraphicsPipelineVertexInputAttributes[Counter + 5].Binding = 1;
+        GraphicsPipelineVertexInputAttributes[Counter + 5].Location = Counter + 5;
+        GraphicsPipelineVertexInputAttributes[Counter + 5].Format =
+            GCRendererGraphicsPipelineVertexInputAttributeFormat_Vector4;
+        GraphicsPipelineVertexInputAttributes[Counter + 5].Offset =
+            offsetof(GCRendererInstanceData, Transform) + Counter * sizeof(GCVector4);
+    }
 
     GCRendererGraphicsPipelineVertexInput GraphicsPipelineVertexInput = {0};
     GraphicsPipelineVertexInput.Bindings = GraphicsPipelineVertexInputBindings;
@@ -164,30 +288,43 @@ void GCRenderer_Initialize(void)
     GraphicsPipelineDescription.SwapChain = Renderer->SwapChain;
     GraphicsPipelineDescription.CommandList = Renderer->CommandList;
     GraphicsPipelineDescription.Attachments = GraphicsPipelineAttachments;
-    GraphicsPipelineDescription.AttachmentCount = 3;
+    GraphicsPipelineDescription.AttachmentCount = GC_RENDERER_ATTACHMENT_COUNT;
     GraphicsPipelineDescription.VertexInput = &GraphicsPipelineVertexInput;
     GraphicsPipelineDescription.SampleCount = GCRendererAttachmentSampleCount_2;
-    GraphicsPipelineDescription.UniformBuffer = Renderer->UniformBuffer;
-    GraphicsPipelineDescription.Texture2Ds = Renderer->Texture2Ds;
+    GraphicsPipelineDescription.UniformRingBuffer = Renderer->RingBuffer;
+    GraphicsPipelineDescription.UniformDataSize = sizeof(GCRendererUniformBufferData);
+    GraphicsPipelineDescription.Texture2Ds = (const GCRendererTexture2D* const*)Renderer->Texture2Ds;
     GraphicsPipelineDescription.Texture2DCount = Renderer->Texture2DCount;
     GraphicsPipelineDescription.Shader = Renderer->BasicShader;
     Renderer->GraphicsPipeline = GCRendererGraphicsPipeline_Create(&GraphicsPipelineDescription);
 
-    GCRendererFramebufferAttachment FramebufferAttachments[3] = {0};
+#ifndef GC_RENDERER_CPU_CULLING
+    GCRendererComputePipelineDescription CullingPipelineDescription = {0};
+    CullingPipelineDescription.Device = Renderer->Device;
+    CullingPipelineDescription.CommandList = Renderer->CommandList;
+    CullingPipelineDescription.StorageBufferCount = 3;
+    CullingPipelineDescription.PushConstantSize = sizeof(GCRendererCullingPushConstantData);
+    CullingPipelineDescription.Shader = Renderer->CullingShader;
+    Renderer->CullingPipeline = GCRendererComputePipeline_Create(&CullingPipelineDescription);
+#endif
+
+    GCRendererFramebufferAttachment FramebufferAttachments[GC_RENDERER_ATTACHMENT_COUNT] = {0};
     FramebufferAttachments[0].Type = GCRendererAttachmentType_Color;
     FramebufferAttachments[0].Flags = GCRendererFramebufferAttachmentFlags_Sampled;
     FramebufferAttachments[0].Format = GCRendererAttachmentFormat_SRGB;
     FramebufferAttachments[0].SampleCount = GCRendererAttachmentSampleCount_2;
 
+#ifndef GC_RENDERER_CPU_PICKING
     FramebufferAttachments[1].Type = GCRendererAttachmentType_Color;
     FramebufferAttachments[1].Flags = GCRendererFramebufferAttachmentFlags_None;
     FramebufferAttachments[1].Format = GCRendererAttachmentFormat_Integer;
     FramebufferAttachments[1].SampleCount = GCRendererAttachmentSampleCount_2;
 
-    FramebufferAttachments[2].Type = GCRendererAttachmentType_DepthStencil;
-    FramebufferAttachments[2].Flags = GCRendererFramebufferAttachmentFlags_None;
-    FramebufferAttachments[2].Format = GCRendererAttachmentFormat_D32;
-    FramebufferAttachments[2].SampleCount = GCRendererAttachmentSampleCount_2;
+#endif
+    FramebufferAttachments[GC_RENDERER_ATTACHMENT_COUNT - 1].Type = GCRendererAttachmentType_DepthStencil;
+    FramebufferAttachments[GC_RENDERER_ATTACHMENT_COUNT - 1].Flags = GCRendererFramebufferAttachmentFlags_None;
+    FramebufferAttachments[GC_RENDERER_ATTACHMENT_COUNT - 1].Format = GCRendererAttachmentFormat_D32;
+    FramebufferAttachments[GC_RENDERER_ATTACHMENT_COUNT - 1].SampleCount = GCRendererAttachmentSampleCount_2;
 
     uint32_t WindowWidth = 0, WindowHeight = 0;
     GCWindow_GetWindowSize(GCApplication_GetWindow(), &WindowWidth, &WindowHeight);
@@ -195,17 +332,33 @@ void GCRenderer_Initialize(void)
     GCRendererFramebufferDescription FramebufferDescription = {0};
     FramebufferDescription.Device = Renderer->Device;
     FramebufferDescription.SwapChain = Renderer->SwapChain;
+    FramebufferDescription.CommandList = Renderer->CommandList;
     FramebufferDescription.GraphicsPipeline = Renderer->GraphicsPipeline;
     FramebufferDescription.Width = WindowWidth;
     FramebufferDescription.Height = WindowHeight;
     FramebufferDescription.Attachments = FramebufferAttachments;
-    FramebufferDescription.AttachmentCount = 3;
+    FramebufferDescription.AttachmentCount = GC_RENDERER_ATTACHMENT_COUNT;
     Renderer->Framebuffer = GCRendererFramebuffer_Create(&FramebufferDescription);
 
+    Renderer->FrameAllocator = GCFrameAllocator_GetThreadAllocator();
+    Renderer->FrameAllocationCount = GCMemory_GetAllocationCount();
+    Renderer->HeapAllocationCount = 0;
+
     Renderer->MaximumDrawDataCount = 100;
-    Renderer->DrawData =
-        (GCRendererDrawData*)GCMemory_Allocate(Renderer->MaximumDrawDataCount * sizeof(GCRendererDrawData));
+    Renderer->DrawData = NULL;
+    Renderer->DrawKeys = NULL;
+    Renderer->SortedDrawKeys = NULL;
     Renderer->DrawDataCount = 0;
+
+    Renderer->ViewProjectionMatrix = GCMatrix4x4_CreateIdentity();
+    Renderer->UniformOffset = 0;
+    Renderer->CameraPosition = GCVector3_CreateZero();
+    Renderer->ProjectionScale = 1.0f;
+    memset(&Renderer->Statistics, 0, sizeof(GCRendererStatistics));
+
+    Renderer->FrameCount = GCRendererCommandList_GetMaximumFramesInFlight(Renderer->CommandList);
+    Renderer->CullingFrames =
+        (GCRendererCullingFrame*)GCMemory_AllocateZero(Renderer->FrameCount * sizeof(GCRendererCullingFrame));
 }
 
 void GCRenderer_SetTexture2Ds(GCRendererTexture2D** const Texture2Ds, const uint32_t Texture2DCount)
@@ -217,73 +370,105 @@ void GCRenderer_SetTexture2Ds(GCRendererTexture2D** const Texture2Ds, const uint
 
 void GCRenderer_BeginWorld(const GCWorldCamera* const WorldCamera)
 {
+    const uint64_t AllocationCount = GCMemory_GetAllocationCount();
+    Renderer->HeapAllocationCount = AllocationCount - Renderer->FrameAllocationCount;
+    Renderer->FrameAllocationCount = AllocationCount;
+
+    GCFrameAllocator_Reset(Renderer->FrameAllocator);
+
+    Renderer->DrawData = NULL;
+    Renderer->DrawKeys = NULL;
+    Renderer->SortedDrawKeys = NULL;
     Renderer->DrawDataCount = 0;
 
+    GCRenderer_AllocateDrawData(0);
+
     GCRendererCommandList_BeginRecord(Renderer->CommandList);
+    GCRendererRingBuffer_BeginFrame(Renderer->RingBuffer);
+    GCRendererGeometryPool_BeginFrame(Renderer->GeometryPool);
 
-    const float ClearColorTexture[4] = {0.729f, 0.901f, 0.992f, 1.0f};
-    GCRendererCommandList_BeginAttachmentRenderPass(Renderer->CommandList, Renderer->GraphicsPipeline,
-                                                    Renderer->Framebuffer, ClearColorTexture);
+    Renderer->ViewProjectionMatrix = GCWorldCamera_GetViewProjectionMatrix(WorldCamera);
+    Renderer->CameraPosition = GCWorldCamera_GetPosition(WorldCamera);
+    Renderer->ProjectionScale = GCWorldCamera_GetProjectionMatrix(WorldCamera)->Data[1][1];
 
-    GCRendererUniformBufferData UniformBufferData = {0};
-    UniformBufferData.ViewProjectionMatrix = GCWorldCamera_GetViewProjectionMatrix(WorldCamera);
+    const GCRendererRingBufferAllocation UniformAllocation =
+        GCRendererRingBuffer_Allocate(Renderer->RingBuffer, sizeof(GCRendererUniformBufferData));
+    Renderer->UniformOffset = UniformAllocation.Offset;
 
-    GCRendererUniformBuffer_UpdateUniformBuffer(Renderer->UniformBuffer, &UniformBufferData,
-                                                sizeof(GCRendererUniformBufferData));
-    GCRendererCommandList_BindGraphicsPipeline(Renderer->CommandList, Renderer->GraphicsPipeline);
-    GCRendererCommandList_SetViewport(Renderer->CommandList, Renderer->Framebuffer);
+    GCRendererUniformBufferData* const UniformBufferData = (GCRendererUniformBufferData*)UniformAllocation.Data;
+    UniformBufferData->ViewProjectionMatrix = Renderer->ViewProjectionMatrix;
 }
 
-void GCRenderer_RenderEntity(const GCEntity Entity)
+void GCRenderer_RenderEntity(const GCEntity Entity, const GCMatrix4x4* const Transform,
+                             GCMeshComponent* const MeshComponent)
 {
-    const GCTransformComponent* const TransformComponent = GCEntity_GetTransformComponent(Entity);
-    const GCMeshComponent* const MeshComponent = GCEntity_GetMeshComponent(Entity);
-
-    const GCMatrix4x4 Transform = GCTransformComponent_GetTransform(TransformComponent);
     GCRendererMesh* const Mesh = MeshComponent->Mesh;
 
-    if (Renderer->DrawDataCount >= Renderer->MaximumDrawDataCount)
-    {
-        Renderer->MaximumDrawDataCount += Renderer->MaximumDrawDataCount;
-        Renderer->DrawData = (GCRendererDrawData*)GCMemory_Reallocate(
-            Renderer->DrawData, Renderer->MaximumDrawDataCount * sizeof(GCRendererDrawData));
-    }
-
-    const GCRendererVertex* const OriginalVertices =
-        (const GCRendererVertex* const)GCRendererVertexBuffer_GetVertices(Mesh->VertexBuffer);
-    const uint32_t VertexCount = GCRendererVertexBuffer_GetVertexCount(Mesh->VertexBuffer);
+    const GCBoundingSphere BoundingSphere = GCBoundingSphere_Transform(&Mesh->Model->BoundingSphere, Transform);
 
-    GCRendererVertex* Vertices = (GCRendererVertex*)GCMemory_Allocate(VertexCount * sizeof(GCRendererVertex));
-    memcpy(Vertices, OriginalVertices, VertexCount * sizeof(GCRendererVertex));
+    MeshComponent->LODIndex = GCRenderer_SelectLOD(Mesh->Model, &BoundingSphere, MeshComponent->LODIndex);
+    const GCRendererModelLOD* const LOD = &Mesh->Model->LODs[MeshComponent->LODIndex];
 
-    for (uint32_t Counter = 0; Counter < VertexCount; Counter++)
+    if (Renderer->DrawDataCount >= Renderer->MaximumDrawDataCount)
     {
-        const GCVector3 Position = Vertices[Counter].Position;
-        const GCVector4 TransformVector =
-            GCMatrix4x4_MultiplyByVector(&Transform, GCVector4_Create(Position.X, Position.Y, Position.Z, 1.0f));
+        const uint32_t PreviousCount = Renderer->MaximumDrawDataCount;
+        Renderer->MaximumDrawDataCount += Renderer->MaximumDrawDataCount;
 
-        Vertices[Counter].Position = GCVector3_Create(TransformVector.X, TransformVector.Y, TransformVector.Z);
+        GCRenderer_AllocateDrawData(PreviousCount);
     }
 
-    GCRendererVertexBuffer_SetVertices(Mesh->VertexBuffer, Vertices, VertexCount * sizeof(GCRendererVertex));
+    const float Depth = GCVector3_Magnitude(GCVector3_Subtract(BoundingSphere.Center, Renderer->CameraPosition));
 
-    GCMemory_Free(Vertices);
+    Renderer->DrawKeys[Renderer->DrawDataCount].SortKey =
+        GCRenderer_CreateSortKey(Mesh->ID * GC_RENDERER_MODEL_MAXIMUM_LOD_COUNT + MeshComponent->LODIndex, Depth);
+    Renderer->DrawKeys[Renderer->DrawDataCount].DrawDataIndex = Renderer->DrawDataCount;
 
-    Renderer->DrawData[Renderer->DrawDataCount].VertexBuffer = Mesh->VertexBuffer;
-    Renderer->DrawData[Renderer->DrawDataCount].VertexCount = GCRendererVertexBuffer_GetVertexCount(Mesh->VertexBuffer);
-    Renderer->DrawData[Renderer->DrawDataCount].IndexBuffer = Mesh->IndexBuffer;
-    Renderer->DrawData[Renderer->DrawDataCount].IndexCount = GCRendererIndexBuffer_GetIndexCount(Mesh->IndexBuffer);
+    Renderer->DrawData[Renderer->DrawDataCount].Geometry = Mesh->Geometry;
+    Renderer->DrawData[Renderer->DrawDataCount].Geometry.FirstIndex += LOD->FirstIndex;
+    Renderer->DrawData[Renderer->DrawDataCount].Geometry.IndexCount = LOD->IndexCount;
+    Renderer->DrawData[Renderer->DrawDataCount].Transform = *Transform;
+    Renderer->DrawData[Renderer->DrawDataCount].BoundingSphere = BoundingSphere;
+    Renderer->DrawData[Renderer->DrawDataCount].Entity = Entity;
 
     Renderer->DrawDataCount++;
 }
 
 void GCRenderer_EndWorld(void)
 {
-    for (uint32_t Counter = 0; Counter < Renderer->DrawDataCount; Counter++)
+    memset(&Renderer->Statistics, 0, sizeof(GCRendererStatistics));
+    Renderer->Statistics.HeapAllocationCount = (uint32_t)Renderer->HeapAllocationCount;
+
+    GCRenderer_UpdateCullingStatistics();
+
+    const GCRendererCullingFrame* const CullingFrame =
+        &Renderer->CullingFrames[GCRendererCommandList_GetCurrentFrame(Renderer->CommandList)];
+
+    if (Renderer->DrawDataCount)
     {
-        GCRendererCommandList_BindVertexBuffer(Renderer->CommandList, Renderer->DrawData[Counter].VertexBuffer);
-        GCRendererCommandList_BindIndexBuffer(Renderer->CommandList, Renderer->DrawData[Counter].IndexBuffer);
-        GCRendererCommandList_DrawIndexed(Renderer->CommandList, Renderer->DrawData[Counter].IndexCount, 0);
+        GCRenderer_SortDrawKeys();
+        GCRenderer_UpdateCullingBuffers();
+#ifdef GC_RENDERER_CPU_CULLING
+        GCRenderer_CullInstances();
+#else
+        GCRenderer_DispatchCulling();
+#endif
+    }
+
+    const float ClearColorTexture[4] = {0.729f, 0.901f, 0.992f, 1.0f};
+    GCRendererCommandList_BeginAttachmentRenderPass(Renderer->CommandList, Renderer->GraphicsPipeline,
+                                                    Renderer->Framebuffer, ClearColorTexture);
+    GCRendererCommandList_SetViewport(Renderer->CommandList, Renderer->Framebuffer);
+
+    if (Renderer->DrawDataCount)
+    {
+        GCRendererCommandList_BindGeometryPool(Renderer->CommandList, Renderer->GeometryPool);
+        GCRendererCommandList_BindInstanceStorageBuffer(Renderer->CommandList, CullingFrame->OutputInstanceBuffer);
+        GCRendererCommandList_BindGraphicsPipeline(Renderer->CommandList, Renderer->GraphicsPipeline,
+                                                   Renderer->UniformOffset);
+
+        Renderer->Statistics.BindCount += 3;
+
+        GCRenderer_DrawIndirectCommands(CullingFrame, 0, CullingFrame->IndirectCommandCount);
     }
 
     GCRendererCommandList_EndAttachmentRenderPass(Renderer->CommandList, Renderer->Framebuffer);
@@ -318,49 +503,365 @@ void GCRenderer_Resize(void)
 void GCRenderer_Terminate(void)
 {
     GCRendererFramebuffer_Destroy(Renderer->Framebuffer);
+#ifndef GC_RENDERER_CPU_CULLING
+    GCRendererComputePipeline_Destroy(Renderer->CullingPipeline);
+#endif
     GCRendererGraphicsPipeline_Destroy(Renderer->GraphicsPipeline);
 
+    for (uint32_t Counter = 0; Counter < Renderer->FrameCount; Counter++)
+    {
+        if (Renderer->CullingFrames[Counter].Capacity)
+        {
+            GCRendererStorageBuffer_Destroy(Renderer->CullingFrames[Counter].IndirectCommandBuffer);
+            GCRendererStorageBuffer_Destroy(Renderer->CullingFrames[Counter].OutputInstanceBuffer);
+            GCRendererStorageBuffer_Destroy(Renderer->CullingFrames[Counter].InputInstanceBuffer);
+        }
+    }
+
     for (uint32_t Counter = 0; Counter < Renderer->Texture2DCount; Counter++)
     {
         GCRendererTexture2D_Destroy(Renderer->Texture2Ds[Counter]);
     }
 
+#ifndef GC_RENDERER_CPU_CULLING
+    GCRendererShader_Destroy(Renderer->CullingShader);
+#endif
     GCRendererShader_Destroy(Renderer->BasicShader);
-    GCRendererUniformBuffer_Destroy(Renderer->UniformBuffer);
+    GCRendererRingBuffer_Destroy(Renderer->RingBuffer);
+    GCRendererGeometryPool_Destroy(Renderer->GeometryPool);
     GCRendererCommandList_Destroy(Renderer->CommandList);
     GCRendererSwapChain_Destroy(Renderer->SwapChain);
     GCRendererDevice_Destroy(Renderer->Device);
 
-    GCMemory_Free(Renderer->DrawData);
+    GCMemory_Free(Renderer->CullingFrames);
     GCMemory_Free(Renderer->Texture2Ds);
     GCMemory_Free(Renderer);
 }
 
-GCRendererDevice* const GCRenderer_GetDevice(void)
+GCRendererDevice* GCRenderer_GetDevice(void)
 {
     return Renderer->Device;
 }
 
-GCRendererSwapChain* const GCRenderer_GetSwapChain(void)
+GCRendererSwapChain* GCRenderer_GetSwapChain(void)
 {
     return Renderer->SwapChain;
 }
 
-GCRendererCommandList* const GCRenderer_GetCommandList(void)
+GCRendererCommandList* GCRenderer_GetCommandList(void)
 {
     return Renderer->CommandList;
 }
 
-GCRendererGraphicsPipeline* const GCRenderer_GetGraphicsPipeline(void)
+GCRendererGeometryPool* GCRenderer_GetGeometryPool(void)
+{
+    return Renderer->GeometryPool;
+}
+
+GCRendererGraphicsPipeline* GCRenderer_GetGraphicsPipeline(void)
 {
     return Renderer->GraphicsPipeline;
 }
 
-GCRendererFramebuffer* const GCRenderer_GetFramebuffer(void)
+GCRendererFramebuffer* GCRenderer_GetFramebuffer(void)
 {
     return Renderer->Framebuffer;
 }
 
+GCRendererStatistics GCRenderer_GetStatistics(void)
+{
+    return Renderer->Statistics;
+}
+
+uint64_t GCRenderer_CreateSortKey(const uint32_t MeshID, const float Depth)
+{
+    uint32_t DepthBits = 0;
+
+    if (Depth > 0.0f)
+    {
+        memcpy(&DepthBits, &Depth, sizeof(uint32_t));
+    }
+
+    return (((uint64_t)MeshID & GC_RENDERER_SORT_KEY_MESH_MASK) << GC_RENDERER_SORT_KEY_MESH_SHIFT) |
+           ((uint64_t)(DepthBits >> 8) & GC_RENDERER_SORT_KEY_DEPTH_MASK);
+}
+
+uint32_t GCRenderer_SelectLOD(const GCRendererModel* const Model, const GCBoundingSphere* const BoundingSphere,
+                              const uint32_t CurrentLODIndex)
+{
+    const float LODScreenSizes[GC_RENDERER_MODEL_MAXIMUM_LOD_COUNT - 1] = {0.25f, 0.1f, 0.04f};
+
+    const float Distance = GCVector3_Magnitude(GCVector3_Subtract(BoundingSphere->Center, Renderer->CameraPosition));
+
+    if (Distance <= BoundingSphere->Radius)
+    {
+        return 0;
+    }
+
+    const float ScreenSize = BoundingSphere->Radius * Renderer->ProjectionScale / Distance;
+
+    uint32_t LODIndex = CurrentLODIndex < Model->LODCount ? CurrentLODIndex : Model->LODCount - 1;
+
+    while (LODIndex + 1 < Model->LODCount &&
+           ScreenSize < LODScreenSizes[LODIndex] * (1.0f - GC_RENDERER_LOD_HYSTERESIS))
+    {
+        LODIndex++;
+    }
+
+    while (LODIndex > 0 && ScreenSize > LODScreenSizes[LODIndex - 1] * (1.0f + GC_RENDERER_LOD_HYSTERESIS))
+    {
+        LODIndex--;
+    }
+
+    return LODIndex;
+}
+
+void GCRenderer_AllocateDrawData(const uint32_t PreviousCount)
+{
+    const uint32_t Count = Renderer->MaximumDrawDataCount;
+
+    Renderer->DrawData = (GCRendererDrawData*)GCFrameAllocator_Reallocate(
+        Renderer->FrameAllocator, Renderer->DrawData, PreviousCount * sizeof(GCRendererDrawData),
+        Count * sizeof(GCRendererDrawData));
+    Renderer->DrawKeys = (GCRendererDrawKey*)GCFrameAllocator_Reallocate(
+        Renderer->FrameAllocator, Renderer->DrawKeys, PreviousCount * sizeof(GCRendererDrawKey),
+        Count * sizeof(GCRendererDrawKey));
+    Renderer->SortedDrawKeys =
+        (GCRendererDrawKey*)GCFrameAllocator_Allocate(Renderer->FrameAllocator, Count * sizeof(GCRendererDrawKey));
+}
+
+void GCRenderer_UpdateCullingStatistics(void)
+{
+    GCRendererCullingFrame* const CullingFrame =
+        &Renderer->CullingFrames[GCRendererCommandList_GetCurrentFrame(Renderer->CommandList)];
+
+    if (!CullingFrame->Capacity)
+    {
+        return;
+    }
+
+    const GCRendererDrawIndexedIndirectCommand* const IndirectCommands =
+        (const GCRendererDrawIndexedIndirectCommand*)GCRendererStorageBuffer_GetData(
+            CullingFrame->IndirectCommandBuffer);
+
+    for (uint32_t Counter = 0; Counter < CullingFrame->IndirectCommandCount; Counter++)
+    {
+        Renderer->Statistics.VisibleEntityCount += IndirectCommands[Counter].InstanceCount;
+    }
+
+    Renderer->Statistics.CulledEntityCount = CullingFrame->InstanceCount - Renderer->Statistics.VisibleEntityCount;
+
+    CullingFrame->InstanceCount = 0;
+    CullingFrame->IndirectCommandCount = 0;
+}
+
+void GCRenderer_SortDrawKeys(void)
+{
+    GCRendererDrawKey* Keys = Renderer->DrawKeys;
+    GCRendererDrawKey* SortedKeys = Renderer->SortedDrawKeys;
+
+    for (uint32_t Shift = 0; Shift < 64; Shift += 8)
+    {
+        uint32_t Offsets[256] = {0};
+
+        for (uint32_t Counter = 0; Counter < Renderer->DrawDataCount; Counter++)
+        {
+            Offsets[(Keys[Counter].SortKey >> Shift) & 0xFF]++;
+        }
+
+        if (Offsets[(Keys[0].SortKey >> Shift) & 0xFF] == Renderer->DrawDataCount)
+        {
+            continue;
+        }
+
+        uint32_t Offset = 0;
+
+        for (uint32_t Counter = 0; Counter < 256; Counter++)
+        {
+            const uint32_t Count = Offsets[Counter];
+            Offsets[Counter] = Offset;
+            Offset += Count;
+        }
+
+        for (uint32_t Counter = 0; Counter < Renderer->DrawDataCount; Counter++)
+        {
+            SortedKeys[Offsets[(Keys[Counter].SortKey >> Shift) & 0xFF]++] = Keys[Counter];
+        }
+
+        GCRendererDrawKey* const TemporaryKeys = Keys;
+        Keys = SortedKeys;
+        SortedKeys = TemporaryKeys;
+    }
+
+    Renderer->DrawKeys = Keys;
+    Renderer->SortedDrawKeys = SortedKeys;
+}
+
+void GCRenderer_UpdateCullingBuffers(void)
+{
+    GCRendererCullingFrame* const CullingFrame =
+        &Renderer->CullingFrames[GCRendererCommandList_GetCurrentFrame(Renderer->CommandList)];
+
+    if (CullingFrame->Capacity < Renderer->DrawDataCount)
+    {
+        if (CullingFrame->Capacity)
+        {
+            GCRendererStorageBuffer_Destroy(CullingFrame->IndirectCommandBuffer);
+            GCRendererStorageBuffer_Destroy(CullingFrame->OutputInstanceBuffer);
+            GCRendererStorageBuffer_Destroy(CullingFrame->InputInstanceBuffer);
+        }
+
+        CullingFrame->Capacity = Renderer->MaximumDrawDataCount;
+
+        GCRendererStorageBufferDescription StorageBufferDescription = {0};
+        StorageBufferDescription.Device = Renderer->Device;
+        StorageBufferDescription.CommandList = Renderer->CommandList;
+
+        StorageBufferDescription.Flags = GCRendererStorageBufferFlags_HostVisible;
+        StorageBufferDescription.DataSize = CullingFrame->Capacity * sizeof(GCRendererCullingInstanceData);
+        CullingFrame->InputInstanceBuffer = GCRendererStorageBuffer_Create(&StorageBufferDescription);
+
+#ifdef GC_RENDERER_CPU_CULLING
+        StorageBufferDescription.Flags = GCRendererStorageBufferFlags_HostVisible | GCRendererStorageBufferFlags_Vertex;
+#else
+        StorageBufferDescription.Flags = GCRendererStorageBufferFlags_Vertex;
+#endif
+        StorageBufferDescription.DataSize = CullingFrame->Capacity * sizeof(GCRendererInstanceData);
+        CullingFrame->OutputInstanceBuffer = GCRendererStorageBuffer_Create(&StorageBufferDescription);
+
+        StorageBufferDescription.Flags =
+            GCRendererStorageBufferFlags_HostVisible | GCRendererStorageBufferFlags_Indirect;
+        StorageBufferDescription.DataSize = CullingFrame->Capacity * sizeof(GCRendererDrawIndexedIndirectCommand);
+        CullingFrame->IndirectCommandBuffer = GCRendererStorageBuffer_Create(&StorageBufferDescription);
+
+#ifndef GC_RENDERER_CPU_CULLING
+        GCRendererComputePipeline_SetStorageBuffer(Renderer->CullingPipeline, 0, CullingFrame->InputInstanceBuffer);
+        GCRendererComputePipeline_SetStorageBuffer(Renderer->CullingPipeline, 1, CullingFrame->OutputInstanceBuffer);
+        GCRendererComputePipeline_SetStorageBuffer(Renderer->CullingPipeline, 2, CullingFrame->IndirectCommandBuffer);
+#endif
+    }
+
+    GCRendererCullingInstanceData* const InstanceData =
+        (GCRendererCullingInstanceData*)GCRendererStorageBuffer_GetData(CullingFrame->InputInstanceBuffer);
+    GCRendererDrawIndexedIndirectCommand* const IndirectCommands =
+        (GCRendererDrawIndexedIndirectCommand*)GCRendererStorageBuffer_GetData(CullingFrame->IndirectCommandBuffer);
+
+    const uint64_t BatchMask = ~GC_RENDERER_SORT_KEY_DEPTH_MASK;
+
+    uint64_t BatchKey = 0;
+    uint32_t BatchCount = 0;
+
+    for (uint32_t Counter = 0; Counter < Renderer->DrawDataCount; Counter++)
+    {
+        const uint32_t DrawDataIndex = Renderer->DrawKeys[Counter].DrawDataIndex;
+        const GCRendererDrawData* const DrawData = &Renderer->DrawData[DrawDataIndex];
+
+        if (!BatchCount || (Renderer->DrawKeys[Counter].SortKey & BatchMask) != BatchKey)
+        {
+            BatchKey = Renderer->DrawKeys[Counter].SortKey & BatchMask;
+
+            IndirectCommands[BatchCount].IndexCount = DrawData->Geometry.IndexCount;
+            IndirectCommands[BatchCount].InstanceCount = 0;
+            IndirectCommands[BatchCount].FirstIndex = DrawData->Geometry.FirstIndex;
+            IndirectCommands[BatchCount].VertexOffset = DrawData->Geometry.VertexOffset;
+            IndirectCommands[BatchCount].FirstInstance = Counter;
+            BatchCount++;
+        }
+
+        InstanceData[Counter].Transform = DrawData->Transform;
+        InstanceData[Counter].BoundingSphere =
+            GCVector4_Create(DrawData->BoundingSphere.Center.X, DrawData->BoundingSphere.Center.Y,
+                             DrawData->BoundingSphere.Center.Z, DrawData->BoundingSphere.Radius);
+        InstanceData[Counter].EntityID = (uint32_t)DrawData->Entity;
+        InstanceData[Counter].BatchIndex = BatchCount - 1;
+    }
+
+    CullingFrame->InstanceCount = Renderer->DrawDataCount;
+    CullingFrame->IndirectCommandCount = BatchCount;
+}
+
+#ifdef GC_RENDERER_CPU_CULLING
+void GCRenderer_CullInstances(void)
+{
+    const GCRendererCullingFrame* const CullingFrame =
+        &Renderer->CullingFrames[GCRendererCommandList_GetCurrentFrame(Renderer->CommandList)];
+
+    const GCRendererCullingInstanceData* const InputInstanceData =
+        (const GCRendererCullingInstanceData*)GCRendererStorageBuffer_GetData(CullingFrame->InputInstanceBuffer);
+    GCRendererInstanceData* const OutputInstanceData =
+        (GCRendererInstanceData*)GCRendererStorageBuffer_GetData(CullingFrame->OutputInstanceBuffer);
+    GCRendererDrawIndexedIndirectCommand* const IndirectCommands =
+        (GCRendererDrawIndexedIndirectCommand*)GCRendererStorageBuffer_GetData(CullingFrame->IndirectCommandBuffer);
+
+    const uint32_t InstanceCount = Renderer->DrawDataCount;
+
+    float* const CentersX = (float*)GCFrameAllocator_Allocate(Renderer->FrameAllocator, InstanceCount * sizeof(float));
+    float* const CentersY = (float*)GCFrameAllocator_Allocate(Renderer->FrameAllocator, InstanceCount * sizeof(float));
+    float* const CentersZ = (float*)GCFrameAllocator_Allocate(Renderer->FrameAllocator, InstanceCount * sizeof(float));
+    float* const Radii = (float*)GCFrameAllocator_Allocate(Renderer->FrameAllocator, InstanceCount * sizeof(float));
+    uint8_t* const Visibilities =
+        (uint8_t*)GCFrameAllocator_Allocate(Renderer->FrameAllocator, InstanceCount * sizeof(uint8_t));
+
+    for (uint32_t Counter = 0; Counter < InstanceCount; Counter++)
+    {
+        CentersX[Counter] = InputInstanceData[Counter].BoundingSphere.X;
+        CentersY[Counter] = InputInstanceData[Counter].BoundingSphere.Y;
+        CentersZ[Counter] = InputInstanceData[Counter].BoundingSphere.Z;
+        Radii[Counter] = InputInstanceData[Counter].BoundingSphere.W;
+    }
+
+    const GCFrustum Frustum = GCFrustum_CreateFromMatrix(&Renderer->ViewProjectionMatrix);
+    GCFrustum_CullSpheres(&Frustum, CentersX, CentersY, CentersZ, Radii, InstanceCount, Visibilities);
+
+    for (uint32_t Counter = 0; Counter < InstanceCount; Counter++)
+    {
+        if (!Visibilities[Counter])
+        {
+            continue;
+        }
+
+        GCRendererDrawIndexedIndirectCommand* const IndirectCommand =
+            &IndirectCommands[InputInstanceData[Counter].BatchIndex];
+        const uint32_t OutputIndex = IndirectCommand->FirstInstance + IndirectCommand->InstanceCount++;
+
+        OutputInstanceData[OutputIndex].Transform = InputInstanceData[Counter].Transform;
+        OutputInstanceData[OutputIndex].EntityID = InputInstanceData[Counter].EntityID;
+    }
+}
+#else
+void GCRenderer_DispatchCulling(void)
+{
+    const GCFrustum Frustum = GCFrustum_CreateFromMatrix(&Renderer->ViewProjectionMatrix);
+
+    GCRendererCullingPushConstantData PushConstantData = {0};
+    memcpy(PushConstantData.FrustumPlanes, Frustum.Planes, sizeof(PushConstantData.FrustumPlanes));
+    PushConstantData.InstanceCount = Renderer->DrawDataCount;
+
+    GCRendererCommandList_BindComputePipeline(Renderer->CommandList, Renderer->CullingPipeline);
+    GCRendererCommandList_PushComputeConstants(Renderer->CommandList, Renderer->CullingPipeline, &PushConstantData,
+                                               sizeof(GCRendererCullingPushConstantData));
+    GCRendererCommandList_Dispatch(
+        Renderer->CommandList,
+        (Renderer->DrawDataCount + GC_RENDERER_CULLING_GROUP_SIZE - 1) / GC_RENDERER_CULLING_GROUP_SIZE, 1, 1);
+    GCRendererCommandList_ComputeToDrawBarrier(Renderer->CommandList);
+}
+#endif
+
+void GCRenderer_DrawIndirectCommands(const GCRendererCullingFrame* const CullingFrame, const uint32_t FirstCommand,
+                                     const uint32_t CommandCount)
+{
+    if (!CommandCount)
+    {
+        return;
+    }
+
+    GCRendererCommandList_DrawIndexedIndirect(Renderer->CommandList, CullingFrame->IndirectCommandBuffer, FirstCommand,
+                                              CommandCount);
+
+    Renderer->Statistics.DrawCallCount +=
+        GCRendererDevice_GetDeviceCapabilities(Renderer->Device).IsMultiDrawIndirectSupported ? 1 : CommandCount;
+}
+
 void GCRenderer_ResizeSwapChain(void)
 {
     uint32_t Width = 0, Height = 0;
@@ -18,6 +18,7 @@
 #ifndef GC_RENDERER_RENDERER_H
 #define GC_RENDERER_RENDERER_H
 
+#include "Math/Matrix4x4.h"
 #include "Math/Vector2.h"
 #include "Math/Vector3.h"
 #include "Math/Vector4.h"
@@ -36,7 +37,6 @@ extern "C"
         GCVector3 Normal;
         GCVector4 Color;
         GCVector2 TextureCoordinate;
-        uint64_t EntityID;
 
 #ifdef __cplusplus
         bool operator==(const GCRendererVertex& OtherVertex) const noexcept
@@ -48,11 +48,21 @@ extern "C"
 #endif
     } GCRendererVertex;
 
+    typedef struct GCRendererStatistics
+    {
+        uint32_t DrawCallCount;
+        uint32_t BindCount;
+        uint32_t VisibleEntityCount;
+        uint32_t CulledEntityCount;
+        uint32_t HeapAllocationCount;
+    } GCRendererStatistics;
+
     typedef struct GCWorldCamera GCWorldCamera;
     typedef struct GCRendererModel GCRendererModel;
     typedef struct GCRendererDevice GCRendererDevice;
     typedef struct GCRendererSwapChain GCRendererSwapChain;
     typedef struct GCRendererCommandList GCRendererCommandList;
+    typedef struct GCRendererGeometryPool GCRendererGeometryPool;
     typedef struct GCRendererTexture2D GCRendererTexture2D;
     typedef struct GCRendererGraphicsPipeline GCRendererGraphicsPipeline;
     typedef struct GCRendererFramebuffer GCRendererFramebuffer;
@@ -62,7 +72,8 @@ extern "C"
     void GCRenderer_SetTexture2Ds(GCRendererTexture2D** const Texture2Ds, const uint32_t Texture2DCount);
 
     void GCRenderer_BeginWorld(const GCWorldCamera* const WorldCamera);
-    void GCRenderer_RenderEntity(const GCEntity Entity);
+    void GCRenderer_RenderEntity(const GCEntity Entity, const GCMatrix4x4* const Transform,
+                                 GCMeshComponent* const MeshComponent);
     void GCRenderer_EndWorld(void);
     void GCRenderer_BeginImGui(void);
     void GCRenderer_EndImGui(void);
@@ -70,11 +81,13 @@ extern "C"
     void GCRenderer_Resize(void);
     void GCRenderer_Terminate(void);
 
-    GCRendererDevice* const GCRenderer_GetDevice(void);
-    GCRendererSwapChain* const GCRenderer_GetSwapChain(void);
-    GCRendererCommandList* const GCRenderer_GetCommandList(void);
-    GCRendererGraphicsPipeline* const GCRenderer_GetGraphicsPipeline(void);
-    GCRendererFramebuffer* const GCRenderer_GetFramebuffer(void);
+    GCRendererDevice* GCRenderer_GetDevice(void);
+    GCRendererSwapChain* GCRenderer_GetSwapChain(void);
+    GCRendererCommandList* GCRenderer_GetCommandList(void);
+    GCRendererGeometryPool* GCRenderer_GetGeometryPool(void);
+    GCRendererGraphicsPipeline* GCRenderer_GetGraphicsPipeline(void);
+    GCRendererFramebuffer* GCRenderer_GetFramebuffer(void);
+    GCRendererStatistics GCRenderer_GetStatistics(void);
 
 #ifdef __cplusplus
 }
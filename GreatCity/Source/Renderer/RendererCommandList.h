@@ -31,12 +31,23 @@ extern "C"
     typedef struct GCRendererSwapChain GCRendererSwapChain;
     typedef struct GCRendererVertexBuffer GCRendererVertexBuffer;
     typedef struct GCRendererIndexBuffer GCRendererIndexBuffer;
-    typedef struct GCRendererUniformBuffer GCRendererUniformBuffer;
+    typedef struct GCRendererGeometryPool GCRendererGeometryPool;
+    typedef struct GCRendererStorageBuffer GCRendererStorageBuffer;
     typedef struct GCRendererGraphicsPipeline GCRendererGraphicsPipeline;
+    typedef struct GCRendererComputePipeline GCRendererComputePipeline;
     typedef struct GCRendererFramebuffer GCRendererFramebuffer;
 
     typedef void (*GCRendererCommandListResizeCallbackFunction)(void);
 
+    typedef struct GCRendererDrawIndexedIndirectCommand
+    {
+        uint32_t IndexCount;
+        uint32_t InstanceCount;
+        uint32_t FirstIndex;
+        int32_t VertexOffset;
+        uint32_t FirstInstance;
+    } GCRendererDrawIndexedIndirectCommand;
+
     typedef struct GCRendererCommandListDescription
     {
         const GCRendererDevice* Device;
@@ -54,6 +65,8 @@ extern "C"
         GCRendererCommandList* const CommandList,
         const GCRendererCommandListResizeCallbackFunction ResizeCallbackFunction);
     void GCRendererCommandList_BeginRecord(GCRendererCommandList* const CommandList);
+    uint32_t GCRendererCommandList_GetCurrentFrame(const GCRendererCommandList* const CommandList);
+    uint32_t GCRendererCommandList_GetMaximumFramesInFlight(const GCRendererCommandList* const CommandList);
     void GCRendererCommandList_BeginSwapChainRenderPass(const GCRendererCommandList* const CommandList,
                                                         const GCRendererGraphicsPipeline* const GraphicsPipeline,
                                                         const GCRendererFramebuffer* const Framebuffer,
@@ -64,19 +77,35 @@ extern "C"
                                                          const float* const ClearColor);
     void GCRendererCommandList_BindVertexBuffer(const GCRendererCommandList* const CommandList,
                                                 const GCRendererVertexBuffer* const VertexBuffer);
+    void GCRendererCommandList_BindInstanceStorageBuffer(const GCRendererCommandList* const CommandList,
+                                                         const GCRendererStorageBuffer* const InstanceBuffer);
     void GCRendererCommandList_BindIndexBuffer(const GCRendererCommandList* const CommandList,
                                                const GCRendererIndexBuffer* const IndexBuffer);
+    void GCRendererCommandList_BindGeometryPool(const GCRendererCommandList* const CommandList,
+                                                const GCRendererGeometryPool* const GeometryPool);
     void GCRendererCommandList_BindGraphicsPipeline(const GCRendererCommandList* const CommandList,
-                                                    const GCRendererGraphicsPipeline* const GraphicsPipeline);
+                                                    const GCRendererGraphicsPipeline* const GraphicsPipeline,
+                                                    const uint32_t UniformOffset);
+    void GCRendererCommandList_BindComputePipeline(const GCRendererCommandList* const CommandList,
+                                                   const GCRendererComputePipeline* const ComputePipeline);
+    void GCRendererCommandList_PushComputeConstants(const GCRendererCommandList* const CommandList,
+                                                    const GCRendererComputePipeline* const ComputePipeline,
+                                                    const void* const Data, const uint32_t DataSize);
+    void GCRendererCommandList_Dispatch(const GCRendererCommandList* const CommandList, const uint32_t GroupCountX,
+                                        const uint32_t GroupCountY, const uint32_t GroupCountZ);
+    void GCRendererCommandList_ComputeToDrawBarrier(const GCRendererCommandList* const CommandList);
     void GCRendererCommandList_SetViewport(const GCRendererCommandList* const CommandList,
                                            const GCRendererFramebuffer* const Framebuffer);
     void GCRendererCommandList_Draw(const GCRendererCommandList* const CommandList, const uint32_t VertexCount,
                                     const uint32_t FirstVertex);
     void GCRendererCommandList_DrawIndexed(const GCRendererCommandList* const CommandList, const uint32_t IndexCount,
                                            const uint32_t FirstIndex);
+    void GCRendererCommandList_DrawIndexedIndirect(const GCRendererCommandList* const CommandList,
+                                                   const GCRendererStorageBuffer* const IndirectBuffer,
+                                                   const uint32_t FirstCommand, const uint32_t CommandCount);
     void GCRendererCommandList_EndSwapChainRenderPass(const GCRendererCommandList* const CommandList);
     void GCRendererCommandList_EndAttachmentRenderPass(const GCRendererCommandList* const CommandList,
-                                                       const GCRendererFramebuffer* const Framebuffer);
+                                                       GCRendererFramebuffer* const Framebuffer);
     void GCRendererCommandList_EndRecord(const GCRendererCommandList* const CommandList);
     void GCRendererCommandList_SubmitAndPresent(GCRendererCommandList* const CommandList);
     void GCRendererCommandList_Destroy(GCRendererCommandList* CommandList);
@@ -14,9 +14,8 @@
     You should have received a copy of the GNU General Public License
     along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
-
-#ifndef GC_RENDERER_RENDERER_UNIFORM_BUFFER_H
-#define GC_RENDERER_RENDERER_UNIFORM_BUFFER_H
+#ifndef GC_RENDERER_RENDERER_COMPUTE_PIPELINE_H
+#define GC_RENDERER_RENDERER_COMPUTE_PIPELINE_H
 
 #include <stdint.h>
 
@@ -25,26 +24,31 @@ extern "C"
 {
 #endif
 
-    typedef struct GCRendererUniformBuffer GCRendererUniformBuffer;
+    typedef struct GCRendererComputePipeline GCRendererComputePipeline;
     typedef struct GCRendererDevice GCRendererDevice;
     typedef struct GCRendererCommandList GCRendererCommandList;
+    typedef struct GCRendererStorageBuffer GCRendererStorageBuffer;
+    typedef struct GCRendererShader GCRendererShader;
 
-    typedef struct GCRendererUniformBufferDescription
+    typedef struct GCRendererComputePipelineDescription
     {
         const GCRendererDevice* Device;
         const GCRendererCommandList* CommandList;
 
-        size_t DataSize;
-    } GCRendererUniformBufferDescription;
+        uint32_t StorageBufferCount;
+        uint32_t PushConstantSize;
+        const GCRendererShader* Shader;
+    } GCRendererComputePipelineDescription;
 
-    GCRendererUniformBuffer* GCRendererUniformBuffer_Create(
-        const GCRendererUniformBufferDescription* const Description);
-    void GCRendererUniformBuffer_UpdateUniformBuffer(const GCRendererUniformBuffer* const UniformBuffer,
-                                                     const void* const Data, const size_t DataSize);
-    void GCRendererUniformBuffer_Destroy(GCRendererUniformBuffer* UniformBuffer);
+    GCRendererComputePipeline* GCRendererComputePipeline_Create(
+        const GCRendererComputePipelineDescription* const Description);
+    void GCRendererComputePipeline_SetStorageBuffer(const GCRendererComputePipeline* const ComputePipeline,
+                                                    const uint32_t Binding,
+                                                    const GCRendererStorageBuffer* const StorageBuffer);
+    void GCRendererComputePipeline_Destroy(GCRendererComputePipeline* ComputePipeline);
 
 #ifdef __cplusplus
 }
 #endif
 
-#endif
\ No newline at end of file
+#endif
@@ -32,11 +32,26 @@ extern "C"
     {
         bool IsAnisotropySupported;
         float MaximumAnisotropy;
+        bool IsMultiDrawIndirectSupported;
+        uint32_t MinimumUniformBufferOffsetAlignment;
+        uint32_t MinimumStorageBufferOffsetAlignment;
     } GCRendererDeviceCapabilities;
 
+    typedef struct GCRendererDeviceMemoryStatistics
+    {
+        uint32_t DeviceMemoryAllocationCount;
+        uint32_t MaximumDeviceMemoryAllocationCount;
+        uint32_t BlockCount;
+        uint32_t AllocationCount;
+        uint32_t DedicatedAllocationCount;
+        uint64_t ReservedSize;
+        uint64_t UsedSize;
+    } GCRendererDeviceMemoryStatistics;
+
     GCRendererDevice* GCRendererDevice_Create(void);
     void GCRendererDevice_WaitIdle(const GCRendererDevice* const Device);
     GCRendererDeviceCapabilities GCRendererDevice_GetDeviceCapabilities(const GCRendererDevice* const Device);
+    GCRendererDeviceMemoryStatistics GCRendererDevice_GetMemoryStatistics(const GCRendererDevice* const Device);
     void GCRendererDevice_Destroy(GCRendererDevice* Device);
 
 #ifdef __cplusplus
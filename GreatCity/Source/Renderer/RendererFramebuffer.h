@@ -18,6 +18,8 @@
 #ifndef GC_RENDERER_RENDERER_FRAMEBUFFER_H
 #define GC_RENDERER_RENDERER_FRAMEBUFFER_H
 
+#include "Renderer/RendererEnums.h"
+
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -31,10 +33,6 @@ extern "C"
     typedef struct GCRendererCommandList GCRendererCommandList;
     typedef struct GCRendererGraphicsPipeline GCRendererGraphicsPipeline;
 
-    typedef enum GCRendererAttachmentType GCRendererAttachmentType;
-    typedef enum GCRendererAttachmentFormat GCRendererAttachmentFormat;
-    typedef enum GCRendererAttachmentSampleCount GCRendererAttachmentSampleCount;
-
     typedef enum GCRendererFramebufferAttachmentFlags
     {
         GCRendererFramebufferAttachmentFlags_None,
@@ -53,6 +51,7 @@ extern "C"
     {
         const GCRendererDevice* Device;
         const GCRendererSwapChain* SwapChain;
+        const GCRendererCommandList* CommandList;
         const GCRendererGraphicsPipeline* GraphicsPipeline;
         uint32_t Width, Height;
         const GCRendererFramebufferAttachment* Attachments;
@@ -65,9 +64,9 @@ extern "C"
                                                              const uint32_t Width, const uint32_t Height);
     void GCRendererFramebuffer_GetSize(const GCRendererFramebuffer* const Framebuffer, uint32_t* const Width,
                                        uint32_t* const Height);
-    int32_t GCRendererFramebuffer_GetPixel(const GCRendererFramebuffer* const Framebuffer,
-                                           const GCRendererCommandList* const CommandList,
-                                           const uint32_t AttachmentIndex, const int32_t X, const int32_t Y);
+    void GCRendererFramebuffer_RequestPixel(GCRendererFramebuffer* const Framebuffer, const uint32_t AttachmentIndex,
+                                            const int32_t X, const int32_t Y);
+    int32_t GCRendererFramebuffer_GetPixel(const GCRendererFramebuffer* const Framebuffer);
     void GCRendererFramebuffer_Destroy(GCRendererFramebuffer* Framebuffer);
 
 #ifdef __cplusplus
@@ -0,0 +1,76 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GC_RENDERER_RENDERER_GEOMETRY_POOL_H
+#define GC_RENDERER_RENDERER_GEOMETRY_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct GCRendererGeometryPool GCRendererGeometryPool;
+    typedef struct GCRendererDevice GCRendererDevice;
+    typedef struct GCRendererCommandList GCRendererCommandList;
+
+    typedef struct GCRendererGeometryPoolDescription
+    {
+        const GCRendererDevice* Device;
+        const GCRendererCommandList* CommandList;
+
+        size_t VertexSize;
+        uint32_t VertexCapacity;
+        uint32_t IndexCapacity;
+    } GCRendererGeometryPoolDescription;
+
+    typedef struct GCRendererGeometryAllocation
+    {
+        int32_t VertexOffset;
+        uint32_t VertexCount;
+        uint32_t FirstIndex;
+        uint32_t IndexCount;
+    } GCRendererGeometryAllocation;
+
+    typedef struct GCRendererGeometryPoolStatistics
+    {
+        uint32_t VertexCapacity;
+        uint32_t UsedVertexCount;
+        uint32_t IndexCapacity;
+        uint32_t UsedIndexCount;
+    } GCRendererGeometryPoolStatistics;
+
+    GCRendererGeometryPool* GCRendererGeometryPool_Create(const GCRendererGeometryPoolDescription* const Description);
+    GCRendererGeometryAllocation GCRendererGeometryPool_Allocate(GCRendererGeometryPool* const GeometryPool,
+                                                                 const void* const Vertices,
+                                                                 const uint32_t VertexCount,
+                                                                 const uint32_t* const Indices,
+                                                                 const uint32_t IndexCount);
+    void GCRendererGeometryPool_Free(GCRendererGeometryPool* const GeometryPool,
+                                     const GCRendererGeometryAllocation* const Allocation);
+    void GCRendererGeometryPool_BeginFrame(GCRendererGeometryPool* const GeometryPool);
+    GCRendererGeometryPoolStatistics GCRendererGeometryPool_GetStatistics(
+        const GCRendererGeometryPool* const GeometryPool);
+    void GCRendererGeometryPool_Destroy(GCRendererGeometryPool* GeometryPool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -18,6 +18,9 @@
 #ifndef GC_RENDERER_RENDERER_GRAPHICS_PIPELINE_H
 #define GC_RENDERER_RENDERER_GRAPHICS_PIPELINE_H
 
+#include "Renderer/RendererEnums.h"
+
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -29,14 +32,10 @@ extern "C"
     typedef struct GCRendererDevice GCRendererDevice;
     typedef struct GCRendererSwapChain GCRendererSwapChain;
     typedef struct GCRendererCommandList GCRendererCommandList;
-    typedef struct GCRendererUniformBuffer GCRendererUniformBuffer;
+    typedef struct GCRendererRingBuffer GCRendererRingBuffer;
     typedef struct GCRendererTexture2D GCRendererTexture2D;
     typedef struct GCRendererShader GCRendererShader;
 
-    typedef enum GCRendererAttachmentType GCRendererAttachmentType;
-    typedef enum GCRendererAttachmentFormat GCRendererAttachmentFormat;
-    typedef enum GCRendererAttachmentSampleCount GCRendererAttachmentSampleCount;
-
     typedef enum GCRendererGraphicsPipelineVertexInputAttributeFormat
     {
         GCRendererGraphicsPipelineVertexInputAttributeFormat_Float,
@@ -47,14 +46,22 @@ extern "C"
         GCRendererGraphicsPipelineVertexInputAttributeFormat_Integer
     } GCRendererGraphicsPipelineVertexInputAttributeFormat;
 
+    typedef enum GCRendererGraphicsPipelineVertexInputRate
+    {
+        GCRendererGraphicsPipelineVertexInputRate_Vertex,
+        GCRendererGraphicsPipelineVertexInputRate_Instance
+    } GCRendererGraphicsPipelineVertexInputRate;
+
     typedef struct GCRendererGraphicsPipelineVertexInputBinding
     {
         uint32_t Binding;
         uint32_t Stride;
+        GCRendererGraphicsPipelineVertexInputRate InputRate;
     } GCRendererGraphicsPipelineVertexInputBinding;
 
     typedef struct GCRendererGraphicsPipelineVertexInputAttribute
     {
+        uint32_t Binding;
         uint32_t Location;
         GCRendererGraphicsPipelineVertexInputAttributeFormat Format;
         uint32_t Offset;
@@ -87,7 +94,8 @@ extern "C"
         const GCRendererGraphicsPipelineVertexInput* VertexInput;
         GCRendererAttachmentSampleCount SampleCount;
 
-        const GCRendererUniformBuffer* UniformBuffer;
+        const GCRendererRingBuffer* UniformRingBuffer;
+        size_t UniformDataSize;
         const GCRendererTexture2D* const* Texture2Ds;
         uint32_t Texture2DCount;
         const GCRendererShader* Shader;
@@ -16,58 +16,130 @@
 */
 
 #include "Renderer/RendererMesh.h"
+#include "Core/Assert.h"
+#include "Core/Log.h"
 #include "Core/Memory/Allocator.h"
 #include "Renderer/Renderer.h"
-#include "Renderer/RendererDevice.h"
-#include "Renderer/RendererIndexBuffer.h"
+#include "Renderer/RendererGeometryPool.h"
 #include "Renderer/RendererModel.h"
-#include "Renderer/RendererVertexBuffer.h"
-#include "World/Entity.h"
 
 #include <stdint.h>
-#include <string.h>
 
-GCRendererMesh* GCRendererMesh_Create(const GCEntity Entity, const GCRendererModel* const Model)
+typedef struct GCRendererMeshCache
 {
-    GCRendererMesh* Mesh = (GCRendererMesh*)GCMemory_Allocate(sizeof(GCRendererMesh));
-    Mesh->VertexBuffer = NULL;
-    Mesh->IndexBuffer = NULL;
+    GCRendererMesh** Meshes;
+    uint32_t MeshCount;
+    uint32_t MaximumMeshCount;
+    uint32_t* FreeMeshIDs;
+    uint32_t FreeMeshIDCount;
+    uint32_t NextMeshID;
+} GCRendererMeshCache;
 
-    const GCRendererDevice* const Device = GCRenderer_GetDevice();
-    const GCRendererCommandList* const CommandList = GCRenderer_GetCommandList();
+static GCRendererMesh* GCRendererMesh_CreateMesh(const GCRendererModel* const Model);
+static void GCRendererMesh_DestroyMesh(GCRendererMesh* Mesh);
+static uint32_t GCRendererMesh_AllocateID(void);
 
-    for (uint32_t Counter = 0; Counter < Model->VertexCount; Counter++)
-    {
-        Model->Vertices[Counter].EntityID = (uint64_t)Entity;
-    }
+static GCRendererMeshCache MeshCache = {0};
 
-    GCRendererVertexBufferDescription VertexBufferDescription = {0};
-    VertexBufferDescription.Device = Device;
-    VertexBufferDescription.CommandList = CommandList;
-    VertexBufferDescription.Vertices = Model->Vertices;
-    VertexBufferDescription.VertexCount = Model->VertexCount;
-    VertexBufferDescription.VertexSize = Model->VertexCount * sizeof(GCRendererVertex);
+GCRendererMesh* GCRendererMesh_Create(const GCRendererModel* const Model)
+{
+    for (uint32_t Counter = 0; Counter < MeshCache.MeshCount; Counter++)
+    {
+        if (MeshCache.Meshes[Counter]->Model == Model)
+        {
+            MeshCache.Meshes[Counter]->ReferenceCount++;
 
-    Mesh->VertexBuffer = GCRendererVertexBuffer_CreateDynamic(&VertexBufferDescription);
+            return MeshCache.Meshes[Counter];
+        }
+    }
 
-    GCRendererIndexBufferDescription IndexBufferDescription = {0};
-    IndexBufferDescription.Device = Device;
-    IndexBufferDescription.CommandList = CommandList;
-    IndexBufferDescription.Indices = Model->Indices;
-    IndexBufferDescription.IndexCount = Model->IndexCount;
-    IndexBufferDescription.IndexSize = Model->IndexCount * sizeof(uint32_t);
+    if (MeshCache.MeshCount >= MeshCache.MaximumMeshCount)
+    {
+        MeshCache.MaximumMeshCount = MeshCache.MaximumMeshCount ? MeshCache.MaximumMeshCount * 2 : 16;
+        MeshCache.Meshes = (GCRendererMesh**)GCMemory_Reallocate(MeshCache.Meshes,
+                                                                 MeshCache.MaximumMeshCount * sizeof(GCRendererMesh*));
+        MeshCache.FreeMeshIDs =
+            (uint32_t*)GCMemory_Reallocate(MeshCache.FreeMeshIDs, MeshCache.MaximumMeshCount * sizeof(uint32_t));
+    }
 
-    Mesh->IndexBuffer = GCRendererIndexBuffer_Create(&IndexBufferDescription);
+    GCRendererMesh* Mesh = GCRendererMesh_CreateMesh(Model);
+    MeshCache.Meshes[MeshCache.MeshCount] = Mesh;
+    MeshCache.MeshCount++;
 
     return Mesh;
 }
 
 void GCRendererMesh_Destroy(GCRendererMesh* Mesh)
 {
-    GCRendererDevice_WaitIdle(GCRenderer_GetDevice());
+    Mesh->ReferenceCount--;
 
-    GCRendererIndexBuffer_Destroy(Mesh->IndexBuffer);
-    GCRendererVertexBuffer_Destroy(Mesh->VertexBuffer);
+    if (Mesh->ReferenceCount)
+    {
+        return;
+    }
+
+    for (uint32_t Counter = 0; Counter < MeshCache.MeshCount; Counter++)
+    {
+        if (MeshCache.Meshes[Counter] == Mesh)
+        {
+            MeshCache.Meshes[Counter] = MeshCache.Meshes[MeshCache.MeshCount - 1];
+            MeshCache.MeshCount--;
+
+            break;
+        }
+    }
+
+    MeshCache.FreeMeshIDs[MeshCache.FreeMeshIDCount] = Mesh->ID;
+    MeshCache.FreeMeshIDCount++;
+
+    if (!MeshCache.MeshCount)
+    {
+        GCMemory_Free(MeshCache.Meshes);
+        GCMemory_Free(MeshCache.FreeMeshIDs);
+
+        MeshCache.Meshes = NULL;
+        MeshCache.MaximumMeshCount = 0;
+        MeshCache.FreeMeshIDs = NULL;
+        MeshCache.FreeMeshIDCount = 0;
+        MeshCache.NextMeshID = 0;
+    }
+
+    GCRendererMesh_DestroyMesh(Mesh);
+}
+
+GCRendererMesh* GCRendererMesh_CreateMesh(const GCRendererModel* const Model)
+{
+    GCRendererMesh* Mesh = (GCRendererMesh*)GCMemory_Allocate(sizeof(GCRendererMesh));
+    Mesh->Model = Model;
+    Mesh->ID = GCRendererMesh_AllocateID();
+    Mesh->ReferenceCount = 1;
+
+    Mesh->Geometry = GCRendererGeometryPool_Allocate(GCRenderer_GetGeometryPool(), Model->Vertices, Model->VertexCount,
+                                                     Model->Indices, Model->IndexCount);
+
+    return Mesh;
+}
+
+void GCRendererMesh_DestroyMesh(GCRendererMesh* Mesh)
+{
+    GCRendererGeometryPool_Free(GCRenderer_GetGeometryPool(), &Mesh->Geometry);
 
     GCMemory_Free(Mesh);
 }
+
+uint32_t GCRendererMesh_AllocateID(void)
+{
+    if (MeshCache.FreeMeshIDCount)
+    {
+        MeshCache.FreeMeshIDCount--;
+
+        return MeshCache.FreeMeshIDs[MeshCache.FreeMeshIDCount];
+    }
+
+    GC_ASSERT_WITH_MESSAGE(
+        (uint64_t)(MeshCache.NextMeshID + 1) * GC_RENDERER_MODEL_MAXIMUM_LOD_COUNT <=
+            (1ull << GC_RENDERER_MESH_SORT_KEY_BIT_COUNT),
+        "Mesh ID %u does not fit in the draw sort key", MeshCache.NextMeshID);
+
+    return MeshCache.NextMeshID++;
+}
@@ -18,26 +18,32 @@
 #ifndef GC_RENDERER_RENDERER_MESH_H
 #define GC_RENDERER_RENDERER_MESH_H
 
+#include "Renderer/RendererGeometryPool.h"
+
 #include <stdint.h>
 
+#define GC_RENDERER_MESH_SORT_KEY_BIT_COUNT 20
+
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
-    typedef struct GCRendererVertexBuffer GCRendererVertexBuffer;
-    typedef struct GCRendererIndexBuffer GCRendererIndexBuffer;
     typedef struct GCRendererModel GCRendererModel;
 
     typedef struct GCMatrix4x4 GCMatrix4x4;
 
     typedef struct GCRendererMesh
     {
-        GCRendererVertexBuffer* VertexBuffer;
-        GCRendererIndexBuffer* IndexBuffer;
+        const GCRendererModel* Model;
+
+        GCRendererGeometryAllocation Geometry;
+
+        uint32_t ID;
+        uint32_t ReferenceCount;
     } GCRendererMesh;
 
-    GCRendererMesh* GCRendererMesh_Create(const uint64_t EntityID, const GCRendererModel* const Model);
+    GCRendererMesh* GCRendererMesh_Create(const GCRendererModel* const Model);
     void GCRendererMesh_Destroy(GCRendererMesh* Mesh);
 
 #ifdef __cplusplus
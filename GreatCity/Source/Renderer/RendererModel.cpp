@@ -17,42 +17,115 @@
 
 #include "Renderer/RendererModel.h"
 #include "Core/Assert.h"
+#include "Core/FileSystem.h"
+#include "Core/Jobs/JobSystem.h"
 #include "Core/Log.h"
 #include "Core/Memory/Allocator.h"
+#include "Math/BoundingVolumeHierarchy.h"
+#include "Math/Ray.h"
 #include "Renderer/Renderer.h"
-
-#include <unordered_map>
+#include "Renderer/RendererModelImport.h"
+#include "Renderer/RendererModelSimplifier.h"
+
+#include <cctype>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <string>
 #include <vector>
 
 #include <tiny_obj_loader.h>
 
-static void GCRendererModel_HashCombine(std::size_t& Seed)
-{
-    (void)Seed;
-}
+#define GC_RENDERER_MODEL_MINIMUM_LOD_INDEX_COUNT 192
+#define GC_RENDERER_MODEL_MAXIMUM_LOD_INDEX_RATIO 0.8f
 
-template <typename Type, typename... TypeRest>
-static void GCRendererModel_HashCombine(std::size_t& Seed, const Type& Value, TypeRest... Rest)
+#define GC_RENDERER_MODEL_CACHE_DIRECTORY "Assets/Cache/Models/"
+#define GC_RENDERER_MODEL_FILE_MAGIC 0x48534D47u
+#define GC_RENDERER_MODEL_FILE_VERSION 3u
+#define GC_RENDERER_MODEL_FILE_ALIGNMENT 16u
+#define GC_RENDERER_MODEL_STAMP_FILE_MAGIC 0x54534D47u
+
+typedef struct GCRendererModelFileHeader
 {
-    Seed ^= std::hash<Type>{}(Value) + 0x9e3779b9 + (Seed << 6) + (Seed >> 2);
-    GCRendererModel_HashCombine(Seed, Rest...);
-}
+    uint32_t Magic;
+    uint32_t Version;
+    uint64_t SourceHash;
+
+    uint32_t VertexSize;
+    uint32_t VertexCount;
+    uint32_t IndexCount;
 
-namespace std
+    GCRendererModelLOD LODs[GC_RENDERER_MODEL_MAXIMUM_LOD_COUNT];
+    uint32_t LODCount;
+
+    GCBoundingBox BoundingBox;
+    GCBoundingSphere BoundingSphere;
+
+    uint64_t VertexDataOffset;
+    uint64_t IndexDataOffset;
+} GCRendererModelFileHeader;
+
+typedef struct GCRendererModelStampFileHeader
 {
-template <> struct hash<GCRendererVertex>
+    uint32_t Magic;
+    uint32_t Version;
+    uint64_t SourceStamp;
+    uint64_t SourceHash;
+
+    uint32_t MaterialLibraryPathCount;
+    uint32_t MaterialLibraryPathDataSize;
+} GCRendererModelStampFileHeader;
+
+typedef struct GCRendererModelFileImport
 {
-    size_t operator()(const GCRendererVertex& Vertex) const
-    {
-        size_t Seed = 0;
-        GCRendererModel_HashCombine(Seed, Vertex.Position.X, Vertex.Position.Y, Vertex.Position.Z, Vertex.Normal.X,
-                                    Vertex.Normal.Y, Vertex.Normal.Z, Vertex.Color.X, Vertex.Color.Y, Vertex.Color.Z,
-                                    Vertex.Color.W, Vertex.TextureCoordinate.X, Vertex.TextureCoordinate.Y);
+    const char* ModelPath;
+    const char* MaterialPath;
 
-        return Seed;
-    }
-};
-} // namespace std
+    std::vector<GCRendererVertex> Vertices;
+    std::vector<uint32_t> Indices;
+} GCRendererModelFileImport;
+
+typedef struct GCRendererModelFuture
+{
+    std::vector<std::string> ModelPaths;
+    std::vector<std::string> MaterialPaths;
+
+    GCRendererModel* Model;
+    GCJobCounter* Counter;
+} GCRendererModelFuture;
+
+static void GCRendererModelFuture_Load(void* Data);
+static GCRendererModel* GCRendererModel_Import(const char* const* const ModelPaths,
+                                              const char* const* const MaterialPaths, const uint32_t ModelCount);
+static void GCRendererModel_ImportFiles(const uint32_t Start, const uint32_t End, void* Data);
+static void GCRendererModel_ImportFile(GCRendererModelFileImport* const FileImport);
+static uint64_t GCRendererModel_HashSources(const char* const* const ModelPaths, const char* const* const MaterialPaths,
+                                            const uint32_t ModelCount, std::vector<std::string>& MaterialLibraryPaths);
+static uint64_t GCRendererModel_HashSourcePaths(const char* const* const ModelPaths,
+                                                const char* const* const MaterialPaths, const uint32_t ModelCount);
+static uint64_t GCRendererModel_StampSources(const char* const* const ModelPaths, const uint32_t ModelCount,
+                                             const std::vector<std::string>& MaterialLibraryPaths);
+static uint64_t GCRendererModel_StampFile(const uint64_t Stamp, const char* const Path);
+static bool GCRendererModel_LoadStampFile(const char* const Path, const char* const* const ModelPaths,
+                                          const uint32_t ModelCount, uint64_t* const SourceHash);
+static void GCRendererModel_WriteStampFile(const char* const Path, const char* const* const ModelPaths,
+                                           const uint32_t ModelCount,
+                                           const std::vector<std::string>& MaterialLibraryPaths,
+                                           const uint64_t SourceHash);
+static uint64_t GCRendererModel_HashData(uint64_t Hash, const void* const Data, const size_t Size);
+static uint64_t GCRendererModel_HashFile(const uint64_t Hash, const char* const Path);
+static GCRendererModel* GCRendererModel_LoadCookedFile(const char* const Path, const uint64_t SourceHash);
+static bool GCRendererModel_ValidateCookedGeometry(const GCRendererModelFileHeader* const Header,
+                                                   const uint8_t* const Data);
+static void GCRendererModel_WriteCookedFile(const GCRendererModel* const Model, const char* const Path,
+                                            const uint64_t SourceHash);
+static uint64_t GCRendererModel_AlignFileOffset(const uint64_t Offset);
+static GCBoundingVolumeHierarchy* GCRendererModel_CreateBoundingVolumeHierarchy(const GCRendererModel* const Model);
+static bool GCRendererModel_CastRayAgainstTriangle(void* const Context, const uint32_t TriangleIndex,
+                                                   const GCRay* const Ray, const float MaximumDistance,
+                                                   float* const Distance);
+static void GCRendererModel_GenerateLODs(GCRendererModel* const Model, const std::vector<GCRendererVertex>& Vertices,
+                                        std::vector<uint32_t>& Indices);
 
 GCRendererModel* GCRendererModel_CreateFromFile(const char* const ModelPath, const char* const MaterialPath)
 {
@@ -64,106 +137,685 @@ GCRendererModel* GCRendererModel_CreateFromFile(const char* const ModelPath, con
 
 GCRendererModel* GCRendererModel_CreateFromFiles(const char* const* const ModelPaths,
                                                  const char* const* const MaterialPaths, const uint32_t ModelCount)
+{
+    char StampFilePath[sizeof(GC_RENDERER_MODEL_CACHE_DIRECTORY) + 32] = {0};
+    snprintf(StampFilePath, sizeof(StampFilePath), GC_RENDERER_MODEL_CACHE_DIRECTORY "%016" PRIx64 ".gcstamp",
+             GCRendererModel_HashSourcePaths(ModelPaths, MaterialPaths, ModelCount));
+
+    uint64_t SourceHash = 0;
+
+    if (!GCRendererModel_LoadStampFile(StampFilePath, ModelPaths, ModelCount, &SourceHash))
+    {
+        std::vector<std::string> MaterialLibraryPaths{};
+        SourceHash = GCRendererModel_HashSources(ModelPaths, MaterialPaths, ModelCount, MaterialLibraryPaths);
+
+        GCRendererModel_WriteStampFile(StampFilePath, ModelPaths, ModelCount, MaterialLibraryPaths, SourceHash);
+    }
+
+    char CookedFilePath[sizeof(GC_RENDERER_MODEL_CACHE_DIRECTORY) + 32] = {0};
+    snprintf(CookedFilePath, sizeof(CookedFilePath), GC_RENDERER_MODEL_CACHE_DIRECTORY "%016" PRIx64 ".gcmesh",
+             SourceHash);
+
+    GCRendererModel* Model = GCRendererModel_LoadCookedFile(CookedFilePath, SourceHash);
+
+    if (!Model)
+    {
+        Model = GCRendererModel_Import(ModelPaths, MaterialPaths, ModelCount);
+        GCRendererModel_WriteCookedFile(Model, CookedFilePath, SourceHash);
+    }
+
+    Model->BoundingVolumeHierarchy = GCRendererModel_CreateBoundingVolumeHierarchy(Model);
+
+    return Model;
+}
+
+GCRendererModelFuture* GCRendererModel_CreateFromFileAsync(const char* const ModelPath, const char* const MaterialPath)
+{
+    const char* const ModelPaths[1] = {ModelPath};
+    const char* const MaterialPaths[1] = {MaterialPath};
+
+    return GCRendererModel_CreateFromFilesAsync(ModelPaths, MaterialPaths, 1);
+}
+
+GCRendererModelFuture* GCRendererModel_CreateFromFilesAsync(const char* const* const ModelPaths,
+                                                            const char* const* const MaterialPaths,
+                                                            const uint32_t ModelCount)
+{
+    GCRendererModelFuture* Future = new GCRendererModelFuture();
+    Future->ModelPaths.assign(ModelPaths, ModelPaths + ModelCount);
+    Future->MaterialPaths.assign(MaterialPaths, MaterialPaths + ModelCount);
+    Future->Model = nullptr;
+    Future->Counter = GCJobCounter_Create();
+
+    GCJobSystem_RunBackground(GCRendererModelFuture_Load, Future, Future->Counter);
+
+    return Future;
+}
+
+bool GCRendererModelFuture_IsReady(const GCRendererModelFuture* const Future)
+{
+    return GCJobCounter_IsDone(Future->Counter);
+}
+
+GCRendererModel* GCRendererModelFuture_Get(GCRendererModelFuture* Future)
+{
+    GCJobSystem_Wait(Future->Counter);
+
+    GCRendererModel* const Model = Future->Model;
+
+    GCJobCounter_Destroy(Future->Counter);
+    delete Future;
+
+    return Model;
+}
+
+bool GCRendererModel_CastRay(const GCRendererModel* const Model, const GCRay* const Ray, const float MaximumDistance,
+                             float* const Distance)
+{
+    uint32_t TriangleIndex = 0;
+
+    return GCBoundingVolumeHierarchy_CastRay(Model->BoundingVolumeHierarchy, Ray, MaximumDistance,
+                                             GCRendererModel_CastRayAgainstTriangle,
+                                             const_cast<GCRendererModel*>(Model), &TriangleIndex, Distance);
+}
+
+void GCRendererModel_Destroy(GCRendererModel* Model)
+{
+    GCBoundingVolumeHierarchy_Destroy(Model->BoundingVolumeHierarchy);
+
+    if (Model->MappedFile)
+    {
+        GCFileSystem_UnmapFile(Model->MappedFile);
+    }
+    else
+    {
+        GCMemory_Free(Model->Indices);
+        GCMemory_Free(Model->Vertices);
+    }
+
+    GCMemory_Free(Model);
+}
+
+void GCRendererModelFuture_Load(void* Data)
+{
+    GCRendererModelFuture* const Future = static_cast<GCRendererModelFuture*>(Data);
+
+    std::vector<const char*> ModelPaths{};
+    std::vector<const char*> MaterialPaths{};
+
+    for (uint32_t Counter = 0; Counter < Future->ModelPaths.size(); Counter++)
+    {
+        ModelPaths.emplace_back(Future->ModelPaths[Counter].c_str());
+        MaterialPaths.emplace_back(Future->MaterialPaths[Counter].c_str());
+    }
+
+    Future->Model = GCRendererModel_CreateFromFiles(ModelPaths.data(), MaterialPaths.data(),
+                                                    static_cast<uint32_t>(ModelPaths.size()));
+}
+
+GCRendererModel* GCRendererModel_Import(const char* const* const ModelPaths, const char* const* const MaterialPaths,
+                                       const uint32_t ModelCount)
 {
     GCRendererModel* Model = static_cast<GCRendererModel*>(GCMemory_Allocate(sizeof(GCRendererModel)));
+    Model->MappedFile = nullptr;
+
+    std::vector<GCRendererModelFileImport> FileImports(ModelCount);
+
+    for (uint32_t Counter = 0; Counter < ModelCount; Counter++)
+    {
+        FileImports[Counter].ModelPath = ModelPaths[Counter];
+        FileImports[Counter].MaterialPath = MaterialPaths[Counter];
+    }
+
+    GCJobCounter* const ImportCounter = GCJobCounter_Create();
+    GCJobSystem_ParallelFor(ModelCount, 1, GCRendererModel_ImportFiles, FileImports.data(), ImportCounter);
+    GCJobSystem_Wait(ImportCounter);
+    GCJobCounter_Destroy(ImportCounter);
+
+    size_t TotalVertexCount = 0, TotalIndexCount = 0;
+
+    for (const GCRendererModelFileImport& FileImport : FileImports)
+    {
+        TotalVertexCount += FileImport.Vertices.size();
+        TotalIndexCount += FileImport.Indices.size();
+    }
 
     std::vector<GCRendererVertex> Vertices{};
+    Vertices.reserve(TotalVertexCount);
+
     std::vector<uint32_t> Indices{};
+    Indices.reserve(TotalIndexCount);
 
-    for (uint32_t Counter = 0; Counter < ModelCount; Counter++)
+    for (const GCRendererModelFileImport& FileImport : FileImports)
     {
-        tinyobj::ObjReader Reader{};
+        const uint32_t VertexOffset = static_cast<uint32_t>(Vertices.size());
 
-        tinyobj::ObjReaderConfig ReaderConfiguration{};
-        ReaderConfiguration.mtl_search_path = MaterialPaths[Counter];
+        Vertices.insert(Vertices.end(), FileImport.Vertices.begin(), FileImport.Vertices.end());
 
-        if (!Reader.ParseFromFile(ModelPaths[Counter], ReaderConfiguration))
+        for (const uint32_t Index : FileImport.Indices)
         {
-            if (!Reader.Warning().empty())
-            {
-                GC_LOG_WARNING("%s", Reader.Warning().c_str());
-            }
+            Indices.emplace_back(Index + VertexOffset);
+        }
+    }
 
-            if (!Reader.Error().empty())
-            {
-                GC_ASSERT_WITH_MESSAGE(false, "Failed to load an OBJ file: %s with error: %s", ModelPaths[Counter],
-                                       Reader.Error().c_str());
-            }
+    GCRendererModel_GenerateLODs(Model, Vertices, Indices);
+
+    Model->Vertices = static_cast<GCRendererVertex*>(GCMemory_Allocate(Vertices.size() * sizeof(GCRendererVertex)));
+    memcpy(Model->Vertices, Vertices.data(), Vertices.size() * sizeof(GCRendererVertex));
+    Model->VertexCount = static_cast<uint32_t>(Vertices.size());
+
+    Model->Indices = static_cast<uint32_t*>(GCMemory_Allocate(Indices.size() * sizeof(uint32_t)));
+    memcpy(Model->Indices, Indices.data(), Indices.size() * sizeof(uint32_t));
+    Model->IndexCount = static_cast<uint32_t>(Indices.size());
+
+    Model->BoundingBox =
+        GCBoundingBox_CreateFromPoints(&Model->Vertices[0].Position, Model->VertexCount, sizeof(GCRendererVertex));
+    Model->BoundingSphere = GCBoundingSphere_CreateFromPoints(&Model->BoundingBox, &Model->Vertices[0].Position,
+                                                              Model->VertexCount, sizeof(GCRendererVertex));
+
+    return Model;
+}
+
+void GCRendererModel_ImportFiles(const uint32_t Start, const uint32_t End, void* Data)
+{
+    GCRendererModelFileImport* const FileImports = static_cast<GCRendererModelFileImport*>(Data);
+
+    for (uint32_t Counter = Start; Counter < End; Counter++)
+    {
+        GCRendererModel_ImportFile(&FileImports[Counter]);
+    }
+}
+
+void GCRendererModel_ImportFile(GCRendererModelFileImport* const FileImport)
+{
+    tinyobj::ObjReader Reader{};
+
+    tinyobj::ObjReaderConfig ReaderConfiguration{};
+    ReaderConfiguration.mtl_search_path = FileImport->MaterialPath;
+
+    if (!Reader.ParseFromFile(FileImport->ModelPath, ReaderConfiguration))
+    {
+        if (!Reader.Warning().empty())
+        {
+            GC_LOG_WARNING("%s", Reader.Warning().c_str());
+        }
+
+        if (!Reader.Error().empty())
+        {
+            GC_ASSERT_WITH_MESSAGE(false, "Failed to load an OBJ file: %s with error: %s", FileImport->ModelPath,
+                                   Reader.Error().c_str());
+        }
+    }
+
+    GCRendererModelImport_WeldVertices(Reader, FileImport->Vertices, FileImport->Indices);
+}
+
+uint64_t GCRendererModel_HashSources(const char* const* const ModelPaths, const char* const* const MaterialPaths,
+                                     const uint32_t ModelCount, std::vector<std::string>& MaterialLibraryPaths)
+{
+    const uint32_t FormatKey[2] = {GC_RENDERER_MODEL_FILE_VERSION, static_cast<uint32_t>(sizeof(GCRendererVertex))};
+
+    uint64_t Hash = GCRendererModel_HashData(0xCBF29CE484222325u, FormatKey, sizeof(FormatKey));
+
+    for (uint32_t Counter = 0; Counter < ModelCount; Counter++)
+    {
+        Hash = GCRendererModel_HashFile(Hash, ModelPaths[Counter]);
+
+        GCFileSystemMappedFile* const ModelFile = GCFileSystem_MapFile(ModelPaths[Counter]);
+
+        if (!ModelFile)
+        {
+            continue;
         }
 
-        const tinyobj::attrib_t& Attribute = Reader.GetAttrib();
-        const std::vector<tinyobj::shape_t>& Shapes = Reader.GetShapes();
-        const std::vector<tinyobj::material_t>& Materials = Reader.GetMaterials();
+        const char* const ModelData = static_cast<const char*>(GCFileSystemMappedFile_GetData(ModelFile));
+        const size_t ModelDataSize = GCFileSystemMappedFile_GetSize(ModelFile);
 
-        std::unordered_map<GCRendererVertex, uint32_t> UniqueVertices{};
+        const char* const MaterialLibraryKeyword = "mtllib";
+        const size_t MaterialLibraryKeywordLength = strlen(MaterialLibraryKeyword);
 
-        for (const tinyobj::shape_t& Shape : Shapes)
+        for (size_t LineStart = 0; LineStart < ModelDataSize;)
         {
-            uint32_t IndexOffset = 0;
+            size_t LineEnd = LineStart;
 
-            for (uint32_t FaceIndex = 0; FaceIndex < Shape.mesh.num_face_vertices.size(); FaceIndex++)
+            while (LineEnd < ModelDataSize && ModelData[LineEnd] != '\n')
             {
-                const uint32_t Face = Shape.mesh.num_face_vertices[FaceIndex];
-
-                for (uint32_t FaceVertex = 0; FaceVertex < Face; FaceVertex++)
-                {
-                    GCRendererVertex Vertex{};
+                LineEnd++;
+            }
 
-                    const tinyobj::index_t Index = Shape.mesh.indices[IndexOffset + FaceVertex];
+            if (LineEnd - LineStart > MaterialLibraryKeywordLength &&
+                !strncmp(ModelData + LineStart, MaterialLibraryKeyword, MaterialLibraryKeywordLength))
+            {
+                size_t NameStart = LineStart + MaterialLibraryKeywordLength;
 
-                    if (Index.vertex_index >= 0)
+                while (NameStart < LineEnd)
+                {
+                    while (NameStart < LineEnd && isspace(static_cast<unsigned char>(ModelData[NameStart])))
                     {
-                        Vertex.Position = GCVector3_Create(Attribute.vertices[3 * Index.vertex_index + 0],
-                                                           Attribute.vertices[3 * Index.vertex_index + 1],
-                                                           Attribute.vertices[3 * Index.vertex_index + 2]);
+                        NameStart++;
                     }
 
-                    if (Index.normal_index >= 0)
+                    size_t NameEnd = NameStart;
+
+                    while (NameEnd < LineEnd && !isspace(static_cast<unsigned char>(ModelData[NameEnd])))
                     {
-                        Vertex.Normal = GCVector3_Create(Attribute.normals[3 * Index.normal_index + 0],
-                                                         Attribute.normals[3 * Index.normal_index + 1],
-                                                         Attribute.normals[3 * Index.normal_index + 2]);
+                        NameEnd++;
                     }
 
-                    if (Index.texcoord_index >= 0)
+                    if (NameEnd > NameStart)
                     {
-                        Vertex.TextureCoordinate = GCVector2_Create(Attribute.texcoords[2 * Index.texcoord_index + 0],
-                                                                    Attribute.texcoords[2 * Index.texcoord_index + 1]);
-                    }
+                        std::string MaterialLibraryPath = MaterialPaths[Counter];
 
-                    const tinyobj::material_t Material = Materials[Shape.mesh.material_ids[FaceIndex]];
-                    Vertex.Color =
-                        GCVector4_Create(Material.diffuse[0], Material.diffuse[1], Material.diffuse[2], 1.0f);
+                        if (!MaterialLibraryPath.empty() && MaterialLibraryPath.back() != '/' &&
+                            MaterialLibraryPath.back() != '\\')
+                        {
+                            MaterialLibraryPath += '/';
+                        }
 
-                    if (UniqueVertices.count(Vertex) == 0)
-                    {
-                        UniqueVertices[Vertex] = static_cast<uint32_t>(Vertices.size());
-                        Vertices.emplace_back(Vertex);
+                        MaterialLibraryPath.append(ModelData + NameStart, NameEnd - NameStart);
+
+                        Hash = GCRendererModel_HashFile(Hash, MaterialLibraryPath.c_str());
+
+                        MaterialLibraryPaths.emplace_back(MaterialLibraryPath);
                     }
 
-                    Indices.emplace_back(UniqueVertices[Vertex]);
+                    NameStart = NameEnd;
                 }
-
-                IndexOffset += Face;
             }
+
+            LineStart = LineEnd + 1;
         }
+
+        GCFileSystem_UnmapFile(ModelFile);
     }
 
-    Model->Vertices = static_cast<GCRendererVertex*>(GCMemory_Allocate(Vertices.size() * sizeof(GCRendererVertex)));
-    memcpy(Model->Vertices, Vertices.data(), Vertices.size() * sizeof(GCRendererVertex));
-    Model->VertexCount = static_cast<uint32_t>(Vertices.size());
+    return Hash;
+}
 
-    Model->Indices = static_cast<uint32_t*>(GCMemory_Allocate(Indices.size() * sizeof(uint32_t)));
-    memcpy(Model->Indices, Indices.data(), Indices.size() * sizeof(uint32_t));
-    Model->IndexCount = static_cast<uint32_t>(Indices.size());
+uint64_t GCRendererModel_HashData(uint64_t Hash, const void* const Data, const size_t Size)
+{
+    const uint8_t* const Bytes = static_cast<const uint8_t*>(Data);
+
+    for (size_t Counter = 0; Counter < Size; Counter++)
+    {
+        Hash ^= Bytes[Counter];
+        Hash *= 0x100000001B3u;
+    }
+
+    return Hash;
+}
+
+uint64_t GCRendererModel_HashFile(const uint64_t Hash, const char* const Path)
+{
+    GCFileSystemMappedFile* const MappedFile = GCFileSystem_MapFile(Path);
+
+    if (!MappedFile)
+    {
+        const uint64_t MissingFileSize = UINT64_MAX;
+
+        return GCRendererModel_HashData(Hash, &MissingFileSize, sizeof(MissingFileSize));
+    }
+
+    const uint64_t FileSize = GCFileSystemMappedFile_GetSize(MappedFile);
+
+    uint64_t FileHash = GCRendererModel_HashData(Hash, &FileSize, sizeof(FileSize));
+    FileHash = GCRendererModel_HashData(FileHash, GCFileSystemMappedFile_GetData(MappedFile), FileSize);
+
+    GCFileSystem_UnmapFile(MappedFile);
+
+    return FileHash;
+}
+
+uint64_t GCRendererModel_HashSourcePaths(const char* const* const ModelPaths, const char* const* const MaterialPaths,
+                                         const uint32_t ModelCount)
+{
+    const uint32_t FormatKey[2] = {GC_RENDERER_MODEL_FILE_VERSION, static_cast<uint32_t>(sizeof(GCRendererVertex))};
+
+    uint64_t Hash = GCRendererModel_HashData(0xCBF29CE484222325u, FormatKey, sizeof(FormatKey));
+
+    for (uint32_t Counter = 0; Counter < ModelCount; Counter++)
+    {
+        Hash = GCRendererModel_HashData(Hash, ModelPaths[Counter], strlen(ModelPaths[Counter]) + 1);
+        Hash = GCRendererModel_HashData(Hash, MaterialPaths[Counter], strlen(MaterialPaths[Counter]) + 1);
+    }
+
+    return Hash;
+}
+
+uint64_t GCRendererModel_StampSources(const char* const* const ModelPaths, const uint32_t ModelCount,
+                                      const std::vector<std::string>& MaterialLibraryPaths)
+{
+    uint64_t Stamp = 0xCBF29CE484222325u;
+
+    for (uint32_t Counter = 0; Counter < ModelCount; Counter++)
+    {
+        Stamp = GCRendererModel_StampFile(Stamp, ModelPaths[Counter]);
+    }
+
+    for (const std::string& MaterialLibraryPath : MaterialLibraryPaths)
+    {
+        Stamp = GCRendererModel_StampFile(Stamp, MaterialLibraryPath.c_str());
+    }
+
+    return Stamp;
+}
+
+uint64_t GCRendererModel_StampFile(const uint64_t Stamp, const char* const Path)
+{
+    const GCFileSystemFileAttributes FileAttributes = GCFileSystem_GetFileAttributes(Path);
+
+    uint64_t FileStamp = GCRendererModel_HashData(Stamp, Path, strlen(Path) + 1);
+    FileStamp = GCRendererModel_HashData(FileStamp, &FileAttributes.Size, sizeof(FileAttributes.Size));
+    FileStamp =
+        GCRendererModel_HashData(FileStamp, &FileAttributes.LastWriteTime, sizeof(FileAttributes.LastWriteTime));
+
+    return FileStamp;
+}
+
+bool GCRendererModel_LoadStampFile(const char* const Path, const char* const* const ModelPaths,
+                                   const uint32_t ModelCount, uint64_t* const SourceHash)
+{
+    GCFileSystemMappedFile* const MappedFile = GCFileSystem_MapFile(Path);
+
+    if (!MappedFile)
+    {
+        return false;
+    }
+
+    const char* const Data = static_cast<const char*>(GCFileSystemMappedFile_GetData(MappedFile));
+    const uint64_t DataSize = GCFileSystemMappedFile_GetSize(MappedFile);
+
+    const GCRendererModelStampFileHeader* const Header =
+        reinterpret_cast<const GCRendererModelStampFileHeader*>(Data);
+
+    bool IsStampValid = DataSize >= sizeof(GCRendererModelStampFileHeader) &&
+                        Header->Magic == GC_RENDERER_MODEL_STAMP_FILE_MAGIC &&
+                        Header->Version == GC_RENDERER_MODEL_FILE_VERSION &&
+                        Header->MaterialLibraryPathDataSize == DataSize - sizeof(GCRendererModelStampFileHeader);
+
+    if (IsStampValid)
+    {
+        std::vector<std::string> MaterialLibraryPaths{};
+        MaterialLibraryPaths.reserve(Header->MaterialLibraryPathCount);
+
+        const char* const PathData = Data + sizeof(GCRendererModelStampFileHeader);
+
+        for (uint32_t PathStart = 0; PathStart < Header->MaterialLibraryPathDataSize;)
+        {
+            const uint32_t PathLength = static_cast<uint32_t>(
+                strnlen(PathData + PathStart, Header->MaterialLibraryPathDataSize - PathStart));
+
+            MaterialLibraryPaths.emplace_back(PathData + PathStart, PathLength);
+
+            PathStart += PathLength + 1;
+        }
+
+        IsStampValid = MaterialLibraryPaths.size() == Header->MaterialLibraryPathCount &&
+                       GCRendererModel_StampSources(ModelPaths, ModelCount, MaterialLibraryPaths) ==
+                           Header->SourceStamp;
+
+        *SourceHash = Header->SourceHash;
+    }
+
+    GCFileSystem_UnmapFile(MappedFile);
+
+    return IsStampValid;
+}
+
+void GCRendererModel_WriteStampFile(const char* const Path, const char* const* const ModelPaths,
+                                    const uint32_t ModelCount, const std::vector<std::string>& MaterialLibraryPaths,
+                                    const uint64_t SourceHash)
+{
+    if (!GCFileSystem_Exists(GC_RENDERER_MODEL_CACHE_DIRECTORY))
+    {
+        GCFileSystem_CreateDirectories(GC_RENDERER_MODEL_CACHE_DIRECTORY);
+    }
+
+    GCRendererModelStampFileHeader Header{};
+    Header.Magic = GC_RENDERER_MODEL_STAMP_FILE_MAGIC;
+    Header.Version = GC_RENDERER_MODEL_FILE_VERSION;
+    Header.SourceStamp = GCRendererModel_StampSources(ModelPaths, ModelCount, MaterialLibraryPaths);
+    Header.SourceHash = SourceHash;
+    Header.MaterialLibraryPathCount = static_cast<uint32_t>(MaterialLibraryPaths.size());
+
+    for (const std::string& MaterialLibraryPath : MaterialLibraryPaths)
+    {
+        Header.MaterialLibraryPathDataSize += static_cast<uint32_t>(MaterialLibraryPath.size()) + 1;
+    }
+
+    const std::string TemporaryPath = std::string(Path) + "." + std::to_string(GCJobSystem_GetThreadIndex()) + ".tmp";
+
+    FILE* StampFile = fopen(TemporaryPath.c_str(), "wb");
+
+    if (!StampFile)
+    {
+        GC_LOG_WARNING("Failed to write a model stamp: %s", Path);
+
+        return;
+    }
+
+    fwrite(&Header, sizeof(GCRendererModelStampFileHeader), 1, StampFile);
+
+    for (const std::string& MaterialLibraryPath : MaterialLibraryPaths)
+    {
+        fwrite(MaterialLibraryPath.c_str(), 1, MaterialLibraryPath.size() + 1, StampFile);
+    }
+
+    const bool IsWritten = !ferror(StampFile);
+    fclose(StampFile);
+
+    remove(Path);
+
+    if (!IsWritten || rename(TemporaryPath.c_str(), Path) != 0)
+    {
+        GC_LOG_WARNING("Failed to write a model stamp: %s", Path);
+
+        remove(TemporaryPath.c_str());
+    }
+}
+
+GCRendererModel* GCRendererModel_LoadCookedFile(const char* const Path, const uint64_t SourceHash)
+{
+    GCFileSystemMappedFile* const MappedFile = GCFileSystem_MapFile(Path);
+
+    if (!MappedFile)
+    {
+        return nullptr;
+    }
+
+    uint8_t* const Data = static_cast<uint8_t*>(GCFileSystemMappedFile_GetData(MappedFile));
+    const uint64_t DataSize = GCFileSystemMappedFile_GetSize(MappedFile);
+
+    const GCRendererModelFileHeader* const Header = reinterpret_cast<const GCRendererModelFileHeader*>(Data);
+
+    const bool IsHeaderValid = DataSize >= sizeof(GCRendererModelFileHeader) &&
+                               Header->Magic == GC_RENDERER_MODEL_FILE_MAGIC &&
+                               Header->Version == GC_RENDERER_MODEL_FILE_VERSION &&
+                               Header->SourceHash == SourceHash && Header->VertexSize == sizeof(GCRendererVertex) &&
+                               Header->LODCount && Header->LODCount <= GC_RENDERER_MODEL_MAXIMUM_LOD_COUNT;
+
+    if (!IsHeaderValid || Header->VertexDataOffset > DataSize ||
+        static_cast<uint64_t>(Header->VertexCount) * sizeof(GCRendererVertex) > DataSize - Header->VertexDataOffset ||
+        Header->IndexDataOffset > DataSize ||
+        static_cast<uint64_t>(Header->IndexCount) * sizeof(uint32_t) > DataSize - Header->IndexDataOffset ||
+        !GCRendererModel_ValidateCookedGeometry(Header, Data))
+    {
+        GC_LOG_WARNING("Ignoring an outdated or corrupted cooked model: %s", Path);
+
+        GCFileSystem_UnmapFile(MappedFile);
+
+        return nullptr;
+    }
+
+    GCRendererModel* Model = static_cast<GCRendererModel*>(GCMemory_Allocate(sizeof(GCRendererModel)));
+    Model->Vertices = reinterpret_cast<GCRendererVertex*>(Data + Header->VertexDataOffset);
+    Model->VertexCount = Header->VertexCount;
+    Model->Indices = reinterpret_cast<uint32_t*>(Data + Header->IndexDataOffset);
+    Model->IndexCount = Header->IndexCount;
+    memcpy(Model->LODs, Header->LODs, sizeof(Model->LODs));
+    Model->LODCount = Header->LODCount;
+    Model->BoundingBox = Header->BoundingBox;
+    Model->BoundingSphere = Header->BoundingSphere;
+    Model->MappedFile = MappedFile;
 
     return Model;
 }
 
-void GCRendererModel_Destroy(GCRendererModel* Model)
+bool GCRendererModel_ValidateCookedGeometry(const GCRendererModelFileHeader* const Header, const uint8_t* const Data)
 {
-    GCMemory_Free(Model->Indices);
-    GCMemory_Free(Model->Vertices);
+    for (uint32_t Counter = 0; Counter < Header->LODCount; Counter++)
+    {
+        const GCRendererModelLOD* const LOD = &Header->LODs[Counter];
 
-    GCMemory_Free(Model);
+        if (static_cast<uint64_t>(LOD->FirstIndex) + LOD->IndexCount > Header->IndexCount)
+        {
+            return false;
+        }
+    }
+
+    const uint32_t* const Indices = reinterpret_cast<const uint32_t*>(Data + Header->IndexDataOffset);
+
+    for (uint32_t Counter = 0; Counter < Header->IndexCount; Counter++)
+    {
+        if (Indices[Counter] >= Header->VertexCount)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void GCRendererModel_WriteCookedFile(const GCRendererModel* const Model, const char* const Path,
+                                     const uint64_t SourceHash)
+{
+    if (!GCFileSystem_Exists(GC_RENDERER_MODEL_CACHE_DIRECTORY))
+    {
+        GCFileSystem_CreateDirectories(GC_RENDERER_MODEL_CACHE_DIRECTORY);
+    }
+
+    GCRendererModelFileHeader Header{};
+    Header.Magic = GC_RENDERER_MODEL_FILE_MAGIC;
+    Header.Version = GC_RENDERER_MODEL_FILE_VERSION;
+    Header.SourceHash = SourceHash;
+    Header.VertexSize = sizeof(GCRendererVertex);
+    Header.VertexCount = Model->VertexCount;
+    Header.IndexCount = Model->IndexCount;
+    memcpy(Header.LODs, Model->LODs, sizeof(Header.LODs));
+    Header.LODCount = Model->LODCount;
+    Header.BoundingBox = Model->BoundingBox;
+    Header.BoundingSphere = Model->BoundingSphere;
+    Header.VertexDataOffset = GCRendererModel_AlignFileOffset(sizeof(GCRendererModelFileHeader));
+    Header.IndexDataOffset = GCRendererModel_AlignFileOffset(
+        Header.VertexDataOffset + static_cast<uint64_t>(Model->VertexCount) * sizeof(GCRendererVertex));
+
+    const std::string TemporaryPath = std::string(Path) + "." + std::to_string(GCJobSystem_GetThreadIndex()) + ".tmp";
+
+    FILE* CookedFile = fopen(TemporaryPath.c_str(), "wb");
+
+    if (!CookedFile)
+    {
+        GC_LOG_WARNING("Failed to write a cooked model: %s", Path);
+
+        return;
+    }
+
+    const uint8_t Padding[GC_RENDERER_MODEL_FILE_ALIGNMENT] = {0};
+
+    fwrite(&Header, sizeof(GCRendererModelFileHeader), 1, CookedFile);
+    fwrite(Padding, 1, Header.VertexDataOffset - sizeof(GCRendererModelFileHeader), CookedFile);
+    fwrite(Model->Vertices, sizeof(GCRendererVertex), Model->VertexCount, CookedFile);
+    fwrite(Padding, 1,
+           Header.IndexDataOffset - Header.VertexDataOffset -
+               static_cast<uint64_t>(Model->VertexCount) * sizeof(GCRendererVertex),
+           CookedFile);
+    fwrite(Model->Indices, sizeof(uint32_t), Model->IndexCount, CookedFile);
+
+    const bool IsWritten = !ferror(CookedFile);
+    fclose(CookedFile);
+
+    remove(Path);
+
+    if (!IsWritten || rename(TemporaryPath.c_str(), Path) != 0)
+    {
+        GC_LOG_WARNING("Failed to write a cooked model: %s", Path);
+
+        remove(TemporaryPath.c_str());
+    }
+}
+
+uint64_t GCRendererModel_AlignFileOffset(const uint64_t Offset)
+{
+    const uint64_t AlignmentMask = GC_RENDERER_MODEL_FILE_ALIGNMENT - 1;
+
+    return (Offset + AlignmentMask) & ~AlignmentMask;
+}
+
+void GCRendererModel_GenerateLODs(GCRendererModel* const Model, const std::vector<GCRendererVertex>& Vertices,
+                                 std::vector<uint32_t>& Indices)
+{
+    Model->LODs[0].FirstIndex = 0;
+    Model->LODs[0].IndexCount = static_cast<uint32_t>(Indices.size());
+    Model->LODCount = 1;
+
+    GCRendererModelSimplifier* const ModelSimplifier = GCRendererModelSimplifier_Create(
+        Vertices.data(), static_cast<uint32_t>(Vertices.size()), Indices.data(), static_cast<uint32_t>(Indices.size()));
+
+    std::vector<uint32_t> LODIndices(Indices.size());
+
+    while (Model->LODCount < GC_RENDERER_MODEL_MAXIMUM_LOD_COUNT)
+    {
+        const GCRendererModelLOD& PreviousLOD = Model->LODs[Model->LODCount - 1];
+        const uint32_t TargetIndexCount = PreviousLOD.IndexCount / 6 * 3;
+
+        if (TargetIndexCount < GC_RENDERER_MODEL_MINIMUM_LOD_INDEX_COUNT)
+        {
+            break;
+        }
+
+        const uint32_t LODIndexCount =
+            GCRendererModelSimplifier_Simplify(ModelSimplifier, TargetIndexCount, LODIndices.data());
+
+        if (LODIndexCount > PreviousLOD.IndexCount * GC_RENDERER_MODEL_MAXIMUM_LOD_INDEX_RATIO)
+        {
+            break;
+        }
+
+        Model->LODs[Model->LODCount].FirstIndex = static_cast<uint32_t>(Indices.size());
+        Model->LODs[Model->LODCount].IndexCount = LODIndexCount;
+        Model->LODCount++;
+
+        Indices.insert(Indices.end(), LODIndices.cbegin(), LODIndices.cbegin() + LODIndexCount);
+    }
+
+    GCRendererModelSimplifier_Destroy(ModelSimplifier);
+}
+
+GCBoundingVolumeHierarchy* GCRendererModel_CreateBoundingVolumeHierarchy(const GCRendererModel* const Model)
+{
+    const GCRendererModelLOD& LOD = Model->LODs[0];
+    const uint32_t TriangleCount = LOD.IndexCount / 3;
+
+    std::vector<GCBoundingBox> TriangleBoundingBoxes(TriangleCount);
+
+    for (uint32_t Counter = 0; Counter < TriangleCount; Counter++)
+    {
+        const uint32_t* const Indices = &Model->Indices[LOD.FirstIndex + Counter * 3];
+        const GCVector3 Positions[3] = {Model->Vertices[Indices[0]].Position, Model->Vertices[Indices[1]].Position,
+                                        Model->Vertices[Indices[2]].Position};
+
+        TriangleBoundingBoxes[Counter] = GCBoundingBox_CreateFromPoints(Positions, 3, sizeof(GCVector3));
+    }
+
+    return GCBoundingVolumeHierarchy_Create(TriangleBoundingBoxes.data(), TriangleCount);
+}
+
+bool GCRendererModel_CastRayAgainstTriangle(void* const Context, const uint32_t TriangleIndex, const GCRay* const Ray,
+                                            const float MaximumDistance, float* const Distance)
+{
+    const GCRendererModel* const Model = static_cast<const GCRendererModel*>(Context);
+    const uint32_t* const Indices = &Model->Indices[Model->LODs[0].FirstIndex + TriangleIndex * 3];
+
+    return GCRay_IntersectsTriangle(Ray, Model->Vertices[Indices[0]].Position, Model->Vertices[Indices[1]].Position,
+                                    Model->Vertices[Indices[2]].Position, MaximumDistance, Distance);
 }
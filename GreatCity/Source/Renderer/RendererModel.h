@@ -18,8 +18,13 @@
 #ifndef GC_RENDERER_RENDERER_MODEL_H
 #define GC_RENDERER_RENDERER_MODEL_H
 
+#include "Math/BoundingVolume.h"
+
+#include <stdbool.h>
 #include <stdint.h>
 
+#define GC_RENDERER_MODEL_MAXIMUM_LOD_COUNT 4
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -27,9 +32,19 @@ extern "C"
 
     typedef struct GCRendererVertexBuffer GCRendererVertexBuffer;
     typedef struct GCRendererIndexBuffer GCRendererIndexBuffer;
+    typedef struct GCFileSystemMappedFile GCFileSystemMappedFile;
+    typedef struct GCRendererModelFuture GCRendererModelFuture;
+    typedef struct GCBoundingVolumeHierarchy GCBoundingVolumeHierarchy;
+    typedef struct GCRay GCRay;
 
     typedef struct GCRendererVertex GCRendererVertex;
 
+    typedef struct GCRendererModelLOD
+    {
+        uint32_t FirstIndex;
+        uint32_t IndexCount;
+    } GCRendererModelLOD;
+
     typedef struct GCRendererModel
     {
         GCRendererVertex* Vertices;
@@ -37,11 +52,29 @@ extern "C"
 
         uint32_t* Indices;
         uint32_t IndexCount;
+
+        GCRendererModelLOD LODs[GC_RENDERER_MODEL_MAXIMUM_LOD_COUNT];
+        uint32_t LODCount;
+
+        GCBoundingBox BoundingBox;
+        GCBoundingSphere BoundingSphere;
+        GCBoundingVolumeHierarchy* BoundingVolumeHierarchy;
+
+        GCFileSystemMappedFile* MappedFile;
     } GCRendererModel;
 
     GCRendererModel* GCRendererModel_CreateFromFile(const char* const ModelPath, const char* const MaterialPath);
     GCRendererModel* GCRendererModel_CreateFromFiles(const char* const* const ModelPaths,
                                                      const char* const* const MaterialPaths, const uint32_t ModelCount);
+    GCRendererModelFuture* GCRendererModel_CreateFromFileAsync(const char* const ModelPath,
+                                                               const char* const MaterialPath);
+    GCRendererModelFuture* GCRendererModel_CreateFromFilesAsync(const char* const* const ModelPaths,
+                                                                const char* const* const MaterialPaths,
+                                                                const uint32_t ModelCount);
+    bool GCRendererModelFuture_IsReady(const GCRendererModelFuture* const Future);
+    GCRendererModel* GCRendererModelFuture_Get(GCRendererModelFuture* Future);
+    bool GCRendererModel_CastRay(const GCRendererModel* const Model, const GCRay* const Ray,
+                                 const float MaximumDistance, float* const Distance);
     void GCRendererModel_Destroy(GCRendererModel* Model);
 
 #ifdef __cplusplus
@@ -0,0 +1,110 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Renderer/RendererModelImport.h"
+#include "Math/Vector2.h"
+#include "Math/Vector3.h"
+#include "Math/Vector4.h"
+#include "Renderer/Renderer.h"
+#include "Renderer/RendererModelVertexTable.h"
+
+#include <cstdint>
+#include <vector>
+
+#include <tiny_obj_loader.h>
+
+void GCRendererModelImport_WeldVertices(const tinyobj::ObjReader& Reader, std::vector<GCRendererVertex>& Vertices,
+                                        std::vector<uint32_t>& Indices)
+{
+    const tinyobj::attrib_t& Attribute = Reader.GetAttrib();
+    const std::vector<tinyobj::shape_t>& Shapes = Reader.GetShapes();
+    const std::vector<tinyobj::material_t>& Materials = Reader.GetMaterials();
+
+    uint32_t MaximumVertexCount = 0;
+
+    for (const tinyobj::shape_t& Shape : Shapes)
+    {
+        MaximumVertexCount += static_cast<uint32_t>(Shape.mesh.indices.size());
+    }
+
+    Vertices.reserve(MaximumVertexCount);
+    Indices.reserve(MaximumVertexCount);
+
+    GCRendererModelVertexTable* const VertexTable = GCRendererModelVertexTable_Create(MaximumVertexCount);
+
+    for (const tinyobj::shape_t& Shape : Shapes)
+    {
+        uint32_t IndexOffset = 0;
+
+        for (uint32_t FaceIndex = 0; FaceIndex < Shape.mesh.num_face_vertices.size(); FaceIndex++)
+        {
+            const uint32_t Face = Shape.mesh.num_face_vertices[FaceIndex];
+
+            for (uint32_t FaceVertex = 0; FaceVertex < Face; FaceVertex++)
+            {
+                const tinyobj::index_t Index = Shape.mesh.indices[IndexOffset + FaceVertex];
+
+                GCRendererModelVertexKey VertexKey{};
+                VertexKey.PositionIndex = Index.vertex_index;
+                VertexKey.NormalIndex = Index.normal_index;
+                VertexKey.TextureCoordinateIndex = Index.texcoord_index;
+                VertexKey.MaterialIndex = Shape.mesh.material_ids[FaceIndex];
+
+                uint32_t VertexIndex = 0;
+
+                if (GCRendererModelVertexTable_FindOrInsert(VertexTable, &VertexKey,
+                                                            static_cast<uint32_t>(Vertices.size()), &VertexIndex))
+                {
+                    GCRendererVertex Vertex{};
+
+                    if (Index.vertex_index >= 0)
+                    {
+                        Vertex.Position = GCVector3_Create(Attribute.vertices[3 * Index.vertex_index + 0],
+                                                           Attribute.vertices[3 * Index.vertex_index + 1],
+                                                           Attribute.vertices[3 * Index.vertex_index + 2]);
+                    }
+
+                    if (Index.normal_index >= 0)
+                    {
+                        Vertex.Normal = GCVector3_Create(Attribute.normals[3 * Index.normal_index + 0],
+                                                         Attribute.normals[3 * Index.normal_index + 1],
+                                                         Attribute.normals[3 * Index.normal_index + 2]);
+                    }
+
+                    if (Index.texcoord_index >= 0)
+                    {
+                        Vertex.TextureCoordinate =
+                            GCVector2_Create(Attribute.texcoords[2 * Index.texcoord_index + 0],
+                                             Attribute.texcoords[2 * Index.texcoord_index + 1]);
+                    }
+
+                    const tinyobj::material_t& Material = Materials[VertexKey.MaterialIndex];
+                    Vertex.Color =
+                        GCVector4_Create(Material.diffuse[0], Material.diffuse[1], Material.diffuse[2], 1.0f);
+
+                    Vertices.emplace_back(Vertex);
+                }
+
+                Indices.emplace_back(VertexIndex);
+            }
+
+            IndexOffset += Face;
+        }
+    }
+
+    GCRendererModelVertexTable_Destroy(VertexTable);
+}
@@ -0,0 +1,602 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Renderer/RendererModelSimplifier.h"
+#include "Math/Vector2.h"
+#include "Math/Vector3.h"
+#include "Math/Vector4.h"
+#include "Renderer/Renderer.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cstdint>
+#include <vector>
+
+#define GC_RENDERER_MODEL_SIMPLIFIER_BOUNDARY_WEIGHT 10.0
+#define GC_RENDERER_MODEL_SIMPLIFIER_MINIMUM_NORMAL_ALIGNMENT 0.25f
+#define GC_RENDERER_MODEL_SIMPLIFIER_MAXIMUM_COMMON_NEIGHBOR_COUNT 2
+#define GC_RENDERER_MODEL_SIMPLIFIER_REMOVED_TRIANGLE UINT32_MAX
+
+struct GCRendererModelSimplifierQuadric
+{
+    double A00, A01, A02, A11, A12, A22;
+    double B0, B1, B2;
+    double C;
+};
+
+struct GCRendererModelSimplifierCollapse
+{
+    uint32_t SourcePosition;
+    uint32_t DestinationPosition;
+    double Cost;
+};
+
+struct GCRendererModelSimplifier
+{
+    const GCRendererVertex* Vertices;
+
+    std::vector<GCVector3> Positions;
+    std::vector<uint32_t> VertexPositions;
+    std::vector<uint32_t> PositionVertexOffsets;
+    std::vector<uint32_t> PositionVertices;
+
+    std::vector<GCRendererModelSimplifierQuadric> Quadrics;
+    std::vector<uint32_t> Triangles;
+
+    std::vector<uint32_t> AdjacencyOffsets;
+    std::vector<uint32_t> AdjacentTriangles;
+    std::vector<uint32_t> SourceNeighbors;
+    std::vector<uint32_t> DestinationNeighbors;
+};
+
+static GCRendererModelSimplifierQuadric GCRendererModelSimplifier_CreatePlaneQuadric(const GCVector3 Normal,
+                                                                                     const GCVector3 Point,
+                                                                                     const double Weight);
+static void GCRendererModelSimplifier_AddQuadric(GCRendererModelSimplifierQuadric& Destination,
+                                                 const GCRendererModelSimplifierQuadric& Source);
+static double GCRendererModelSimplifier_EvaluateQuadric(const GCRendererModelSimplifierQuadric& Quadric,
+                                                        const GCVector3 Point);
+static uint64_t GCRendererModelSimplifier_CreateEdgeKey(const uint32_t Position1, const uint32_t Position2);
+static GCVector3 GCRendererModelSimplifier_GetTriangleNormal(const GCRendererModelSimplifier* const ModelSimplifier,
+                                                             const uint32_t* const Triangle,
+                                                             const uint32_t ReplacedPosition,
+                                                             const uint32_t ReplacementPosition);
+static void GCRendererModelSimplifier_BuildQuadrics(GCRendererModelSimplifier* const ModelSimplifier);
+static void GCRendererModelSimplifier_BuildAdjacency(GCRendererModelSimplifier* const ModelSimplifier);
+static uint32_t GCRendererModelSimplifier_CollapseEdges(GCRendererModelSimplifier* const ModelSimplifier,
+                                                        const uint32_t TargetTriangleCount);
+static bool GCRendererModelSimplifier_CanCollapse(GCRendererModelSimplifier* const ModelSimplifier,
+                                                  const uint32_t SourcePosition, const uint32_t DestinationPosition);
+static void GCRendererModelSimplifier_GetNeighbors(const GCRendererModelSimplifier* const ModelSimplifier,
+                                                   const uint32_t Position, std::vector<uint32_t>& Neighbors);
+static uint32_t GCRendererModelSimplifier_FindMatchingVertex(const GCRendererModelSimplifier* const ModelSimplifier,
+                                                             const uint32_t Vertex, const uint32_t Position);
+static void GCRendererModelSimplifier_RemoveDegenerateTriangles(GCRendererModelSimplifier* const ModelSimplifier);
+
+GCRendererModelSimplifier* GCRendererModelSimplifier_Create(const GCRendererVertex* const Vertices,
+                                                            const uint32_t VertexCount, const uint32_t* const Indices,
+                                                            const uint32_t IndexCount)
+{
+    GCRendererModelSimplifier* ModelSimplifier = new GCRendererModelSimplifier();
+    ModelSimplifier->Vertices = Vertices;
+
+    std::vector<uint32_t> SortedVertices(VertexCount);
+
+    for (uint32_t Counter = 0; Counter < VertexCount; Counter++)
+    {
+        SortedVertices[Counter] = Counter;
+    }
+
+    std::sort(SortedVertices.begin(), SortedVertices.end(), [Vertices](const uint32_t Vertex1, const uint32_t Vertex2) {
+        const GCVector3& Position1 = Vertices[Vertex1].Position;
+        const GCVector3& Position2 = Vertices[Vertex2].Position;
+
+        if (Position1.X != Position2.X)
+        {
+            return Position1.X < Position2.X;
+        }
+
+        if (Position1.Y != Position2.Y)
+        {
+            return Position1.Y < Position2.Y;
+        }
+
+        return Position1.Z < Position2.Z;
+    });
+
+    ModelSimplifier->VertexPositions.resize(VertexCount);
+
+    for (uint32_t Counter = 0; Counter < VertexCount; Counter++)
+    {
+        const uint32_t Vertex = SortedVertices[Counter];
+
+        if (!Counter || !GCVector3_IsEqual(Vertices[Vertex].Position, Vertices[SortedVertices[Counter - 1]].Position))
+        {
+            ModelSimplifier->Positions.emplace_back(Vertices[Vertex].Position);
+            ModelSimplifier->PositionVertexOffsets.emplace_back(Counter);
+        }
+
+        ModelSimplifier->VertexPositions[Vertex] = static_cast<uint32_t>(ModelSimplifier->Positions.size() - 1);
+    }
+
+    ModelSimplifier->PositionVertexOffsets.emplace_back(VertexCount);
+    ModelSimplifier->PositionVertices = std::move(SortedVertices);
+
+    ModelSimplifier->Triangles.assign(Indices, Indices + IndexCount);
+
+    GCRendererModelSimplifier_RemoveDegenerateTriangles(ModelSimplifier);
+    GCRendererModelSimplifier_BuildQuadrics(ModelSimplifier);
+
+    return ModelSimplifier;
+}
+
+uint32_t GCRendererModelSimplifier_Simplify(GCRendererModelSimplifier* const ModelSimplifier,
+                                            const uint32_t TargetIndexCount, uint32_t* const Indices)
+{
+    const uint32_t TargetTriangleCount = TargetIndexCount / 3;
+
+    while (ModelSimplifier->Triangles.size() / 3 > TargetTriangleCount)
+    {
+        if (!GCRendererModelSimplifier_CollapseEdges(ModelSimplifier, TargetTriangleCount))
+        {
+            break;
+        }
+    }
+
+    std::copy(ModelSimplifier->Triangles.cbegin(), ModelSimplifier->Triangles.cend(), Indices);
+
+    return static_cast<uint32_t>(ModelSimplifier->Triangles.size());
+}
+
+void GCRendererModelSimplifier_Destroy(GCRendererModelSimplifier* ModelSimplifier)
+{
+    delete ModelSimplifier;
+}
+
+GCRendererModelSimplifierQuadric GCRendererModelSimplifier_CreatePlaneQuadric(const GCVector3 Normal,
+                                                                              const GCVector3 Point,
+                                                                              const double Weight)
+{
+    const double X = Normal.X, Y = Normal.Y, Z = Normal.Z;
+    const double D = -static_cast<double>(GCVector3_Dot(Normal, Point));
+
+    GCRendererModelSimplifierQuadric Quadric{};
+    Quadric.A00 = Weight * X * X;
+    Quadric.A01 = Weight * X * Y;
+    Quadric.A02 = Weight * X * Z;
+    Quadric.A11 = Weight * Y * Y;
+    Quadric.A12 = Weight * Y * Z;
+    Quadric.A22 = Weight * Z * Z;
+    Quadric.B0 = Weight * D * X;
+    Quadric.B1 = Weight * D * Y;
+    Quadric.B2 = Weight * D * Z;
+    Quadric.C = Weight * D * D;
+
+    return Quadric;
+}
+
+void GCRendererModelSimplifier_AddQuadric(GCRendererModelSimplifierQuadric& Destination,
+                                          const GCRendererModelSimplifierQuadric& Source)
+{
+    Destination.A00 += Source.A00;
+    Destination.A01 += Source.A01;
+    Destination.A02 += Source.A02;
+    Destination.A11 += Source.A11;
+    Destination.A12 += Source.A12;
+    Destination.A22 += Source.A22;
+    Destination.B0 += Source.B0;
+    Destination.B1 += Source.B1;
+    Destination.B2 += Source.B2;
+    Destination.C += Source.C;
+}
+
+double GCRendererModelSimplifier_EvaluateQuadric(const GCRendererModelSimplifierQuadric& Quadric,
+                                                 const GCVector3 Point)
+{
+    const double X = Point.X, Y = Point.Y, Z = Point.Z;
+
+    const double Error = X * (Quadric.A00 * X + Quadric.A01 * Y + Quadric.A02 * Z) +
+                         Y * (Quadric.A01 * X + Quadric.A11 * Y + Quadric.A12 * Z) +
+                         Z * (Quadric.A02 * X + Quadric.A12 * Y + Quadric.A22 * Z) +
+                         2.0 * (Quadric.B0 * X + Quadric.B1 * Y + Quadric.B2 * Z) + Quadric.C;
+
+    return std::max(Error, 0.0);
+}
+
+uint64_t GCRendererModelSimplifier_CreateEdgeKey(const uint32_t Position1, const uint32_t Position2)
+{
+    return (static_cast<uint64_t>(std::min(Position1, Position2)) << 32) | std::max(Position1, Position2);
+}
+
+GCVector3 GCRendererModelSimplifier_GetTriangleNormal(const GCRendererModelSimplifier* const ModelSimplifier,
+                                                      const uint32_t* const Triangle, const uint32_t ReplacedPosition,
+                                                      const uint32_t ReplacementPosition)
+{
+    GCVector3 Positions[3]{};
+
+    for (uint32_t Corner = 0; Corner < 3; Corner++)
+    {
+        const uint32_t Position = ModelSimplifier->VertexPositions[Triangle[Corner]];
+        Positions[Corner] = ModelSimplifier->Positions[Position == ReplacedPosition ? ReplacementPosition : Position];
+    }
+
+    return GCVector3_Cross(GCVector3_Subtract(Positions[1], Positions[0]),
+                           GCVector3_Subtract(Positions[2], Positions[0]));
+}
+
+void GCRendererModelSimplifier_BuildQuadrics(GCRendererModelSimplifier* const ModelSimplifier)
+{
+    const uint32_t TriangleCount = static_cast<uint32_t>(ModelSimplifier->Triangles.size() / 3);
+
+    ModelSimplifier->Quadrics.assign(ModelSimplifier->Positions.size(), GCRendererModelSimplifierQuadric{});
+
+    std::vector<uint64_t> Edges{};
+    Edges.reserve(ModelSimplifier->Triangles.size());
+
+    for (uint32_t Counter = 0; Counter < TriangleCount * 3; Counter++)
+    {
+        const uint32_t Corner = Counter % 3;
+        const uint32_t* const Triangle = &ModelSimplifier->Triangles[Counter - Corner];
+
+        Edges.emplace_back(GCRendererModelSimplifier_CreateEdgeKey(
+            ModelSimplifier->VertexPositions[Triangle[Corner]],
+            ModelSimplifier->VertexPositions[Triangle[(Corner + 1) % 3]]));
+    }
+
+    std::sort(Edges.begin(), Edges.end());
+
+    for (uint32_t Counter = 0; Counter < TriangleCount; Counter++)
+    {
+        const uint32_t* const Triangle = &ModelSimplifier->Triangles[Counter * 3];
+
+        const GCVector3 Normal = GCRendererModelSimplifier_GetTriangleNormal(ModelSimplifier, Triangle, UINT32_MAX, 0);
+        const float NormalMagnitude = GCVector3_Magnitude(Normal);
+
+        if (NormalMagnitude <= 0.0f)
+        {
+            continue;
+        }
+
+        const GCVector3 UnitNormal = GCVector3_DivideByScalar(Normal, NormalMagnitude);
+        const GCRendererModelSimplifierQuadric Quadric = GCRendererModelSimplifier_CreatePlaneQuadric(
+            UnitNormal, ModelSimplifier->Positions[ModelSimplifier->VertexPositions[Triangle[0]]],
+            NormalMagnitude * 0.5);
+
+        for (uint32_t Corner = 0; Corner < 3; Corner++)
+        {
+            const uint32_t Position1 = ModelSimplifier->VertexPositions[Triangle[Corner]];
+            const uint32_t Position2 = ModelSimplifier->VertexPositions[Triangle[(Corner + 1) % 3]];
+
+            GCRendererModelSimplifier_AddQuadric(ModelSimplifier->Quadrics[Position1], Quadric);
+
+            const uint64_t EdgeKey = GCRendererModelSimplifier_CreateEdgeKey(Position1, Position2);
+
+            if (std::upper_bound(Edges.cbegin(), Edges.cend(), EdgeKey) -
+                    std::lower_bound(Edges.cbegin(), Edges.cend(), EdgeKey) !=
+                1)
+            {
+                continue;
+            }
+
+            const GCVector3 Edge =
+                GCVector3_Subtract(ModelSimplifier->Positions[Position2], ModelSimplifier->Positions[Position1]);
+            const GCVector3 BoundaryNormal = GCVector3_Cross(Edge, UnitNormal);
+            const float BoundaryNormalMagnitude = GCVector3_Magnitude(BoundaryNormal);
+
+            if (BoundaryNormalMagnitude <= 0.0f)
+            {
+                continue;
+            }
+
+            const GCRendererModelSimplifierQuadric BoundaryQuadric = GCRendererModelSimplifier_CreatePlaneQuadric(
+                GCVector3_DivideByScalar(BoundaryNormal, BoundaryNormalMagnitude),
+                ModelSimplifier->Positions[Position1],
+                GCVector3_Dot(Edge, Edge) * GC_RENDERER_MODEL_SIMPLIFIER_BOUNDARY_WEIGHT);
+
+            GCRendererModelSimplifier_AddQuadric(ModelSimplifier->Quadrics[Position1], BoundaryQuadric);
+            GCRendererModelSimplifier_AddQuadric(ModelSimplifier->Quadrics[Position2], BoundaryQuadric);
+        }
+    }
+}
+
+void GCRendererModelSimplifier_BuildAdjacency(GCRendererModelSimplifier* const ModelSimplifier)
+{
+    const uint32_t TriangleCount = static_cast<uint32_t>(ModelSimplifier->Triangles.size() / 3);
+
+    ModelSimplifier->AdjacencyOffsets.assign(ModelSimplifier->Positions.size() + 1, 0);
+    ModelSimplifier->AdjacentTriangles.resize(ModelSimplifier->Triangles.size());
+
+    for (const uint32_t Vertex : ModelSimplifier->Triangles)
+    {
+        ModelSimplifier->AdjacencyOffsets[ModelSimplifier->VertexPositions[Vertex] + 1]++;
+    }
+
+    for (uint32_t Counter = 1; Counter < static_cast<uint32_t>(ModelSimplifier->AdjacencyOffsets.size()); Counter++)
+    {
+        ModelSimplifier->AdjacencyOffsets[Counter] += ModelSimplifier->AdjacencyOffsets[Counter - 1];
+    }
+
+    std::vector<uint32_t> AdjacencyCursors(ModelSimplifier->AdjacencyOffsets.cbegin(),
+                                           ModelSimplifier->AdjacencyOffsets.cend() - 1);
+
+    for (uint32_t Counter = 0; Counter < TriangleCount * 3; Counter++)
+    {
+        const uint32_t Position = ModelSimplifier->VertexPositions[ModelSimplifier->Triangles[Counter]];
+        ModelSimplifier->AdjacentTriangles[AdjacencyCursors[Position]++] = Counter / 3;
+    }
+}
+
+uint32_t GCRendererModelSimplifier_CollapseEdges(GCRendererModelSimplifier* const ModelSimplifier,
+                                                 const uint32_t TargetTriangleCount)
+{
+    GCRendererModelSimplifier_BuildAdjacency(ModelSimplifier);
+
+    std::vector<uint64_t> Edges{};
+    Edges.reserve(ModelSimplifier->Triangles.size());
+
+    for (uint32_t Counter = 0; Counter < static_cast<uint32_t>(ModelSimplifier->Triangles.size()); Counter++)
+    {
+        const uint32_t Corner = Counter % 3;
+        const uint32_t* const Triangle = &ModelSimplifier->Triangles[Counter - Corner];
+
+        Edges.emplace_back(GCRendererModelSimplifier_CreateEdgeKey(
+            ModelSimplifier->VertexPositions[Triangle[Corner]],
+            ModelSimplifier->VertexPositions[Triangle[(Corner + 1) % 3]]));
+    }
+
+    std::sort(Edges.begin(), Edges.end());
+    Edges.erase(std::unique(Edges.begin(), Edges.end()), Edges.end());
+
+    if (Edges.empty())
+    {
+        return 0;
+    }
+
+    std::vector<GCRendererModelSimplifierCollapse> Collapses(Edges.size());
+
+    for (uint32_t Counter = 0; Counter < static_cast<uint32_t>(Edges.size()); Counter++)
+    {
+        const uint32_t Position1 = static_cast<uint32_t>(Edges[Counter] >> 32);
+        const uint32_t Position2 = static_cast<uint32_t>(Edges[Counter] & UINT32_MAX);
+
+        GCRendererModelSimplifierQuadric Quadric = ModelSimplifier->Quadrics[Position1];
+        GCRendererModelSimplifier_AddQuadric(Quadric, ModelSimplifier->Quadrics[Position2]);
+
+        const double CostToPosition1 =
+            GCRendererModelSimplifier_EvaluateQuadric(Quadric, ModelSimplifier->Positions[Position1]);
+        const double CostToPosition2 =
+            GCRendererModelSimplifier_EvaluateQuadric(Quadric, ModelSimplifier->Positions[Position2]);
+
+        Collapses[Counter] = CostToPosition2 <= CostToPosition1
+                                 ? GCRendererModelSimplifierCollapse{Position1, Position2, CostToPosition2}
+                                 : GCRendererModelSimplifierCollapse{Position2, Position1, CostToPosition1};
+    }
+
+    std::sort(Collapses.begin(), Collapses.end(),
+              [](const GCRendererModelSimplifierCollapse& Collapse1, const GCRendererModelSimplifierCollapse& Collapse2) {
+                  return Collapse1.Cost < Collapse2.Cost;
+              });
+
+    uint32_t TriangleCount = static_cast<uint32_t>(ModelSimplifier->Triangles.size() / 3);
+
+    const uint32_t CollapseGoal =
+        std::min(static_cast<uint32_t>(Collapses.size()) - 1, std::max((TriangleCount - TargetTriangleCount) / 2, 1u));
+    const double CostLimit = Collapses[CollapseGoal].Cost;
+
+    std::vector<uint8_t> IsPositionLocked(ModelSimplifier->Positions.size(), 0);
+    uint32_t CollapseCount = 0;
+
+    for (const GCRendererModelSimplifierCollapse& Collapse : Collapses)
+    {
+        if (TriangleCount <= TargetTriangleCount || (Collapse.Cost > CostLimit && CollapseCount))
+        {
+            break;
+        }
+
+        if (IsPositionLocked[Collapse.SourcePosition] || IsPositionLocked[Collapse.DestinationPosition] ||
+            !GCRendererModelSimplifier_CanCollapse(ModelSimplifier, Collapse.SourcePosition,
+                                                   Collapse.DestinationPosition))
+        {
+            continue;
+        }
+
+        for (uint32_t Counter = ModelSimplifier->AdjacencyOffsets[Collapse.SourcePosition];
+             Counter < ModelSimplifier->AdjacencyOffsets[Collapse.SourcePosition + 1]; Counter++)
+        {
+            uint32_t* const Triangle = &ModelSimplifier->Triangles[ModelSimplifier->AdjacentTriangles[Counter] * 3];
+
+            if (Triangle[0] == GC_RENDERER_MODEL_SIMPLIFIER_REMOVED_TRIANGLE)
+            {
+                continue;
+            }
+
+            bool HasDestinationPosition = false;
+
+            for (uint32_t Corner = 0; Corner < 3; Corner++)
+            {
+                const uint32_t Position = ModelSimplifier->VertexPositions[Triangle[Corner]];
+
+                IsPositionLocked[Position] = 1;
+                HasDestinationPosition |= Position == Collapse.DestinationPosition;
+            }
+
+            if (HasDestinationPosition)
+            {
+                Triangle[0] = GC_RENDERER_MODEL_SIMPLIFIER_REMOVED_TRIANGLE;
+                TriangleCount--;
+
+                continue;
+            }
+
+            for (uint32_t Corner = 0; Corner < 3; Corner++)
+            {
+                if (ModelSimplifier->VertexPositions[Triangle[Corner]] == Collapse.SourcePosition)
+                {
+                    Triangle[Corner] = GCRendererModelSimplifier_FindMatchingVertex(ModelSimplifier, Triangle[Corner],
+                                                                                    Collapse.DestinationPosition);
+                }
+            }
+        }
+
+        GCRendererModelSimplifier_AddQuadric(ModelSimplifier->Quadrics[Collapse.DestinationPosition],
+                                             ModelSimplifier->Quadrics[Collapse.SourcePosition]);
+
+        CollapseCount++;
+    }
+
+    GCRendererModelSimplifier_RemoveDegenerateTriangles(ModelSimplifier);
+
+    return CollapseCount;
+}
+
+bool GCRendererModelSimplifier_CanCollapse(GCRendererModelSimplifier* const ModelSimplifier,
+                                           const uint32_t SourcePosition, const uint32_t DestinationPosition)
+{
+    GCRendererModelSimplifier_GetNeighbors(ModelSimplifier, SourcePosition, ModelSimplifier->SourceNeighbors);
+    GCRendererModelSimplifier_GetNeighbors(ModelSimplifier, DestinationPosition,
+                                           ModelSimplifier->DestinationNeighbors);
+
+    uint32_t CommonNeighborCount = 0;
+
+    for (const uint32_t Neighbor : ModelSimplifier->SourceNeighbors)
+    {
+        if (std::binary_search(ModelSimplifier->DestinationNeighbors.cbegin(),
+                               ModelSimplifier->DestinationNeighbors.cend(), Neighbor))
+        {
+            CommonNeighborCount++;
+        }
+    }
+
+    if (CommonNeighborCount > GC_RENDERER_MODEL_SIMPLIFIER_MAXIMUM_COMMON_NEIGHBOR_COUNT)
+    {
+        return false;
+    }
+
+    for (uint32_t Counter = ModelSimplifier->AdjacencyOffsets[SourcePosition];
+         Counter < ModelSimplifier->AdjacencyOffsets[SourcePosition + 1]; Counter++)
+    {
+        const uint32_t* const Triangle = &ModelSimplifier->Triangles[ModelSimplifier->AdjacentTriangles[Counter] * 3];
+
+        if (ModelSimplifier->VertexPositions[Triangle[0]] == DestinationPosition ||
+            ModelSimplifier->VertexPositions[Triangle[1]] == DestinationPosition ||
+            ModelSimplifier->VertexPositions[Triangle[2]] == DestinationPosition)
+        {
+            continue;
+        }
+
+        const GCVector3 Normal = GCRendererModelSimplifier_GetTriangleNormal(ModelSimplifier, Triangle, UINT32_MAX, 0);
+        const GCVector3 CollapsedNormal =
+            GCRendererModelSimplifier_GetTriangleNormal(ModelSimplifier, Triangle, SourcePosition, DestinationPosition);
+
+        if (GCVector3_Dot(Normal, CollapsedNormal) <= GC_RENDERER_MODEL_SIMPLIFIER_MINIMUM_NORMAL_ALIGNMENT *
+                                                          GCVector3_Magnitude(Normal) *
+                                                          GCVector3_Magnitude(CollapsedNormal))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void GCRendererModelSimplifier_GetNeighbors(const GCRendererModelSimplifier* const ModelSimplifier,
+                                            const uint32_t Position, std::vector<uint32_t>& Neighbors)
+{
+    Neighbors.clear();
+
+    for (uint32_t Counter = ModelSimplifier->AdjacencyOffsets[Position];
+         Counter < ModelSimplifier->AdjacencyOffsets[Position + 1]; Counter++)
+    {
+        const uint32_t* const Triangle = &ModelSimplifier->Triangles[ModelSimplifier->AdjacentTriangles[Counter] * 3];
+
+        for (uint32_t Corner = 0; Corner < 3; Corner++)
+        {
+            const uint32_t NeighborPosition = ModelSimplifier->VertexPositions[Triangle[Corner]];
+
+            if (NeighborPosition != Position)
+            {
+                Neighbors.emplace_back(NeighborPosition);
+            }
+        }
+    }
+
+    std::sort(Neighbors.begin(), Neighbors.end());
+    Neighbors.erase(std::unique(Neighbors.begin(), Neighbors.end()), Neighbors.end());
+}
+
+uint32_t GCRendererModelSimplifier_FindMatchingVertex(const GCRendererModelSimplifier* const ModelSimplifier,
+                                                      const uint32_t Vertex, const uint32_t Position)
+{
+    const GCRendererVertex& ReferenceVertex = ModelSimplifier->Vertices[Vertex];
+
+    uint32_t MatchingVertex = ModelSimplifier->PositionVertices[ModelSimplifier->PositionVertexOffsets[Position]];
+    float MatchingDistance = FLT_MAX;
+
+    for (uint32_t Counter = ModelSimplifier->PositionVertexOffsets[Position];
+         Counter < ModelSimplifier->PositionVertexOffsets[Position + 1]; Counter++)
+    {
+        const GCRendererVertex& CandidateVertex = ModelSimplifier->Vertices[ModelSimplifier->PositionVertices[Counter]];
+
+        const GCVector3 NormalDifference = GCVector3_Subtract(ReferenceVertex.Normal, CandidateVertex.Normal);
+        const GCVector4 ColorDifference = GCVector4_Subtract(ReferenceVertex.Color, CandidateVertex.Color);
+        const GCVector2 TextureCoordinateDifference =
+            GCVector2_Subtract(ReferenceVertex.TextureCoordinate, CandidateVertex.TextureCoordinate);
+
+        const float Distance = GCVector3_Dot(NormalDifference, NormalDifference) +
+                               GCVector4_Dot(ColorDifference, ColorDifference) +
+                               GCVector2_Dot(TextureCoordinateDifference, TextureCoordinateDifference);
+
+        if (Distance < MatchingDistance)
+        {
+            MatchingVertex = ModelSimplifier->PositionVertices[Counter];
+            MatchingDistance = Distance;
+        }
+    }
+
+    return MatchingVertex;
+}
+
+void GCRendererModelSimplifier_RemoveDegenerateTriangles(GCRendererModelSimplifier* const ModelSimplifier)
+{
+    uint32_t TriangleCount = 0;
+
+    for (uint32_t Counter = 0; Counter < static_cast<uint32_t>(ModelSimplifier->Triangles.size()); Counter += 3)
+    {
+        const uint32_t* const Triangle = &ModelSimplifier->Triangles[Counter];
+
+        if (Triangle[0] == GC_RENDERER_MODEL_SIMPLIFIER_REMOVED_TRIANGLE)
+        {
+            continue;
+        }
+
+        const uint32_t Position0 = ModelSimplifier->VertexPositions[Triangle[0]];
+        const uint32_t Position1 = ModelSimplifier->VertexPositions[Triangle[1]];
+        const uint32_t Position2 = ModelSimplifier->VertexPositions[Triangle[2]];
+
+        if (Position0 == Position1 || Position1 == Position2 || Position2 == Position0)
+        {
+            continue;
+        }
+
+        ModelSimplifier->Triangles[TriangleCount * 3 + 0] = Triangle[0];
+        ModelSimplifier->Triangles[TriangleCount * 3 + 1] = Triangle[1];
+        ModelSimplifier->Triangles[TriangleCount * 3 + 2] = Triangle[2];
+        TriangleCount++;
+    }
+
+    ModelSimplifier->Triangles.resize(TriangleCount * 3);
+}
@@ -0,0 +1,44 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GC_RENDERER_RENDERER_MODEL_SIMPLIFIER_H
+#define GC_RENDERER_RENDERER_MODEL_SIMPLIFIER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct GCRendererVertex GCRendererVertex;
+
+    typedef struct GCRendererModelSimplifier GCRendererModelSimplifier;
+
+    GCRendererModelSimplifier* GCRendererModelSimplifier_Create(const GCRendererVertex* const Vertices,
+                                                                const uint32_t VertexCount,
+                                                                const uint32_t* const Indices,
+                                                                const uint32_t IndexCount);
+    uint32_t GCRendererModelSimplifier_Simplify(GCRendererModelSimplifier* const ModelSimplifier,
+                                                const uint32_t TargetIndexCount, uint32_t* const Indices);
+    void GCRendererModelSimplifier_Destroy(GCRendererModelSimplifier* ModelSimplifier);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
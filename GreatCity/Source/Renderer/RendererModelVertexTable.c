@@ -0,0 +1,105 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Renderer/RendererModelVertexTable.h"
+#include "Core/Memory/Allocator.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#define GC_RENDERER_MODEL_VERTEX_TABLE_EMPTY_SLOT UINT32_MAX
+
+typedef struct GCRendererModelVertexTable
+{
+    GCRendererModelVertexKey* Keys;
+    uint32_t* Indices;
+    uint32_t CapacityMask;
+} GCRendererModelVertexTable;
+
+static uint32_t GCRendererModelVertexTable_Hash(const GCRendererModelVertexKey* const Key);
+
+GCRendererModelVertexTable* GCRendererModelVertexTable_Create(const uint32_t MaximumVertexCount)
+{
+    uint32_t Capacity = 16;
+
+    while (Capacity < MaximumVertexCount + MaximumVertexCount / 2)
+    {
+        Capacity *= 2;
+    }
+
+    GCRendererModelVertexTable* VertexTable =
+        (GCRendererModelVertexTable*)GCMemory_Allocate(sizeof(GCRendererModelVertexTable));
+    VertexTable->Keys = (GCRendererModelVertexKey*)GCMemory_Allocate(Capacity * sizeof(GCRendererModelVertexKey));
+    VertexTable->Indices = (uint32_t*)GCMemory_Allocate(Capacity * sizeof(uint32_t));
+    VertexTable->CapacityMask = Capacity - 1;
+
+    memset(VertexTable->Indices, 0xFF, Capacity * sizeof(uint32_t));
+
+    return VertexTable;
+}
+
+bool GCRendererModelVertexTable_FindOrInsert(GCRendererModelVertexTable* const VertexTable,
+                                             const GCRendererModelVertexKey* const Key, const uint32_t NewIndex,
+                                             uint32_t* const Index)
+{
+    uint32_t Slot = GCRendererModelVertexTable_Hash(Key) & VertexTable->CapacityMask;
+
+    while (VertexTable->Indices[Slot] != GC_RENDERER_MODEL_VERTEX_TABLE_EMPTY_SLOT)
+    {
+        const GCRendererModelVertexKey* const SlotKey = &VertexTable->Keys[Slot];
+
+        if (SlotKey->PositionIndex == Key->PositionIndex && SlotKey->NormalIndex == Key->NormalIndex &&
+            SlotKey->TextureCoordinateIndex == Key->TextureCoordinateIndex &&
+            SlotKey->MaterialIndex == Key->MaterialIndex)
+        {
+            *Index = VertexTable->Indices[Slot];
+
+            return false;
+        }
+
+        Slot = (Slot + 1) & VertexTable->CapacityMask;
+    }
+
+    VertexTable->Keys[Slot] = *Key;
+    VertexTable->Indices[Slot] = NewIndex;
+
+    *Index = NewIndex;
+
+    return true;
+}
+
+void GCRendererModelVertexTable_Destroy(GCRendererModelVertexTable* VertexTable)
+{
+    GCMemory_Free(VertexTable->Indices);
+    GCMemory_Free(VertexTable->Keys);
+
+    GCMemory_Free(VertexTable);
+}
+
+uint32_t GCRendererModelVertexTable_Hash(const GCRendererModelVertexKey* const Key)
+{
+    uint64_t Hash = (uint64_t)(uint32_t)Key->PositionIndex * 0x9E3779B97F4A7C15u;
+    Hash ^= (uint64_t)(uint32_t)Key->NormalIndex * 0xC2B2AE3D27D4EB4Fu;
+    Hash ^= (uint64_t)(uint32_t)Key->TextureCoordinateIndex * 0x165667B19E3779F9u;
+    Hash ^= (uint64_t)(uint32_t)Key->MaterialIndex * 0x27D4EB2F165667C5u;
+    Hash ^= Hash >> 33;
+    Hash *= 0xFF51AFD7ED558CCDu;
+    Hash ^= Hash >> 33;
+
+    return (uint32_t)Hash;
+}
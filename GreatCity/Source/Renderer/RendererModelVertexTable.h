@@ -0,0 +1,49 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GC_RENDERER_RENDERER_MODEL_VERTEX_TABLE_H
+#define GC_RENDERER_RENDERER_MODEL_VERTEX_TABLE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct GCRendererModelVertexKey
+    {
+        int32_t PositionIndex;
+        int32_t NormalIndex;
+        int32_t TextureCoordinateIndex;
+        int32_t MaterialIndex;
+    } GCRendererModelVertexKey;
+
+    typedef struct GCRendererModelVertexTable GCRendererModelVertexTable;
+
+    GCRendererModelVertexTable* GCRendererModelVertexTable_Create(const uint32_t MaximumVertexCount);
+    bool GCRendererModelVertexTable_FindOrInsert(GCRendererModelVertexTable* const VertexTable,
+                                                 const GCRendererModelVertexKey* const Key, const uint32_t NewIndex,
+                                                 uint32_t* const Index);
+    void GCRendererModelVertexTable_Destroy(GCRendererModelVertexTable* VertexTable);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
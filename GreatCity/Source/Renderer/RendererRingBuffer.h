@@ -0,0 +1,68 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GC_RENDERER_RENDERER_RING_BUFFER_H
+#define GC_RENDERER_RENDERER_RING_BUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct GCRendererRingBuffer GCRendererRingBuffer;
+    typedef struct GCRendererDevice GCRendererDevice;
+    typedef struct GCRendererCommandList GCRendererCommandList;
+
+    typedef enum GCRendererRingBufferFlags
+    {
+        GCRendererRingBufferFlags_None = 0,
+        GCRendererRingBufferFlags_Uniform = 1 << 0,
+        GCRendererRingBufferFlags_Storage = 1 << 1,
+        GCRendererRingBufferFlags_Vertex = 1 << 2
+    } GCRendererRingBufferFlags;
+
+    typedef struct GCRendererRingBufferDescription
+    {
+        const GCRendererDevice* Device;
+        const GCRendererCommandList* CommandList;
+
+        GCRendererRingBufferFlags Flags;
+        size_t FrameSize;
+    } GCRendererRingBufferDescription;
+
+    typedef struct GCRendererRingBufferAllocation
+    {
+        void* Data;
+        uint32_t Offset;
+    } GCRendererRingBufferAllocation;
+
+    GCRendererRingBuffer* GCRendererRingBuffer_Create(const GCRendererRingBufferDescription* const Description);
+    void GCRendererRingBuffer_BeginFrame(GCRendererRingBuffer* const RingBuffer);
+    GCRendererRingBufferAllocation GCRendererRingBuffer_Allocate(GCRendererRingBuffer* const RingBuffer,
+                                                                 const size_t Size);
+    size_t GCRendererRingBuffer_GetFrameSize(const GCRendererRingBuffer* const RingBuffer);
+    size_t GCRendererRingBuffer_GetFrameUsedSize(const GCRendererRingBuffer* const RingBuffer);
+    void GCRendererRingBuffer_Destroy(GCRendererRingBuffer* RingBuffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
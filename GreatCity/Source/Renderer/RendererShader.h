@@ -31,6 +31,7 @@ extern "C"
         const GCRendererDevice* Device;
         const char* VertexShaderPath;
         const char* FragmentShaderPath;
+        const char* ComputeShaderPath;
     } GCRendererShaderDescription;
 
     GCRendererShader* GCRendererShader_Create(const GCRendererShaderDescription* const Description);
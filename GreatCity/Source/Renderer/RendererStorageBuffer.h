@@ -0,0 +1,60 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef GC_RENDERER_RENDERER_STORAGE_BUFFER_H
+#define GC_RENDERER_RENDERER_STORAGE_BUFFER_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct GCRendererStorageBuffer GCRendererStorageBuffer;
+    typedef struct GCRendererDevice GCRendererDevice;
+    typedef struct GCRendererCommandList GCRendererCommandList;
+
+    typedef enum GCRendererStorageBufferFlags
+    {
+        GCRendererStorageBufferFlags_None = 0,
+        GCRendererStorageBufferFlags_HostVisible = 1 << 0,
+        GCRendererStorageBufferFlags_Vertex = 1 << 1,
+        GCRendererStorageBufferFlags_Indirect = 1 << 2
+    } GCRendererStorageBufferFlags;
+
+    typedef struct GCRendererStorageBufferDescription
+    {
+        const GCRendererDevice* Device;
+        const GCRendererCommandList* CommandList;
+
+        GCRendererStorageBufferFlags Flags;
+        size_t DataSize;
+    } GCRendererStorageBufferDescription;
+
+    GCRendererStorageBuffer* GCRendererStorageBuffer_Create(
+        const GCRendererStorageBufferDescription* const Description);
+    void GCRendererStorageBuffer_SetData(const GCRendererStorageBuffer* const StorageBuffer, const void* const Data,
+                                         const size_t DataSize);
+    void* GCRendererStorageBuffer_GetData(const GCRendererStorageBuffer* const StorageBuffer);
+    size_t GCRendererStorageBuffer_GetDataSize(const GCRendererStorageBuffer* const StorageBuffer);
+    void GCRendererStorageBuffer_Destroy(GCRendererStorageBuffer* StorageBuffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,54 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Core/Assert.h"
+#include "Core/Log.h"
+#include "Renderer/Vulkan/VulkanUtilities.h"
+
+#include <vulkan/vulkan.h>
+
+static VkResult GCRendererDevice_vkCreateHeadlessSurfaceEXT(VkInstance instance,
+                                                            const VkHeadlessSurfaceCreateInfoEXT* pCreateInfo,
+                                                            const VkAllocationCallbacks* pAllocator,
+                                                            VkSurfaceKHR* pSurface);
+
+void GCRendererDevice_CreateSurface(const VkInstance InstanceHandle, VkSurfaceKHR* SurfaceHandle)
+{
+    VkHeadlessSurfaceCreateInfoEXT SurfaceInformation = {0};
+    SurfaceInformation.sType = VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT;
+
+    GC_VULKAN_VALIDATE(
+        GCRendererDevice_vkCreateHeadlessSurfaceEXT(InstanceHandle, &SurfaceInformation, NULL, SurfaceHandle),
+        "Failed to create a headless Vulkan surface");
+}
+
+VkResult GCRendererDevice_vkCreateHeadlessSurfaceEXT(VkInstance instance,
+                                                     const VkHeadlessSurfaceCreateInfoEXT* pCreateInfo,
+                                                     const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+    const PFN_vkCreateHeadlessSurfaceEXT vkCreateHeadlessSurfaceEXTFunction =
+        (PFN_vkCreateHeadlessSurfaceEXT)vkGetInstanceProcAddr(instance, "vkCreateHeadlessSurfaceEXT");
+
+    if (vkCreateHeadlessSurfaceEXTFunction)
+    {
+        return vkCreateHeadlessSurfaceEXTFunction(instance, pCreateInfo, pAllocator, pSurface);
+    }
+    else
+    {
+        return VK_ERROR_EXTENSION_NOT_PRESENT;
+    }
+}
@@ -0,0 +1,229 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Renderer/Vulkan/VulkanDeletionQueue.h"
+#include "Core/Assert.h"
+#include "Core/Log.h"
+#include "Core/Memory/Allocator.h"
+#include "Renderer/Vulkan/VulkanMemoryAllocator.h"
+#include "Renderer/Vulkan/VulkanRendererDevice.h"
+#include "Renderer/Vulkan/VulkanUtilities.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <vulkan/vulkan.h>
+
+typedef enum GCVulkanDeletionType
+{
+    GCVulkanDeletionType_Buffer,
+    GCVulkanDeletionType_Image,
+    GCVulkanDeletionType_ImageView,
+    GCVulkanDeletionType_Sampler
+} GCVulkanDeletionType;
+
+typedef struct GCVulkanDeletion
+{
+    GCVulkanDeletionType Type;
+    uint64_t FrameNumber;
+
+    VkBuffer BufferHandle;
+    VkImage ImageHandle;
+    VkImageView ImageViewHandle;
+    VkSampler SamplerHandle;
+    GCVulkanMemoryAllocation Memory;
+} GCVulkanDeletion;
+
+typedef struct GCVulkanDeletionQueue
+{
+    const GCRendererDevice* Device;
+
+    GCVulkanDeletion* Deletions;
+    uint32_t DeletionCount;
+    uint32_t MaximumDeletionCount;
+
+    uint64_t FrameNumber;
+    uint64_t CompletedFrameCount;
+} GCVulkanDeletionQueue;
+
+static GCVulkanDeletion* GCVulkanDeletionQueue_Enqueue(GCVulkanDeletionQueue* const DeletionQueue,
+                                                       const GCVulkanDeletionType Type);
+static void GCVulkanDeletionQueue_Delete(const GCVulkanDeletionQueue* const DeletionQueue,
+                                         const GCVulkanDeletion* const Deletion);
+
+GCVulkanDeletionQueue* GCVulkanDeletionQueue_Create(const GCRendererDevice* const Device)
+{
+    GCVulkanDeletionQueue* DeletionQueue = (GCVulkanDeletionQueue*)GCMemory_Allocate(sizeof(GCVulkanDeletionQueue));
+    DeletionQueue->Device = Device;
+    DeletionQueue->Deletions = NULL;
+    DeletionQueue->DeletionCount = 0;
+    DeletionQueue->MaximumDeletionCount = 0;
+    DeletionQueue->FrameNumber = 0;
+    DeletionQueue->CompletedFrameCount = 0;
+
+    return DeletionQueue;
+}
+
+void GCVulkanDeletionQueue_EnqueueBuffer(GCVulkanDeletionQueue* const DeletionQueue, const VkBuffer BufferHandle,
+                                         const GCVulkanMemoryAllocation* const BufferMemory)
+{
+    if (BufferHandle == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    GCVulkanDeletion* const Deletion = GCVulkanDeletionQueue_Enqueue(DeletionQueue, GCVulkanDeletionType_Buffer);
+    Deletion->BufferHandle = BufferHandle;
+    Deletion->Memory = *BufferMemory;
+}
+
+void GCVulkanDeletionQueue_EnqueueImage(GCVulkanDeletionQueue* const DeletionQueue, const VkImage ImageHandle,
+                                        const GCVulkanMemoryAllocation* const ImageMemory)
+{
+    if (ImageHandle == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    GCVulkanDeletion* const Deletion = GCVulkanDeletionQueue_Enqueue(DeletionQueue, GCVulkanDeletionType_Image);
+    Deletion->ImageHandle = ImageHandle;
+    Deletion->Memory = *ImageMemory;
+}
+
+void GCVulkanDeletionQueue_EnqueueImageView(GCVulkanDeletionQueue* const DeletionQueue,
+                                            const VkImageView ImageViewHandle)
+{
+    if (ImageViewHandle == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    GCVulkanDeletionQueue_Enqueue(DeletionQueue, GCVulkanDeletionType_ImageView)->ImageViewHandle = ImageViewHandle;
+}
+
+void GCVulkanDeletionQueue_EnqueueSampler(GCVulkanDeletionQueue* const DeletionQueue, const VkSampler SamplerHandle)
+{
+    if (SamplerHandle == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    GCVulkanDeletionQueue_Enqueue(DeletionQueue, GCVulkanDeletionType_Sampler)->SamplerHandle = SamplerHandle;
+}
+
+uint64_t GCVulkanDeletionQueue_GetFrameNumber(const GCVulkanDeletionQueue* const DeletionQueue)
+{
+    return DeletionQueue->FrameNumber;
+}
+
+uint64_t GCVulkanDeletionQueue_GetCompletedFrameCount(const GCVulkanDeletionQueue* const DeletionQueue)
+{
+    return DeletionQueue->CompletedFrameCount;
+}
+
+void GCVulkanDeletionQueue_AdvanceFrame(GCVulkanDeletionQueue* const DeletionQueue)
+{
+    DeletionQueue->FrameNumber++;
+}
+
+void GCVulkanDeletionQueue_Release(GCVulkanDeletionQueue* const DeletionQueue, const uint64_t CompletedFrameCount)
+{
+    if (CompletedFrameCount > DeletionQueue->CompletedFrameCount)
+    {
+        DeletionQueue->CompletedFrameCount = CompletedFrameCount;
+    }
+
+    uint32_t ReleasedCount = 0;
+
+    while (ReleasedCount < DeletionQueue->DeletionCount &&
+           DeletionQueue->Deletions[ReleasedCount].FrameNumber < DeletionQueue->CompletedFrameCount)
+    {
+        GCVulkanDeletionQueue_Delete(DeletionQueue, &DeletionQueue->Deletions[ReleasedCount]);
+
+        ReleasedCount++;
+    }
+
+    if (ReleasedCount)
+    {
+        DeletionQueue->DeletionCount -= ReleasedCount;
+
+        memmove(DeletionQueue->Deletions, DeletionQueue->Deletions + ReleasedCount,
+                DeletionQueue->DeletionCount * sizeof(GCVulkanDeletion));
+    }
+}
+
+void GCVulkanDeletionQueue_Destroy(GCVulkanDeletionQueue* DeletionQueue)
+{
+    for (uint32_t Counter = 0; Counter < DeletionQueue->DeletionCount; Counter++)
+    {
+        GCVulkanDeletionQueue_Delete(DeletionQueue, &DeletionQueue->Deletions[Counter]);
+    }
+
+    GCMemory_Free(DeletionQueue->Deletions);
+    GCMemory_Free(DeletionQueue);
+}
+
+GCVulkanDeletion* GCVulkanDeletionQueue_Enqueue(GCVulkanDeletionQueue* const DeletionQueue,
+                                                const GCVulkanDeletionType Type)
+{
+    if (DeletionQueue->DeletionCount >= DeletionQueue->MaximumDeletionCount)
+    {
+        DeletionQueue->MaximumDeletionCount =
+            DeletionQueue->MaximumDeletionCount ? DeletionQueue->MaximumDeletionCount * 2 : 64;
+        DeletionQueue->Deletions = (GCVulkanDeletion*)GCMemory_Reallocate(
+            DeletionQueue->Deletions, DeletionQueue->MaximumDeletionCount * sizeof(GCVulkanDeletion));
+    }
+
+    GCVulkanDeletion* const Deletion = &DeletionQueue->Deletions[DeletionQueue->DeletionCount];
+    *Deletion = (GCVulkanDeletion){0};
+    Deletion->Type = Type;
+    Deletion->FrameNumber = DeletionQueue->FrameNumber;
+
+    DeletionQueue->DeletionCount++;
+
+    return Deletion;
+}
+
+void GCVulkanDeletionQueue_Delete(const GCVulkanDeletionQueue* const DeletionQueue,
+                                  const GCVulkanDeletion* const Deletion)
+{
+    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(DeletionQueue->Device);
+
+    switch (Deletion->Type)
+    {
+    case GCVulkanDeletionType_Buffer: {
+        GCVulkanUtilities_DestroyBuffer(DeletionQueue->Device, Deletion->BufferHandle, &Deletion->Memory);
+
+        break;
+    }
+    case GCVulkanDeletionType_Image: {
+        GCVulkanUtilities_DestroyImage(DeletionQueue->Device, Deletion->ImageHandle, &Deletion->Memory);
+
+        break;
+    }
+    case GCVulkanDeletionType_ImageView: {
+        vkDestroyImageView(DeviceHandle, Deletion->ImageViewHandle, NULL);
+
+        break;
+    }
+    case GCVulkanDeletionType_Sampler: {
+        vkDestroySampler(DeviceHandle, Deletion->SamplerHandle, NULL);
+
+        break;
+    }
+    }
+}
@@ -0,0 +1,53 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GC_RENDERER_VULKAN_VULKAN_DELETION_QUEUE_H
+#define GC_RENDERER_VULKAN_VULKAN_DELETION_QUEUE_H
+
+#include <stdint.h>
+
+#include <vulkan/vulkan.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct GCVulkanDeletionQueue GCVulkanDeletionQueue;
+    typedef struct GCRendererDevice GCRendererDevice;
+    typedef struct GCVulkanMemoryAllocation GCVulkanMemoryAllocation;
+
+    GCVulkanDeletionQueue* GCVulkanDeletionQueue_Create(const GCRendererDevice* const Device);
+    void GCVulkanDeletionQueue_EnqueueBuffer(GCVulkanDeletionQueue* const DeletionQueue, const VkBuffer BufferHandle,
+                                             const GCVulkanMemoryAllocation* const BufferMemory);
+    void GCVulkanDeletionQueue_EnqueueImage(GCVulkanDeletionQueue* const DeletionQueue, const VkImage ImageHandle,
+                                            const GCVulkanMemoryAllocation* const ImageMemory);
+    void GCVulkanDeletionQueue_EnqueueImageView(GCVulkanDeletionQueue* const DeletionQueue,
+                                                const VkImageView ImageViewHandle);
+    void GCVulkanDeletionQueue_EnqueueSampler(GCVulkanDeletionQueue* const DeletionQueue,
+                                              const VkSampler SamplerHandle);
+    uint64_t GCVulkanDeletionQueue_GetFrameNumber(const GCVulkanDeletionQueue* const DeletionQueue);
+    uint64_t GCVulkanDeletionQueue_GetCompletedFrameCount(const GCVulkanDeletionQueue* const DeletionQueue);
+    void GCVulkanDeletionQueue_AdvanceFrame(GCVulkanDeletionQueue* const DeletionQueue);
+    void GCVulkanDeletionQueue_Release(GCVulkanDeletionQueue* const DeletionQueue, const uint64_t CompletedFrameCount);
+    void GCVulkanDeletionQueue_Destroy(GCVulkanDeletionQueue* DeletionQueue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
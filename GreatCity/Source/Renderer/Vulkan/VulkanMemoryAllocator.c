@@ -0,0 +1,867 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Renderer/Vulkan/VulkanMemoryAllocator.h"
+#include "Core/Assert.h"
+#include "Core/Atomic.h"
+#include "Core/Log.h"
+#include "Core/Memory/Allocator.h"
+#include "Core/Thread.h"
+#include "Renderer/RendererDevice.h"
+#include "Renderer/Vulkan/VulkanRendererDevice.h"
+#include "Renderer/Vulkan/VulkanUtilities.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include <vulkan/vulkan.h>
+
+#define GC_VULKAN_MEMORY_ALLOCATOR_SMALL_HEAP_SIZE (1024ull * 1024 * 1024)
+#define GC_VULKAN_MEMORY_ALLOCATOR_LARGE_HEAP_BLOCK_SIZE (256ull * 1024 * 1024)
+#define GC_VULKAN_MEMORY_ALLOCATOR_RESOURCE_TYPE_COUNT 2
+#define GC_VULKAN_MEMORY_ALLOCATOR_STRATEGY_COUNT 2
+
+#define GC_VULKAN_MEMORY_BLOCK_FIRST_LEVEL_COUNT 64
+#define GC_VULKAN_MEMORY_BLOCK_SECOND_LEVEL_COUNT_LOG2 5
+#define GC_VULKAN_MEMORY_BLOCK_SECOND_LEVEL_COUNT (1u << GC_VULKAN_MEMORY_BLOCK_SECOND_LEVEL_COUNT_LOG2)
+#define GC_VULKAN_MEMORY_BLOCK_INITIAL_CHUNK_CAPACITY 64
+#define GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX UINT32_MAX
+
+typedef struct GCVulkanMemoryChunk
+{
+    VkDeviceSize Offset;
+    VkDeviceSize Size;
+
+    uint32_t PreviousPhysicalIndex;
+    uint32_t NextPhysicalIndex;
+    uint32_t PreviousFreeIndex;
+    uint32_t NextFreeIndex;
+
+    bool IsFree;
+} GCVulkanMemoryChunk;
+
+typedef struct GCVulkanMemoryPool
+{
+    GCVulkanMemoryBlock** Blocks;
+    uint32_t BlockCount;
+
+    uint32_t MemoryTypeIndex;
+    GCVulkanMemoryAllocationStrategy Strategy;
+    VkDeviceSize PreferredBlockSize;
+} GCVulkanMemoryPool;
+
+typedef struct GCVulkanMemoryBlock
+{
+    GCVulkanMemoryPool* Pool;
+
+    VkDeviceMemory MemoryHandle;
+    VkDeviceSize Size;
+    uint8_t* MappedData;
+
+    GCVulkanMemoryChunk* Chunks;
+    uint32_t ChunkCapacity;
+    uint32_t FirstUnusedChunkIndex;
+
+    uint64_t FirstLevelBitmap;
+    uint32_t SecondLevelBitmaps[GC_VULKAN_MEMORY_BLOCK_FIRST_LEVEL_COUNT];
+    uint32_t FreeChunkIndices[GC_VULKAN_MEMORY_BLOCK_FIRST_LEVEL_COUNT][GC_VULKAN_MEMORY_BLOCK_SECOND_LEVEL_COUNT];
+
+    VkDeviceSize LinearOffset;
+
+    VkDeviceSize UsedSize;
+    uint32_t AllocationCount;
+} GCVulkanMemoryBlock;
+
+typedef struct GCVulkanMemoryAllocator
+{
+    const GCRendererDevice* Device;
+
+    VkPhysicalDeviceMemoryProperties MemoryProperties;
+    VkDeviceSize BufferImageGranularity;
+    uint32_t MaximumDeviceMemoryAllocationCount;
+
+    GCVulkanMemoryPool Pools[VK_MAX_MEMORY_TYPES][GC_VULKAN_MEMORY_ALLOCATOR_RESOURCE_TYPE_COUNT]
+                            [GC_VULKAN_MEMORY_ALLOCATOR_STRATEGY_COUNT];
+
+    uint32_t DeviceMemoryAllocationCount;
+    uint32_t BlockCount;
+    uint32_t AllocationCount;
+    uint32_t DedicatedAllocationCount;
+    uint64_t ReservedSize;
+    uint64_t UsedSize;
+
+    volatile int64_t Lock;
+} GCVulkanMemoryAllocator;
+
+static void GCVulkanMemoryAllocator_Lock(GCVulkanMemoryAllocator* const MemoryAllocator);
+static void GCVulkanMemoryAllocator_Unlock(GCVulkanMemoryAllocator* const MemoryAllocator);
+static bool GCVulkanMemoryAllocator_AllocateDeviceMemory(GCVulkanMemoryAllocator* const MemoryAllocator,
+                                                         const uint32_t MemoryTypeIndex, const VkDeviceSize Size,
+                                                         VkDeviceMemory* const MemoryHandle, void** const MappedData);
+static void GCVulkanMemoryAllocator_FreeDeviceMemory(GCVulkanMemoryAllocator* const MemoryAllocator,
+                                                     const VkDeviceMemory MemoryHandle, const VkDeviceSize Size,
+                                                     const bool IsMapped);
+static bool GCVulkanMemoryAllocator_AllocateDedicated(GCVulkanMemoryAllocator* const MemoryAllocator,
+                                                      const uint32_t MemoryTypeIndex, const VkDeviceSize Size,
+                                                      GCVulkanMemoryAllocation* const Allocation);
+static bool GCVulkanMemoryAllocator_AllocateFromPool(GCVulkanMemoryAllocator* const MemoryAllocator,
+                                                     GCVulkanMemoryPool* const Pool, const VkDeviceSize Size,
+                                                     const VkDeviceSize Alignment,
+                                                     GCVulkanMemoryAllocation* const Allocation);
+static GCVulkanMemoryBlock* GCVulkanMemoryAllocator_CreateBlock(GCVulkanMemoryAllocator* const MemoryAllocator,
+                                                                GCVulkanMemoryPool* const Pool,
+                                                                const VkDeviceSize RequiredSize);
+static void GCVulkanMemoryAllocator_DestroyBlock(GCVulkanMemoryAllocator* const MemoryAllocator,
+                                                 GCVulkanMemoryBlock* Block);
+
+static bool GCVulkanMemoryBlock_Allocate(GCVulkanMemoryBlock* const Block, const VkDeviceSize Size,
+                                         const VkDeviceSize Alignment, GCVulkanMemoryAllocation* const Allocation);
+static void GCVulkanMemoryBlock_Free(GCVulkanMemoryBlock* const Block,
+                                     const GCVulkanMemoryAllocation* const Allocation);
+static uint32_t GCVulkanMemoryBlock_CreateChunk(GCVulkanMemoryBlock* const Block, const VkDeviceSize Offset,
+                                                const VkDeviceSize Size);
+static void GCVulkanMemoryBlock_DestroyChunk(GCVulkanMemoryBlock* const Block, const uint32_t ChunkIndex);
+static uint32_t GCVulkanMemoryBlock_FindFreeChunk(const GCVulkanMemoryBlock* const Block, VkDeviceSize Size);
+static void GCVulkanMemoryBlock_InsertFreeChunk(GCVulkanMemoryBlock* const Block, const uint32_t ChunkIndex);
+static void GCVulkanMemoryBlock_RemoveFreeChunk(GCVulkanMemoryBlock* const Block, const uint32_t ChunkIndex);
+static void GCVulkanMemoryBlock_MapSize(const VkDeviceSize Size, uint32_t* const FirstLevelIndex,
+                                        uint32_t* const SecondLevelIndex);
+static uint32_t GCVulkanMemoryBlock_FindFirstSetBit(const uint64_t Value);
+static uint32_t GCVulkanMemoryBlock_FindLastSetBit(const uint64_t Value);
+static VkDeviceSize GCVulkanMemoryBlock_AlignOffset(const VkDeviceSize Offset, const VkDeviceSize Alignment);
+
+GCVulkanMemoryAllocator* GCVulkanMemoryAllocator_Create(const GCRendererDevice* const Device)
+{
+    GCVulkanMemoryAllocator* MemoryAllocator =
+        (GCVulkanMemoryAllocator*)GCMemory_AllocateZero(sizeof(GCVulkanMemoryAllocator));
+    MemoryAllocator->Device = Device;
+
+    const VkPhysicalDevice PhysicalDeviceHandle = GCRendererDevice_GetPhysicalDeviceHandle(Device);
+
+    vkGetPhysicalDeviceMemoryProperties(PhysicalDeviceHandle, &MemoryAllocator->MemoryProperties);
+
+    VkPhysicalDeviceProperties PhysicalDeviceProperties = {0};
+    vkGetPhysicalDeviceProperties(PhysicalDeviceHandle, &PhysicalDeviceProperties);
+
+    MemoryAllocator->BufferImageGranularity = PhysicalDeviceProperties.limits.bufferImageGranularity;
+    MemoryAllocator->MaximumDeviceMemoryAllocationCount = PhysicalDeviceProperties.limits.maxMemoryAllocationCount;
+
+    for (uint32_t MemoryTypeIndex = 0; MemoryTypeIndex < MemoryAllocator->MemoryProperties.memoryTypeCount;
+         MemoryTypeIndex++)
+    {
+        const uint32_t HeapIndex = MemoryAllocator->MemoryProperties.memoryTypes[MemoryTypeIndex].heapIndex;
+        const VkDeviceSize HeapSize = MemoryAllocator->MemoryProperties.memoryHeaps[HeapIndex].size;
+
+        for (uint32_t ResourceType = 0; ResourceType < GC_VULKAN_MEMORY_ALLOCATOR_RESOURCE_TYPE_COUNT; ResourceType++)
+        {
+            for (uint32_t Strategy = 0; Strategy < GC_VULKAN_MEMORY_ALLOCATOR_STRATEGY_COUNT; Strategy++)
+            {
+                GCVulkanMemoryPool* const Pool = &MemoryAllocator->Pools[MemoryTypeIndex][ResourceType][Strategy];
+                Pool->MemoryTypeIndex = MemoryTypeIndex;
+                Pool->Strategy = (GCVulkanMemoryAllocationStrategy)Strategy;
+                Pool->PreferredBlockSize = HeapSize <= GC_VULKAN_MEMORY_ALLOCATOR_SMALL_HEAP_SIZE
+                                               ? HeapSize / 8
+                                               : GC_VULKAN_MEMORY_ALLOCATOR_LARGE_HEAP_BLOCK_SIZE;
+            }
+        }
+    }
+
+    return MemoryAllocator;
+}
+
+GCVulkanMemoryAllocation GCVulkanMemoryAllocator_Allocate(
+    GCVulkanMemoryAllocator* const MemoryAllocator, const GCVulkanMemoryAllocationDescription* const Description)
+{
+    const uint32_t MemoryTypeIndex = GCRendererDevice_GetMemoryTypeIndex(
+        MemoryAllocator->Device, Description->MemoryRequirements.memoryTypeBits, Description->MemoryProperty);
+    const VkDeviceSize Size = Description->MemoryRequirements.size;
+    const VkDeviceSize Alignment = Description->MemoryRequirements.alignment;
+
+    const GCVulkanMemoryResourceType ResourceType =
+        MemoryAllocator->BufferImageGranularity > 1 ? Description->ResourceType : GCVulkanMemoryResourceType_Linear;
+    GCVulkanMemoryPool* const Pool = &MemoryAllocator->Pools[MemoryTypeIndex][ResourceType][Description->Strategy];
+
+    GCVulkanMemoryAllocation Allocation = {0};
+
+    GCVulkanMemoryAllocator_Lock(MemoryAllocator);
+
+    bool IsAllocated = false;
+
+    if (!Description->IsDedicated && Size <= Pool->PreferredBlockSize / 2)
+    {
+        IsAllocated = GCVulkanMemoryAllocator_AllocateFromPool(MemoryAllocator, Pool, Size, Alignment, &Allocation);
+    }
+
+    if (!IsAllocated)
+    {
+        IsAllocated = GCVulkanMemoryAllocator_AllocateDedicated(MemoryAllocator, MemoryTypeIndex, Size, &Allocation);
+    }
+
+    GC_ASSERT_WITH_MESSAGE(IsAllocated, "Failed to allocate %llu bytes of Vulkan memory", (unsigned long long)Size);
+
+    MemoryAllocator->AllocationCount++;
+    MemoryAllocator->UsedSize += Size;
+
+    GCVulkanMemoryAllocator_Unlock(MemoryAllocator);
+
+    return Allocation;
+}
+
+void GCVulkanMemoryAllocator_Free(GCVulkanMemoryAllocator* const MemoryAllocator,
+                                  const GCVulkanMemoryAllocation* const Allocation)
+{
+    if (Allocation->MemoryHandle == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    GCVulkanMemoryAllocator_Lock(MemoryAllocator);
+
+    GCVulkanMemoryBlock* const Block = Allocation->Block;
+
+    if (Block)
+    {
+        GCVulkanMemoryBlock_Free(Block, Allocation);
+
+        if (!Block->AllocationCount)
+        {
+            const GCVulkanMemoryPool* const Pool = Block->Pool;
+
+            uint32_t EmptyBlockCount = 0;
+
+            for (uint32_t Counter = 0; Counter < Pool->BlockCount; Counter++)
+            {
+                EmptyBlockCount += !Pool->Blocks[Counter]->AllocationCount;
+            }
+
+            if (EmptyBlockCount > 1)
+            {
+                GCVulkanMemoryAllocator_DestroyBlock(MemoryAllocator, Block);
+            }
+        }
+    }
+    else
+    {
+        GCVulkanMemoryAllocator_FreeDeviceMemory(MemoryAllocator, Allocation->MemoryHandle, Allocation->Size,
+                                                 Allocation->MappedData != NULL);
+
+        MemoryAllocator->DedicatedAllocationCount--;
+    }
+
+    MemoryAllocator->AllocationCount--;
+    MemoryAllocator->UsedSize -= Allocation->Size;
+
+    GCVulkanMemoryAllocator_Unlock(MemoryAllocator);
+}
+
+GCRendererDeviceMemoryStatistics GCVulkanMemoryAllocator_GetStatistics(
+    const GCVulkanMemoryAllocator* const MemoryAllocator)
+{
+    GCVulkanMemoryAllocator_Lock((GCVulkanMemoryAllocator*)MemoryAllocator);
+
+    GCRendererDeviceMemoryStatistics Statistics = {0};
+    Statistics.DeviceMemoryAllocationCount = MemoryAllocator->DeviceMemoryAllocationCount;
+    Statistics.MaximumDeviceMemoryAllocationCount = MemoryAllocator->MaximumDeviceMemoryAllocationCount;
+    Statistics.BlockCount = MemoryAllocator->BlockCount;
+    Statistics.AllocationCount = MemoryAllocator->AllocationCount;
+    Statistics.DedicatedAllocationCount = MemoryAllocator->DedicatedAllocationCount;
+    Statistics.ReservedSize = MemoryAllocator->ReservedSize;
+    Statistics.UsedSize = MemoryAllocator->UsedSize;
+
+    GCVulkanMemoryAllocator_Unlock((GCVulkanMemoryAllocator*)MemoryAllocator);
+
+    return Statistics;
+}
+
+void GCVulkanMemoryAllocator_Destroy(GCVulkanMemoryAllocator* MemoryAllocator)
+{
+    if (MemoryAllocator->AllocationCount)
+    {
+        GC_LOG_WARNING("Destroying the Vulkan memory allocator with %u live allocations",
+                       MemoryAllocator->AllocationCount);
+    }
+
+    for (uint32_t MemoryTypeIndex = 0; MemoryTypeIndex < VK_MAX_MEMORY_TYPES; MemoryTypeIndex++)
+    {
+        for (uint32_t ResourceType = 0; ResourceType < GC_VULKAN_MEMORY_ALLOCATOR_RESOURCE_TYPE_COUNT; ResourceType++)
+        {
+            for (uint32_t Strategy = 0; Strategy < GC_VULKAN_MEMORY_ALLOCATOR_STRATEGY_COUNT; Strategy++)
+            {
+                GCVulkanMemoryPool* const Pool = &MemoryAllocator->Pools[MemoryTypeIndex][ResourceType][Strategy];
+
+                while (Pool->BlockCount)
+                {
+                    GCVulkanMemoryAllocator_DestroyBlock(MemoryAllocator, Pool->Blocks[Pool->BlockCount - 1]);
+                }
+
+                GCMemory_Free(Pool->Blocks);
+            }
+        }
+    }
+
+    GCMemory_Free(MemoryAllocator);
+}
+
+void GCVulkanMemoryAllocator_Lock(GCVulkanMemoryAllocator* const MemoryAllocator)
+{
+    while (!GCAtomic_CompareExchange(&MemoryAllocator->Lock, 0, 1))
+    {
+        GCThread_Yield();
+    }
+}
+
+void GCVulkanMemoryAllocator_Unlock(GCVulkanMemoryAllocator* const MemoryAllocator)
+{
+    GCAtomic_Store(&MemoryAllocator->Lock, 0);
+}
+
+bool GCVulkanMemoryAllocator_AllocateDeviceMemory(GCVulkanMemoryAllocator* const MemoryAllocator,
+                                                  const uint32_t MemoryTypeIndex, const VkDeviceSize Size,
+                                                  VkDeviceMemory* const MemoryHandle, void** const MappedData)
+{
+    if (MemoryAllocator->DeviceMemoryAllocationCount >= MemoryAllocator->MaximumDeviceMemoryAllocationCount)
+    {
+        GC_LOG_ERROR("Reached the maximum Vulkan memory allocation count: %u",
+                     MemoryAllocator->MaximumDeviceMemoryAllocationCount);
+
+        return false;
+    }
+
+    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(MemoryAllocator->Device);
+
+    VkMemoryAllocateInfo MemoryAllocateInformation = {0};
+    MemoryAllocateInformation.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    MemoryAllocateInformation.allocationSize = Size;
+    MemoryAllocateInformation.memoryTypeIndex = MemoryTypeIndex;
+
+    if (vkAllocateMemory(DeviceHandle, &MemoryAllocateInformation, NULL, MemoryHandle) != VK_SUCCESS)
+    {
+        return false;
+    }
+
+    *MappedData = NULL;
+
+    if (MemoryAllocator->MemoryProperties.memoryTypes[MemoryTypeIndex].propertyFlags &
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+    {
+        GC_VULKAN_VALIDATE(vkMapMemory(DeviceHandle, *MemoryHandle, 0, VK_WHOLE_SIZE, 0, MappedData),
+                           "Failed to map a Vulkan memory");
+    }
+
+    MemoryAllocator->DeviceMemoryAllocationCount++;
+    MemoryAllocator->ReservedSize += Size;
+
+    return true;
+}
+
+void GCVulkanMemoryAllocator_FreeDeviceMemory(GCVulkanMemoryAllocator* const MemoryAllocator,
+                                              const VkDeviceMemory MemoryHandle, const VkDeviceSize Size,
+                                              const bool IsMapped)
+{
+    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(MemoryAllocator->Device);
+
+    if (IsMapped)
+    {
+        vkUnmapMemory(DeviceHandle, MemoryHandle);
+    }
+
+    vkFreeMemory(DeviceHandle, MemoryHandle, NULL);
+
+    MemoryAllocator->DeviceMemoryAllocationCount--;
+    MemoryAllocator->ReservedSize -= Size;
+}
+
+bool GCVulkanMemoryAllocator_AllocateDedicated(GCVulkanMemoryAllocator* const MemoryAllocator,
+                                               const uint32_t MemoryTypeIndex, const VkDeviceSize Size,
+                                               GCVulkanMemoryAllocation* const Allocation)
+{
+    if (!GCVulkanMemoryAllocator_AllocateDeviceMemory(MemoryAllocator, MemoryTypeIndex, Size,
+                                                      &Allocation->MemoryHandle, &Allocation->MappedData))
+    {
+        return false;
+    }
+
+    Allocation->Offset = 0;
+    Allocation->Size = Size;
+    Allocation->Block = NULL;
+    Allocation->ChunkIndex = GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX;
+
+    MemoryAllocator->DedicatedAllocationCount++;
+
+    return true;
+}
+
+bool GCVulkanMemoryAllocator_AllocateFromPool(GCVulkanMemoryAllocator* const MemoryAllocator,
+                                              GCVulkanMemoryPool* const Pool, const VkDeviceSize Size,
+                                              const VkDeviceSize Alignment, GCVulkanMemoryAllocation* const Allocation)
+{
+    for (uint32_t Counter = 0; Counter < Pool->BlockCount; Counter++)
+    {
+        if (GCVulkanMemoryBlock_Allocate(Pool->Blocks[Counter], Size, Alignment, Allocation))
+        {
+            return true;
+        }
+    }
+
+    GCVulkanMemoryBlock* const Block = GCVulkanMemoryAllocator_CreateBlock(MemoryAllocator, Pool, Size + Alignment);
+
+    return Block && GCVulkanMemoryBlock_Allocate(Block, Size, Alignment, Allocation);
+}
+
+GCVulkanMemoryBlock* GCVulkanMemoryAllocator_CreateBlock(GCVulkanMemoryAllocator* const MemoryAllocator,
+                                                         GCVulkanMemoryPool* const Pool,
+                                                         const VkDeviceSize RequiredSize)
+{
+    VkDeviceSize LargestBlockSize = 0;
+
+    for (uint32_t Counter = 0; Counter < Pool->BlockCount; Counter++)
+    {
+        if (Pool->Blocks[Counter]->Size > LargestBlockSize)
+        {
+            LargestBlockSize = Pool->Blocks[Counter]->Size;
+        }
+    }
+
+    VkDeviceSize BlockSize = Pool->PreferredBlockSize;
+
+    for (uint32_t Counter = 0; Counter < 3; Counter++)
+    {
+        const VkDeviceSize SmallerBlockSize = BlockSize / 2;
+
+        if (SmallerBlockSize <= LargestBlockSize || SmallerBlockSize < RequiredSize * 2)
+        {
+            break;
+        }
+
+        BlockSize = SmallerBlockSize;
+    }
+
+    VkDeviceMemory MemoryHandle = VK_NULL_HANDLE;
+    void* MappedData = NULL;
+
+    while (!GCVulkanMemoryAllocator_AllocateDeviceMemory(MemoryAllocator, Pool->MemoryTypeIndex, BlockSize,
+                                                         &MemoryHandle, &MappedData))
+    {
+        BlockSize /= 2;
+
+        if (BlockSize < RequiredSize)
+        {
+            return NULL;
+        }
+    }
+
+    GCVulkanMemoryBlock* Block = (GCVulkanMemoryBlock*)GCMemory_Allocate(sizeof(GCVulkanMemoryBlock));
+    Block->Pool = Pool;
+    Block->MemoryHandle = MemoryHandle;
+    Block->Size = BlockSize;
+    Block->MappedData = (uint8_t*)MappedData;
+    Block->Chunks = NULL;
+    Block->ChunkCapacity = 0;
+    Block->FirstUnusedChunkIndex = GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX;
+    Block->FirstLevelBitmap = 0;
+    memset(Block->SecondLevelBitmaps, 0, sizeof(Block->SecondLevelBitmaps));
+    memset(Block->FreeChunkIndices, 0xFF, sizeof(Block->FreeChunkIndices));
+    Block->LinearOffset = 0;
+    Block->UsedSize = 0;
+    Block->AllocationCount = 0;
+
+    if (Pool->Strategy == GCVulkanMemoryAllocationStrategy_General)
+    {
+        const uint32_t ChunkIndex = GCVulkanMemoryBlock_CreateChunk(Block, 0, BlockSize);
+        GCVulkanMemoryBlock_InsertFreeChunk(Block, ChunkIndex);
+    }
+
+    Pool->Blocks =
+        (GCVulkanMemoryBlock**)GCMemory_Reallocate(Pool->Blocks, (Pool->BlockCount + 1) * sizeof(GCVulkanMemoryBlock*));
+    Pool->Blocks[Pool->BlockCount] = Block;
+    Pool->BlockCount++;
+
+    MemoryAllocator->BlockCount++;
+
+    return Block;
+}
+
+void GCVulkanMemoryAllocator_DestroyBlock(GCVulkanMemoryAllocator* const MemoryAllocator, GCVulkanMemoryBlock* Block)
+{
+    GCVulkanMemoryPool* const Pool = Block->Pool;
+
+    for (uint32_t Counter = 0; Counter < Pool->BlockCount; Counter++)
+    {
+        if (Pool->Blocks[Counter] == Block)
+        {
+            Pool->Blocks[Counter] = Pool->Blocks[Pool->BlockCount - 1];
+            Pool->BlockCount--;
+
+            break;
+        }
+    }
+
+    GCVulkanMemoryAllocator_FreeDeviceMemory(MemoryAllocator, Block->MemoryHandle, Block->Size,
+                                             Block->MappedData != NULL);
+
+    MemoryAllocator->BlockCount--;
+
+    GCMemory_Free(Block->Chunks);
+    GCMemory_Free(Block);
+}
+
+bool GCVulkanMemoryBlock_Allocate(GCVulkanMemoryBlock* const Block, const VkDeviceSize Size,
+                                  const VkDeviceSize Alignment, GCVulkanMemoryAllocation* const Allocation)
+{
+    VkDeviceSize Offset = 0;
+    uint32_t ChunkIndex = GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX;
+
+    if (Block->Pool->Strategy == GCVulkanMemoryAllocationStrategy_Linear)
+    {
+        Offset = GCVulkanMemoryBlock_AlignOffset(Block->LinearOffset, Alignment);
+
+        if (Offset + Size > Block->Size)
+        {
+            return false;
+        }
+
+        Block->LinearOffset = Offset + Size;
+    }
+    else
+    {
+        ChunkIndex = GCVulkanMemoryBlock_FindFreeChunk(Block, Size + Alignment - 1);
+
+        if (ChunkIndex == GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX)
+        {
+            return false;
+        }
+
+        GCVulkanMemoryBlock_RemoveFreeChunk(Block, ChunkIndex);
+
+        const VkDeviceSize ChunkOffset = Block->Chunks[ChunkIndex].Offset;
+        Offset = GCVulkanMemoryBlock_AlignOffset(ChunkOffset, Alignment);
+
+        if (Offset != ChunkOffset)
+        {
+            const uint32_t PaddingChunkIndex =
+                GCVulkanMemoryBlock_CreateChunk(Block, ChunkOffset, Offset - ChunkOffset);
+
+            GCVulkanMemoryChunk* const PaddingChunk = &Block->Chunks[PaddingChunkIndex];
+            GCVulkanMemoryChunk* const Chunk = &Block->Chunks[ChunkIndex];
+
+            PaddingChunk->PreviousPhysicalIndex = Chunk->PreviousPhysicalIndex;
+            PaddingChunk->NextPhysicalIndex = ChunkIndex;
+
+            if (Chunk->PreviousPhysicalIndex != GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX)
+            {
+                Block->Chunks[Chunk->PreviousPhysicalIndex].NextPhysicalIndex = PaddingChunkIndex;
+            }
+
+            Chunk->PreviousPhysicalIndex = PaddingChunkIndex;
+            Chunk->Offset = Offset;
+            Chunk->Size -= PaddingChunk->Size;
+
+            GCVulkanMemoryBlock_InsertFreeChunk(Block, PaddingChunkIndex);
+        }
+
+        if (Block->Chunks[ChunkIndex].Size > Size)
+        {
+            const uint32_t RemainderChunkIndex =
+                GCVulkanMemoryBlock_CreateChunk(Block, Offset + Size, Block->Chunks[ChunkIndex].Size - Size);
+
+            GCVulkanMemoryChunk* const RemainderChunk = &Block->Chunks[RemainderChunkIndex];
+            GCVulkanMemoryChunk* const Chunk = &Block->Chunks[ChunkIndex];
+
+            RemainderChunk->PreviousPhysicalIndex = ChunkIndex;
+            RemainderChunk->NextPhysicalIndex = Chunk->NextPhysicalIndex;
+
+            if (Chunk->NextPhysicalIndex != GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX)
+            {
+                Block->Chunks[Chunk->NextPhysicalIndex].PreviousPhysicalIndex = RemainderChunkIndex;
+            }
+
+            Chunk->NextPhysicalIndex = RemainderChunkIndex;
+            Chunk->Size = Size;
+
+            GCVulkanMemoryBlock_InsertFreeChunk(Block, RemainderChunkIndex);
+        }
+
+        Block->Chunks[ChunkIndex].IsFree = false;
+    }
+
+    Block->UsedSize += Size;
+    Block->AllocationCount++;
+
+    Allocation->MemoryHandle = Block->MemoryHandle;
+    Allocation->Offset = Offset;
+    Allocation->Size = Size;
+    Allocation->MappedData = Block->MappedData ? Block->MappedData + Offset : NULL;
+    Allocation->Block = Block;
+    Allocation->ChunkIndex = ChunkIndex;
+
+    return true;
+}
+
+void GCVulkanMemoryBlock_Free(GCVulkanMemoryBlock* const Block, const GCVulkanMemoryAllocation* const Allocation)
+{
+    Block->UsedSize -= Allocation->Size;
+    Block->AllocationCount--;
+
+    if (Block->Pool->Strategy == GCVulkanMemoryAllocationStrategy_Linear)
+    {
+        if (!Block->AllocationCount)
+        {
+            Block->LinearOffset = 0;
+        }
+        else if (Allocation->Offset + Allocation->Size == Block->LinearOffset)
+        {
+            Block->LinearOffset = Allocation->Offset;
+        }
+
+        return;
+    }
+
+    uint32_t ChunkIndex = Allocation->ChunkIndex;
+    Block->Chunks[ChunkIndex].IsFree = true;
+
+    const uint32_t NextChunkIndex = Block->Chunks[ChunkIndex].NextPhysicalIndex;
+
+    if (NextChunkIndex != GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX && Block->Chunks[NextChunkIndex].IsFree)
+    {
+        GCVulkanMemoryBlock_RemoveFreeChunk(Block, NextChunkIndex);
+
+        GCVulkanMemoryChunk* const Chunk = &Block->Chunks[ChunkIndex];
+        const GCVulkanMemoryChunk* const NextChunk = &Block->Chunks[NextChunkIndex];
+
+        Chunk->Size += NextChunk->Size;
+        Chunk->NextPhysicalIndex = NextChunk->NextPhysicalIndex;
+
+        if (NextChunk->NextPhysicalIndex != GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX)
+        {
+            Block->Chunks[NextChunk->NextPhysicalIndex].PreviousPhysicalIndex = ChunkIndex;
+        }
+
+        GCVulkanMemoryBlock_DestroyChunk(Block, NextChunkIndex);
+    }
+
+    const uint32_t PreviousChunkIndex = Block->Chunks[ChunkIndex].PreviousPhysicalIndex;
+
+    if (PreviousChunkIndex != GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX && Block->Chunks[PreviousChunkIndex].IsFree)
+    {
+        GCVulkanMemoryBlock_RemoveFreeChunk(Block, PreviousChunkIndex);
+
+        GCVulkanMemoryChunk* const PreviousChunk = &Block->Chunks[PreviousChunkIndex];
+        const GCVulkanMemoryChunk* const Chunk = &Block->Chunks[ChunkIndex];
+
+        PreviousChunk->Size += Chunk->Size;
+        PreviousChunk->NextPhysicalIndex = Chunk->NextPhysicalIndex;
+
+        if (Chunk->NextPhysicalIndex != GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX)
+        {
+            Block->Chunks[Chunk->NextPhysicalIndex].PreviousPhysicalIndex = PreviousChunkIndex;
+        }
+
+        GCVulkanMemoryBlock_DestroyChunk(Block, ChunkIndex);
+
+        ChunkIndex = PreviousChunkIndex;
+    }
+
+    GCVulkanMemoryBlock_InsertFreeChunk(Block, ChunkIndex);
+}
+
+uint32_t GCVulkanMemoryBlock_CreateChunk(GCVulkanMemoryBlock* const Block, const VkDeviceSize Offset,
+                                         const VkDeviceSize Size)
+{
+    if (Block->FirstUnusedChunkIndex == GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX)
+    {
+        const uint32_t NewChunkCapacity =
+            Block->ChunkCapacity ? Block->ChunkCapacity * 2 : GC_VULKAN_MEMORY_BLOCK_INITIAL_CHUNK_CAPACITY;
+
+        Block->Chunks =
+            (GCVulkanMemoryChunk*)GCMemory_Reallocate(Block->Chunks, NewChunkCapacity * sizeof(GCVulkanMemoryChunk));
+
+        for (uint32_t Counter = Block->ChunkCapacity; Counter < NewChunkCapacity; Counter++)
+        {
+            Block->Chunks[Counter].NextFreeIndex =
+                Counter + 1 < NewChunkCapacity ? Counter + 1 : GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX;
+        }
+
+        Block->FirstUnusedChunkIndex = Block->ChunkCapacity;
+        Block->ChunkCapacity = NewChunkCapacity;
+    }
+
+    const uint32_t ChunkIndex = Block->FirstUnusedChunkIndex;
+
+    GCVulkanMemoryChunk* const Chunk = &Block->Chunks[ChunkIndex];
+    Block->FirstUnusedChunkIndex = Chunk->NextFreeIndex;
+
+    Chunk->Offset = Offset;
+    Chunk->Size = Size;
+    Chunk->PreviousPhysicalIndex = GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX;
+    Chunk->NextPhysicalIndex = GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX;
+    Chunk->PreviousFreeIndex = GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX;
+    Chunk->NextFreeIndex = GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX;
+    Chunk->IsFree = true;
+
+    return ChunkIndex;
+}
+
+void GCVulkanMemoryBlock_DestroyChunk(GCVulkanMemoryBlock* const Block, const uint32_t ChunkIndex)
+{
+    Block->Chunks[ChunkIndex].NextFreeIndex = Block->FirstUnusedChunkIndex;
+    Block->FirstUnusedChunkIndex = ChunkIndex;
+}
+
+uint32_t GCVulkanMemoryBlock_FindFreeChunk(const GCVulkanMemoryBlock* const Block, VkDeviceSize Size)
+{
+    if (Size >= GC_VULKAN_MEMORY_BLOCK_SECOND_LEVEL_COUNT)
+    {
+        Size += ((VkDeviceSize)1 << (GCVulkanMemoryBlock_FindLastSetBit(Size) -
+                                     GC_VULKAN_MEMORY_BLOCK_SECOND_LEVEL_COUNT_LOG2)) -
+                1;
+    }
+
+    uint32_t FirstLevelIndex = 0, SecondLevelIndex = 0;
+    GCVulkanMemoryBlock_MapSize(Size, &FirstLevelIndex, &SecondLevelIndex);
+
+    uint32_t SecondLevelBitmap = Block->SecondLevelBitmaps[FirstLevelIndex] & (UINT32_MAX << SecondLevelIndex);
+
+    if (!SecondLevelBitmap)
+    {
+        if (FirstLevelIndex + 1 >= GC_VULKAN_MEMORY_BLOCK_FIRST_LEVEL_COUNT)
+        {
+            return GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX;
+        }
+
+        const uint64_t FirstLevelBitmap = Block->FirstLevelBitmap & (UINT64_MAX << (FirstLevelIndex + 1));
+
+        if (!FirstLevelBitmap)
+        {
+            return GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX;
+        }
+
+        FirstLevelIndex = GCVulkanMemoryBlock_FindFirstSetBit(FirstLevelBitmap);
+        SecondLevelBitmap = Block->SecondLevelBitmaps[FirstLevelIndex];
+    }
+
+    SecondLevelIndex = GCVulkanMemoryBlock_FindFirstSetBit(SecondLevelBitmap);
+
+    return Block->FreeChunkIndices[FirstLevelIndex][SecondLevelIndex];
+}
+
+void GCVulkanMemoryBlock_InsertFreeChunk(GCVulkanMemoryBlock* const Block, const uint32_t ChunkIndex)
+{
+    GCVulkanMemoryChunk* const Chunk = &Block->Chunks[ChunkIndex];
+
+    uint32_t FirstLevelIndex = 0, SecondLevelIndex = 0;
+    GCVulkanMemoryBlock_MapSize(Chunk->Size, &FirstLevelIndex, &SecondLevelIndex);
+
+    const uint32_t HeadChunkIndex = Block->FreeChunkIndices[FirstLevelIndex][SecondLevelIndex];
+
+    Chunk->IsFree = true;
+    Chunk->PreviousFreeIndex = GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX;
+    Chunk->NextFreeIndex = HeadChunkIndex;
+
+    if (HeadChunkIndex != GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX)
+    {
+        Block->Chunks[HeadChunkIndex].PreviousFreeIndex = ChunkIndex;
+    }
+
+    Block->FreeChunkIndices[FirstLevelIndex][SecondLevelIndex] = ChunkIndex;
+    Block->FirstLevelBitmap |= 1ull << FirstLevelIndex;
+    Block->SecondLevelBitmaps[FirstLevelIndex] |= 1u << SecondLevelIndex;
+}
+
+void GCVulkanMemoryBlock_RemoveFreeChunk(GCVulkanMemoryBlock* const Block, const uint32_t ChunkIndex)
+{
+    const GCVulkanMemoryChunk* const Chunk = &Block->Chunks[ChunkIndex];
+
+    if (Chunk->PreviousFreeIndex != GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX)
+    {
+        Block->Chunks[Chunk->PreviousFreeIndex].NextFreeIndex = Chunk->NextFreeIndex;
+    }
+
+    if (Chunk->NextFreeIndex != GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX)
+    {
+        Block->Chunks[Chunk->NextFreeIndex].PreviousFreeIndex = Chunk->PreviousFreeIndex;
+    }
+
+    uint32_t FirstLevelIndex = 0, SecondLevelIndex = 0;
+    GCVulkanMemoryBlock_MapSize(Chunk->Size, &FirstLevelIndex, &SecondLevelIndex);
+
+    if (Block->FreeChunkIndices[FirstLevelIndex][SecondLevelIndex] == ChunkIndex)
+    {
+        Block->FreeChunkIndices[FirstLevelIndex][SecondLevelIndex] = Chunk->NextFreeIndex;
+
+        if (Chunk->NextFreeIndex == GC_VULKAN_MEMORY_BLOCK_INVALID_INDEX)
+        {
+            Block->SecondLevelBitmaps[FirstLevelIndex] &= ~(1u << SecondLevelIndex);
+
+            if (!Block->SecondLevelBitmaps[FirstLevelIndex])
+            {
+                Block->FirstLevelBitmap &= ~(1ull << FirstLevelIndex);
+            }
+        }
+    }
+}
+
+void GCVulkanMemoryBlock_MapSize(const VkDeviceSize Size, uint32_t* const FirstLevelIndex,
+                                 uint32_t* const SecondLevelIndex)
+{
+    if (Size < GC_VULKAN_MEMORY_BLOCK_SECOND_LEVEL_COUNT)
+    {
+        *FirstLevelIndex = 0;
+        *SecondLevelIndex = (uint32_t)Size;
+    }
+    else
+    {
+        const uint32_t LastSetBit = GCVulkanMemoryBlock_FindLastSetBit(Size);
+
+        *FirstLevelIndex = LastSetBit - GC_VULKAN_MEMORY_BLOCK_SECOND_LEVEL_COUNT_LOG2 + 1;
+        *SecondLevelIndex = (uint32_t)(Size >> (LastSetBit - GC_VULKAN_MEMORY_BLOCK_SECOND_LEVEL_COUNT_LOG2)) -
+                            GC_VULKAN_MEMORY_BLOCK_SECOND_LEVEL_COUNT;
+    }
+}
+
+uint32_t GCVulkanMemoryBlock_FindFirstSetBit(const uint64_t Value)
+{
+#ifdef _MSC_VER
+    unsigned long Index = 0;
+    _BitScanForward64(&Index, Value);
+
+    return (uint32_t)Index;
+#else
+    return (uint32_t)__builtin_ctzll(Value);
+#endif
+}
+
+uint32_t GCVulkanMemoryBlock_FindLastSetBit(const uint64_t Value)
+{
+#ifdef _MSC_VER
+    unsigned long Index = 0;
+    _BitScanReverse64(&Index, Value);
+
+    return (uint32_t)Index;
+#else
+    return 63 - (uint32_t)__builtin_clzll(Value);
+#endif
+}
+
+VkDeviceSize GCVulkanMemoryBlock_AlignOffset(const VkDeviceSize Offset, const VkDeviceSize Alignment)
+{
+    return (Offset + Alignment - 1) / Alignment * Alignment;
+}
@@ -0,0 +1,81 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GC_RENDERER_VULKAN_VULKAN_MEMORY_ALLOCATOR_H
+#define GC_RENDERER_VULKAN_VULKAN_MEMORY_ALLOCATOR_H
+
+#include "Renderer/RendererDevice.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <vulkan/vulkan.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct GCVulkanMemoryAllocator GCVulkanMemoryAllocator;
+    typedef struct GCVulkanMemoryBlock GCVulkanMemoryBlock;
+
+    typedef enum GCVulkanMemoryAllocationStrategy
+    {
+        GCVulkanMemoryAllocationStrategy_General,
+        GCVulkanMemoryAllocationStrategy_Linear
+    } GCVulkanMemoryAllocationStrategy;
+
+    typedef enum GCVulkanMemoryResourceType
+    {
+        GCVulkanMemoryResourceType_Linear,
+        GCVulkanMemoryResourceType_Optimal
+    } GCVulkanMemoryResourceType;
+
+    typedef struct GCVulkanMemoryAllocationDescription
+    {
+        VkMemoryRequirements MemoryRequirements;
+        VkMemoryPropertyFlags MemoryProperty;
+        GCVulkanMemoryResourceType ResourceType;
+        GCVulkanMemoryAllocationStrategy Strategy;
+        bool IsDedicated;
+    } GCVulkanMemoryAllocationDescription;
+
+    typedef struct GCVulkanMemoryAllocation
+    {
+        VkDeviceMemory MemoryHandle;
+        VkDeviceSize Offset;
+        VkDeviceSize Size;
+        void* MappedData;
+
+        GCVulkanMemoryBlock* Block;
+        uint32_t ChunkIndex;
+    } GCVulkanMemoryAllocation;
+
+    GCVulkanMemoryAllocator* GCVulkanMemoryAllocator_Create(const GCRendererDevice* const Device);
+    GCVulkanMemoryAllocation GCVulkanMemoryAllocator_Allocate(
+        GCVulkanMemoryAllocator* const MemoryAllocator, const GCVulkanMemoryAllocationDescription* const Description);
+    void GCVulkanMemoryAllocator_Free(GCVulkanMemoryAllocator* const MemoryAllocator,
+                                      const GCVulkanMemoryAllocation* const Allocation);
+    GCRendererDeviceMemoryStatistics GCVulkanMemoryAllocator_GetStatistics(
+        const GCVulkanMemoryAllocator* const MemoryAllocator);
+    void GCVulkanMemoryAllocator_Destroy(GCVulkanMemoryAllocator* MemoryAllocator);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -21,13 +21,17 @@
 #include "Core/Memory/Allocator.h"
 #include "Renderer/RendererCommandList.h"
 #include "Renderer/RendererDevice.h"
+#include "Renderer/Vulkan/VulkanDeletionQueue.h"
+#include "Renderer/Vulkan/VulkanRendererComputePipeline.h"
 #include "Renderer/Vulkan/VulkanRendererDevice.h"
 #include "Renderer/Vulkan/VulkanRendererFramebuffer.h"
+#include "Renderer/Vulkan/VulkanRendererGeometryPool.h"
 #include "Renderer/Vulkan/VulkanRendererGraphicsPipeline.h"
 #include "Renderer/Vulkan/VulkanRendererIndexBuffer.h"
+#include "Renderer/Vulkan/VulkanRendererStorageBuffer.h"
 #include "Renderer/Vulkan/VulkanRendererSwapChain.h"
-#include "Renderer/Vulkan/VulkanRendererUniformBuffer.h"
 #include "Renderer/Vulkan/VulkanRendererVertexBuffer.h"
+#include "Renderer/Vulkan/VulkanUploadQueue.h"
 #include "Renderer/Vulkan/VulkanUtilities.h"
 
 #include <stdbool.h>
@@ -45,7 +49,11 @@ typedef struct GCRendererCommandList
     VkCommandBuffer* CommandBufferHandles;
     VkSemaphore* ImageAvailableSemaphoreHandles;
     VkSemaphore* RenderFinishedSemaphoreHandles;
+    VkSemaphore* UploadFinishedSemaphoreHandles;
     VkFence* InFlightFenceHandles;
+    uint64_t* InFlightFrameCounts;
+
+    GCVulkanUploadQueue* UploadQueue;
 
     GCRendererCommandListResizeCallbackFunction SwapChainResizeCallbackFunction;
     GCRendererCommandListResizeCallbackFunction AttachmentResizeCallbackFunction;
@@ -71,7 +79,10 @@ GCRendererCommandList* GCRendererCommandList_Create(const GCRendererCommandListD
     CommandList->CommandBufferHandles = NULL;
     CommandList->ImageAvailableSemaphoreHandles = NULL;
     CommandList->RenderFinishedSemaphoreHandles = NULL;
+    CommandList->UploadFinishedSemaphoreHandles = NULL;
     CommandList->InFlightFenceHandles = NULL;
+    CommandList->InFlightFrameCounts = NULL;
+    CommandList->UploadQueue = NULL;
     CommandList->SwapChainResizeCallbackFunction = NULL;
     CommandList->AttachmentResizeCallbackFunction = NULL;
     CommandList->ShouldSwapChainResize = false;
@@ -85,6 +96,9 @@ GCRendererCommandList* GCRendererCommandList_Create(const GCRendererCommandListD
     GCRendererCommandList_CreateSemaphores(CommandList);
     GCRendererCommandList_CreateFences(CommandList);
 
+    CommandList->UploadQueue =
+        GCVulkanUploadQueue_Create(CommandList->Device, CommandList->MaximumFramesInFlight + 1);
+
     return CommandList;
 }
 
@@ -123,6 +137,8 @@ void GCRendererCommandList_BeginRecord(GCRendererCommandList* const CommandList)
 
     vkWaitForFences(DeviceHandle, 1, &CommandList->InFlightFenceHandles[CommandList->CurrentFrame], VK_TRUE,
                     UINT64_MAX);
+    GCVulkanDeletionQueue_Release(GCRendererDevice_GetDeletionQueue(CommandList->Device),
+                                  CommandList->InFlightFrameCounts[CommandList->CurrentFrame]);
     VkResult SwapChainCheckResult =
         vkAcquireNextImageKHR(DeviceHandle, SwapChainHandle[0], UINT64_MAX,
                               CommandList->ImageAvailableSemaphoreHandles[CommandList->CurrentFrame], VK_NULL_HANDLE,
@@ -146,6 +162,16 @@ void GCRendererCommandList_BeginRecord(GCRendererCommandList* const CommandList)
                        "Failed to begin a Vulkan command buffer");
 }
 
+uint32_t GCRendererCommandList_GetCurrentFrame(const GCRendererCommandList* const CommandList)
+{
+    return CommandList->CurrentFrame;
+}
+
+uint32_t GCRendererCommandList_GetMaximumFramesInFlight(const GCRendererCommandList* const CommandList)
+{
+    return CommandList->MaximumFramesInFlight;
+}
+
 void GCRendererCommandList_BeginSwapChainRenderPass(const GCRendererCommandList* const CommandList,
                                                     const GCRendererGraphicsPipeline* const GraphicsPipeline,
                                                     const GCRendererFramebuffer* const Framebuffer,
@@ -184,6 +210,12 @@ void GCRendererCommandList_BeginAttachmentRenderPass(const GCRendererCommandList
     VkClearValue ClearValues[3] = {0};
     memcpy(ClearValues[0].color.float32, ClearColor, sizeof(ClearValues[0].color.float32));
 
+#ifdef GC_RENDERER_CPU_PICKING
+    ClearValues[1].depthStencil.depth = 1.0f;
+    ClearValues[1].depthStencil.stencil = 0;
+
+    RenderPassBeginInformation.clearValueCount = 2;
+#else
     const int32_t ClearColorInt[4] = {-1, -1, -1, -1};
     memcpy(ClearValues[1].color.int32, ClearColorInt, sizeof(ClearValues[1].color.int32));
 
@@ -191,6 +223,7 @@ void GCRendererCommandList_BeginAttachmentRenderPass(const GCRendererCommandList
     ClearValues[2].depthStencil.stencil = 0;
 
     RenderPassBeginInformation.clearValueCount = 3;
+#endif
     RenderPassBeginInformation.pClearValues = ClearValues;
 
     vkCmdBeginRenderPass(CommandList->CommandBufferHandles[CommandList->CurrentFrame], &RenderPassBeginInformation,
@@ -207,6 +240,16 @@ void GCRendererCommandList_BindVertexBuffer(const GCRendererCommandList* const C
                            Offsets);
 }
 
+void GCRendererCommandList_BindInstanceStorageBuffer(const GCRendererCommandList* const CommandList,
+                                                     const GCRendererStorageBuffer* const InstanceBuffer)
+{
+    const VkBuffer InstanceBufferHandle[1] = {GCRendererStorageBuffer_GetBufferHandle(InstanceBuffer)};
+    const VkDeviceSize Offsets[1] = {0};
+
+    vkCmdBindVertexBuffers(CommandList->CommandBufferHandles[CommandList->CurrentFrame], 1, 1, InstanceBufferHandle,
+                           Offsets);
+}
+
 void GCRendererCommandList_BindIndexBuffer(const GCRendererCommandList* const CommandList,
                                            const GCRendererIndexBuffer* const IndexBuffer)
 {
@@ -214,8 +257,21 @@ void GCRendererCommandList_BindIndexBuffer(const GCRendererCommandList* const Co
                          GCRendererIndexBuffer_GetHandle(IndexBuffer), 0, VK_INDEX_TYPE_UINT32);
 }
 
+void GCRendererCommandList_BindGeometryPool(const GCRendererCommandList* const CommandList,
+                                            const GCRendererGeometryPool* const GeometryPool)
+{
+    const VkBuffer VertexBufferHandle[1] = {GCRendererGeometryPool_GetVertexBufferHandle(GeometryPool)};
+    const VkDeviceSize Offsets[1] = {0};
+
+    vkCmdBindVertexBuffers(CommandList->CommandBufferHandles[CommandList->CurrentFrame], 0, 1, VertexBufferHandle,
+                           Offsets);
+    vkCmdBindIndexBuffer(CommandList->CommandBufferHandles[CommandList->CurrentFrame],
+                         GCRendererGeometryPool_GetIndexBufferHandle(GeometryPool), 0, VK_INDEX_TYPE_UINT32);
+}
+
 void GCRendererCommandList_BindGraphicsPipeline(const GCRendererCommandList* const CommandList,
-                                                const GCRendererGraphicsPipeline* const GraphicsPipeline)
+                                                const GCRendererGraphicsPipeline* const GraphicsPipeline,
+                                                const uint32_t UniformOffset)
 {
     vkCmdBindPipeline(CommandList->CommandBufferHandles[CommandList->CurrentFrame], VK_PIPELINE_BIND_POINT_GRAPHICS,
                       GCRendererGraphicsPipeline_GetPipelineHandle(GraphicsPipeline));
@@ -223,7 +279,52 @@ void GCRendererCommandList_BindGraphicsPipeline(const GCRendererCommandList* con
     const VkDescriptorSet DescriptorSetHandle = GCRendererGraphicsPipeline_GetDescriptorSetHandle(GraphicsPipeline);
     vkCmdBindDescriptorSets(
         CommandList->CommandBufferHandles[CommandList->CurrentFrame], VK_PIPELINE_BIND_POINT_GRAPHICS,
-        GCRendererGraphicsPipeline_GetPipelineLayoutHandle(GraphicsPipeline), 0, 1, &DescriptorSetHandle, 0, NULL);
+        GCRendererGraphicsPipeline_GetPipelineLayoutHandle(GraphicsPipeline), 0, 1, &DescriptorSetHandle, 1,
+        &UniformOffset);
+}
+
+void GCRendererCommandList_BindComputePipeline(const GCRendererCommandList* const CommandList,
+                                               const GCRendererComputePipeline* const ComputePipeline)
+{
+    vkCmdBindPipeline(CommandList->CommandBufferHandles[CommandList->CurrentFrame], VK_PIPELINE_BIND_POINT_COMPUTE,
+                      GCRendererComputePipeline_GetPipelineHandle(ComputePipeline));
+
+    const VkDescriptorSet DescriptorSetHandle = GCRendererComputePipeline_GetDescriptorSetHandle(ComputePipeline);
+    vkCmdBindDescriptorSets(CommandList->CommandBufferHandles[CommandList->CurrentFrame],
+                            VK_PIPELINE_BIND_POINT_COMPUTE,
+                            GCRendererComputePipeline_GetPipelineLayoutHandle(ComputePipeline), 0, 1,
+                            &DescriptorSetHandle, 0, NULL);
+}
+
+void GCRendererCommandList_PushComputeConstants(const GCRendererCommandList* const CommandList,
+                                                const GCRendererComputePipeline* const ComputePipeline,
+                                                const void* const Data, const uint32_t DataSize)
+{
+    vkCmdPushConstants(CommandList->CommandBufferHandles[CommandList->CurrentFrame],
+                       GCRendererComputePipeline_GetPipelineLayoutHandle(ComputePipeline),
+                       VK_SHADER_STAGE_COMPUTE_BIT, 0, DataSize, Data);
+}
+
+void GCRendererCommandList_Dispatch(const GCRendererCommandList* const CommandList, const uint32_t GroupCountX,
+                                    const uint32_t GroupCountY, const uint32_t GroupCountZ)
+{
+    vkCmdDispatch(CommandList->CommandBufferHandles[CommandList->CurrentFrame], GroupCountX, GroupCountY,
+                  GroupCountZ);
+}
+
+void GCRendererCommandList_ComputeToDrawBarrier(const GCRendererCommandList* const CommandList)
+{
+    VkMemoryBarrier MemoryBarrier = {0};
+    MemoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    MemoryBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    MemoryBarrier.dstAccessMask =
+        VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_HOST_READ_BIT;
+
+    vkCmdPipelineBarrier(CommandList->CommandBufferHandles[CommandList->CurrentFrame],
+                         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                         VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT |
+                             VK_PIPELINE_STAGE_HOST_BIT,
+                         0, 1, &MemoryBarrier, 0, NULL, 0, NULL);
 }
 
 void GCRendererCommandList_SetViewport(const GCRendererCommandList* const CommandList,
@@ -260,20 +361,49 @@ void GCRendererCommandList_DrawIndexed(const GCRendererCommandList* const Comman
     vkCmdDrawIndexed(CommandList->CommandBufferHandles[CommandList->CurrentFrame], IndexCount, 1, FirstIndex, 0, 0);
 }
 
+void GCRendererCommandList_DrawIndexedIndirect(const GCRendererCommandList* const CommandList,
+                                               const GCRendererStorageBuffer* const IndirectBuffer,
+                                               const uint32_t FirstCommand, const uint32_t CommandCount)
+{
+    const VkBuffer IndirectBufferHandle = GCRendererStorageBuffer_GetBufferHandle(IndirectBuffer);
+    const uint32_t Stride = sizeof(GCRendererDrawIndexedIndirectCommand);
+
+    if (GCRendererDevice_GetDeviceCapabilities(CommandList->Device).IsMultiDrawIndirectSupported)
+    {
+        vkCmdDrawIndexedIndirect(CommandList->CommandBufferHandles[CommandList->CurrentFrame], IndirectBufferHandle,
+                                 (VkDeviceSize)FirstCommand * Stride, CommandCount, Stride);
+    }
+    else
+    {
+        for (uint32_t Counter = 0; Counter < CommandCount; Counter++)
+        {
+            vkCmdDrawIndexedIndirect(CommandList->CommandBufferHandles[CommandList->CurrentFrame],
+                                     IndirectBufferHandle, (VkDeviceSize)(FirstCommand + Counter) * Stride, 1,
+                                     Stride);
+        }
+    }
+}
+
 void GCRendererCommandList_EndSwapChainRenderPass(const GCRendererCommandList* const CommandList)
 {
     vkCmdEndRenderPass(CommandList->CommandBufferHandles[CommandList->CurrentFrame]);
 }
 
 void GCRendererCommandList_EndAttachmentRenderPass(const GCRendererCommandList* const CommandList,
-                                                   const GCRendererFramebuffer* const Framebuffer)
+                                                   GCRendererFramebuffer* const Framebuffer)
 {
     vkCmdEndRenderPass(CommandList->CommandBufferHandles[CommandList->CurrentFrame]);
 
+#ifdef GC_RENDERER_CPU_PICKING
+    (void)Framebuffer;
+#else
     GCVulkanUtilities_TransitionImageLayout(CommandList->CommandBufferHandles[CommandList->CurrentFrame],
                                             GCRendererFramebuffer_GetColorAttachmentImageHandle(Framebuffer, 1), 1,
                                             VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
                                             VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+    GCRendererFramebuffer_RecordPixelReadback(Framebuffer, CommandList->CommandBufferHandles[CommandList->CurrentFrame],
+                                              CommandList->CurrentFrame);
+#endif
 }
 
 void GCRendererCommandList_EndRecord(const GCRendererCommandList* const CommandList)
@@ -286,13 +416,19 @@ void GCRendererCommandList_SubmitAndPresent(GCRendererCommandList* const Command
 {
     const VkSwapchainKHR SwapChainHandle[1] = {GCRendererSwapChain_GetHandle(CommandList->SwapChain)};
 
+    const bool HasUploads = GCVulkanUploadQueue_Submit(
+        CommandList->UploadQueue, CommandList->UploadFinishedSemaphoreHandles[CommandList->CurrentFrame]);
+
     VkSubmitInfo SubmitInformation = {0};
     SubmitInformation.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 
-    const VkSemaphore WaitSemaphoreHandle[1] = {CommandList->ImageAvailableSemaphoreHandles[CommandList->CurrentFrame]};
-    const VkPipelineStageFlags PipelineWaitStage[1] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
+    const VkSemaphore WaitSemaphoreHandle[2] = {CommandList->ImageAvailableSemaphoreHandles[CommandList->CurrentFrame],
+                                                CommandList->UploadFinishedSemaphoreHandles[CommandList->CurrentFrame]};
+    const VkPipelineStageFlags PipelineWaitStage[2] = {
+        VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+        VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT};
 
-    SubmitInformation.waitSemaphoreCount = 1;
+    SubmitInformation.waitSemaphoreCount = HasUploads ? 2 : 1;
     SubmitInformation.pWaitSemaphores = WaitSemaphoreHandle;
     SubmitInformation.pWaitDstStageMask = PipelineWaitStage;
     SubmitInformation.commandBufferCount = 1;
@@ -308,6 +444,11 @@ void GCRendererCommandList_SubmitAndPresent(GCRendererCommandList* const Command
                                      &SubmitInformation, CommandList->InFlightFenceHandles[CommandList->CurrentFrame]),
                        "Failed to submit a Vulkan queue");
 
+    GCVulkanDeletionQueue* const DeletionQueue = GCRendererDevice_GetDeletionQueue(CommandList->Device);
+    CommandList->InFlightFrameCounts[CommandList->CurrentFrame] =
+        GCVulkanDeletionQueue_GetFrameNumber(DeletionQueue) + 1;
+    GCVulkanDeletionQueue_AdvanceFrame(DeletionQueue);
+
     VkPresentInfoKHR PresentInformation = {0};
     PresentInformation.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
     PresentInformation.waitSemaphoreCount = 1;
@@ -373,14 +514,22 @@ void GCRendererCommandList_EndSingleTimeCommands(const GCRendererCommandList* co
 
     GC_VULKAN_VALIDATE(vkEndCommandBuffer(CommandBufferHandle), "Failed to end a Vulkan command buffer");
 
+    VkFenceCreateInfo FenceInformation = {0};
+    FenceInformation.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+    VkFence FenceHandle = VK_NULL_HANDLE;
+    GC_VULKAN_VALIDATE(vkCreateFence(DeviceHandle, &FenceInformation, NULL, &FenceHandle),
+                       "Failed to create a Vulkan fence");
+
     VkSubmitInfo SubmitInformation = {0};
     SubmitInformation.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
     SubmitInformation.commandBufferCount = 1;
     SubmitInformation.pCommandBuffers = &CommandBufferHandle;
 
-    vkQueueSubmit(GraphicsQueueHandle, 1, &SubmitInformation, VK_NULL_HANDLE);
-    vkQueueWaitIdle(GraphicsQueueHandle);
+    vkQueueSubmit(GraphicsQueueHandle, 1, &SubmitInformation, FenceHandle);
+    vkWaitForFences(DeviceHandle, 1, &FenceHandle, VK_TRUE, UINT64_MAX);
 
+    vkDestroyFence(DeviceHandle, FenceHandle, NULL);
     vkFreeCommandBuffers(DeviceHandle, TransientCommandPoolHandle, 1, &CommandBufferHandle);
 }
 
@@ -389,6 +538,11 @@ VkCommandBuffer GCRendererCommandList_GetCurrentFrameCommandBufferHandle(const G
     return CommandList->CommandBufferHandles[CommandList->CurrentFrame];
 }
 
+GCVulkanUploadQueue* GCRendererCommandList_GetUploadQueue(const GCRendererCommandList* const CommandList)
+{
+    return CommandList->UploadQueue;
+}
+
 void GCRendererCommandList_CreateCommandPool(GCRendererCommandList* const CommandList)
 {
     const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(CommandList->Device);
@@ -439,6 +593,8 @@ void GCRendererCommandList_CreateSemaphores(GCRendererCommandList* const Command
         (VkSemaphore*)GCMemory_Allocate(CommandList->MaximumFramesInFlight * sizeof(VkSemaphore));
     CommandList->RenderFinishedSemaphoreHandles =
         (VkSemaphore*)GCMemory_Allocate(CommandList->MaximumFramesInFlight * sizeof(VkSemaphore));
+    CommandList->UploadFinishedSemaphoreHandles =
+        (VkSemaphore*)GCMemory_Allocate(CommandList->MaximumFramesInFlight * sizeof(VkSemaphore));
 
     VkSemaphoreCreateInfo SemaphoreInformation = {0};
     SemaphoreInformation.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
@@ -451,6 +607,9 @@ void GCRendererCommandList_CreateSemaphores(GCRendererCommandList* const Command
         GC_VULKAN_VALIDATE(vkCreateSemaphore(DeviceHandle, &SemaphoreInformation, NULL,
                                              &CommandList->RenderFinishedSemaphoreHandles[Counter]),
                            "Failed to create a Vulkan semaphore");
+        GC_VULKAN_VALIDATE(vkCreateSemaphore(DeviceHandle, &SemaphoreInformation, NULL,
+                                             &CommandList->UploadFinishedSemaphoreHandles[Counter]),
+                           "Failed to create a Vulkan semaphore");
     }
 }
 
@@ -460,6 +619,8 @@ void GCRendererCommandList_CreateFences(GCRendererCommandList* const CommandList
 
     CommandList->InFlightFenceHandles =
         (VkFence*)GCMemory_Allocate(CommandList->MaximumFramesInFlight * sizeof(VkFence));
+    CommandList->InFlightFrameCounts =
+        (uint64_t*)GCMemory_AllocateZero(CommandList->MaximumFramesInFlight * sizeof(uint64_t));
 
     VkFenceCreateInfo FenceInformation = {0};
     FenceInformation.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
@@ -477,18 +638,23 @@ void GCRendererCommandList_DestroyObjects(GCRendererCommandList* const CommandLi
 {
     const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(CommandList->Device);
 
+    GCVulkanUploadQueue_Destroy(CommandList->UploadQueue);
+
     for (uint32_t Counter = 0; Counter < CommandList->MaximumFramesInFlight; Counter++)
     {
         vkDestroyFence(DeviceHandle, CommandList->InFlightFenceHandles[Counter], NULL);
         vkDestroySemaphore(DeviceHandle, CommandList->RenderFinishedSemaphoreHandles[Counter], NULL);
+        vkDestroySemaphore(DeviceHandle, CommandList->UploadFinishedSemaphoreHandles[Counter], NULL);
         vkDestroySemaphore(DeviceHandle, CommandList->ImageAvailableSemaphoreHandles[Counter], NULL);
     }
 
     vkDestroyCommandPool(DeviceHandle, CommandList->TransientCommandPoolHandle, NULL);
     vkDestroyCommandPool(DeviceHandle, CommandList->CommandPoolHandle, NULL);
 
+    GCMemory_Free(CommandList->InFlightFrameCounts);
     GCMemory_Free(CommandList->InFlightFenceHandles);
     GCMemory_Free(CommandList->RenderFinishedSemaphoreHandles);
+    GCMemory_Free(CommandList->UploadFinishedSemaphoreHandles);
     GCMemory_Free(CommandList->ImageAvailableSemaphoreHandles);
     GCMemory_Free(CommandList->CommandBufferHandles);
 }
\ No newline at end of file
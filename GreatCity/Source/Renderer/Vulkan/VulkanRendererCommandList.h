@@ -28,6 +28,7 @@ extern "C"
 #endif
 
     typedef struct GCRendererCommandList GCRendererCommandList;
+    typedef struct GCVulkanUploadQueue GCVulkanUploadQueue;
 
     VkCommandBuffer GCRendererCommandList_BeginSingleTimeCommands(const GCRendererCommandList* const CommandList);
     void GCRendererCommandList_EndSingleTimeCommands(const GCRendererCommandList* const CommandList,
@@ -35,6 +36,7 @@ extern "C"
 
     VkCommandBuffer GCRendererCommandList_GetCurrentFrameCommandBufferHandle(
         const GCRendererCommandList* const CommandList);
+    GCVulkanUploadQueue* GCRendererCommandList_GetUploadQueue(const GCRendererCommandList* const CommandList);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,256 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "Renderer/Vulkan/VulkanRendererComputePipeline.h"
+#include "Core/Assert.h"
+#include "Core/Log.h"
+#include "Core/Memory/Allocator.h"
+#include "Renderer/RendererCommandList.h"
+#include "Renderer/RendererComputePipeline.h"
+#include "Renderer/RendererDevice.h"
+#include "Renderer/Vulkan/VulkanRendererDevice.h"
+#include "Renderer/Vulkan/VulkanRendererShader.h"
+#include "Renderer/Vulkan/VulkanRendererStorageBuffer.h"
+#include "Renderer/Vulkan/VulkanUtilities.h"
+
+#include <stdint.h>
+
+#include <vulkan/vulkan.h>
+
+typedef struct GCRendererComputePipeline
+{
+    const GCRendererDevice* Device;
+    const GCRendererCommandList* CommandList;
+    const GCRendererShader* Shader;
+
+    VkDescriptorSetLayout DescriptorSetLayoutHandle;
+    VkDescriptorPool DescriptorPoolHandle;
+    VkDescriptorSet* DescriptorSetHandles;
+    VkPipelineLayout PipelineLayoutHandle;
+    VkPipeline PipelineHandle;
+
+    uint32_t StorageBufferCount;
+    uint32_t PushConstantSize;
+    uint32_t DescriptorSetCount;
+} GCRendererComputePipeline;
+
+static void GCRendererComputePipeline_CreateDescriptorSetLayout(GCRendererComputePipeline* const ComputePipeline);
+static void GCRendererComputePipeline_CreateComputePipeline(GCRendererComputePipeline* const ComputePipeline);
+static void GCRendererComputePipeline_CreateDescriptorPool(GCRendererComputePipeline* const ComputePipeline);
+static void GCRendererComputePipeline_CreateDescriptorSets(GCRendererComputePipeline* const ComputePipeline);
+static void GCRendererComputePipeline_DestroyObjects(GCRendererComputePipeline* const ComputePipeline);
+
+GCRendererComputePipeline* GCRendererComputePipeline_Create(
+    const GCRendererComputePipelineDescription* const Description)
+{
+    GCRendererComputePipeline* ComputePipeline =
+        (GCRendererComputePipeline*)GCMemory_Allocate(sizeof(GCRendererComputePipeline));
+    ComputePipeline->Device = Description->Device;
+    ComputePipeline->CommandList = Description->CommandList;
+    ComputePipeline->Shader = Description->Shader;
+    ComputePipeline->DescriptorSetLayoutHandle = VK_NULL_HANDLE;
+    ComputePipeline->DescriptorPoolHandle = VK_NULL_HANDLE;
+    ComputePipeline->DescriptorSetHandles = NULL;
+    ComputePipeline->PipelineLayoutHandle = VK_NULL_HANDLE;
+    ComputePipeline->PipelineHandle = VK_NULL_HANDLE;
+    ComputePipeline->StorageBufferCount = Description->StorageBufferCount;
+    ComputePipeline->PushConstantSize = Description->PushConstantSize;
+    ComputePipeline->DescriptorSetCount = GCRendererCommandList_GetMaximumFramesInFlight(Description->CommandList);
+
+    GCRendererComputePipeline_CreateDescriptorSetLayout(ComputePipeline);
+    GCRendererComputePipeline_CreateComputePipeline(ComputePipeline);
+    GCRendererComputePipeline_CreateDescriptorPool(ComputePipeline);
+    GCRendererComputePipeline_CreateDescriptorSets(ComputePipeline);
+
+    return ComputePipeline;
+}
+
+void GCRendererComputePipeline_SetStorageBuffer(const GCRendererComputePipeline* const ComputePipeline,
+                                                const uint32_t Binding,
+                                                const GCRendererStorageBuffer* const StorageBuffer)
+{
+    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(ComputePipeline->Device);
+
+    VkDescriptorBufferInfo DescriptorBufferInformation = {0};
+    DescriptorBufferInformation.buffer = GCRendererStorageBuffer_GetBufferHandle(StorageBuffer);
+    DescriptorBufferInformation.offset = 0;
+    DescriptorBufferInformation.range = VK_WHOLE_SIZE;
+
+    VkWriteDescriptorSet WriteDescriptorSet = {0};
+    WriteDescriptorSet.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    WriteDescriptorSet.dstSet = GCRendererComputePipeline_GetDescriptorSetHandle(ComputePipeline);
+    WriteDescriptorSet.dstBinding = Binding;
+    WriteDescriptorSet.dstArrayElement = 0;
+    WriteDescriptorSet.descriptorCount = 1;
+    WriteDescriptorSet.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    WriteDescriptorSet.pBufferInfo = &DescriptorBufferInformation;
+
+    vkUpdateDescriptorSets(DeviceHandle, 1, &WriteDescriptorSet, 0, NULL);
+}
+
+void GCRendererComputePipeline_Destroy(GCRendererComputePipeline* ComputePipeline)
+{
+    GCRendererDevice_WaitIdle(ComputePipeline->Device);
+
+    GCRendererComputePipeline_DestroyObjects(ComputePipeline);
+
+    GCMemory_Free(ComputePipeline->DescriptorSetHandles);
+    GCMemory_Free(ComputePipeline);
+}
+
+VkPipelineLayout GCRendererComputePipeline_GetPipelineLayoutHandle(
+    const GCRendererComputePipeline* const ComputePipeline)
+{
+    return ComputePipeline->PipelineLayoutHandle;
+}
+
+VkPipeline GCRendererComputePipeline_GetPipelineHandle(const GCRendererComputePipeline* const ComputePipeline)
+{
+    return ComputePipeline->PipelineHandle;
+}
+
+VkDescriptorSet GCRendererComputePipeline_GetDescriptorSetHandle(
+    const GCRendererComputePipeline* const ComputePipeline)
+{
+    const uint32_t CurrentFrame = GCRendererCommandList_GetCurrentFrame(ComputePipeline->CommandList);
+
+    return ComputePipeline->DescriptorSetHandles[CurrentFrame];
+}
+
+void GCRendererComputePipeline_CreateDescriptorSetLayout(GCRendererComputePipeline* const ComputePipeline)
+{
+    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(ComputePipeline->Device);
+
+    VkDescriptorSetLayoutBinding* DescriptorSetLayoutBindings = (VkDescriptorSetLayoutBinding*)GCMemory_AllocateZero(
+        ComputePipeline->StorageBufferCount * sizeof(VkDescriptorSetLayoutBinding));
+
+    for (uint32_t Counter = 0; Counter < ComputePipeline->StorageBufferCount; Counter++)
+    {
+        DescriptorSetLayoutBindings[Counter].binding = Counter;
+        DescriptorSetLayoutBindings[Counter].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        DescriptorSetLayoutBindings[Counter].descriptorCount = 1;
+        DescriptorSetLayoutBindings[Counter].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    }
+
+    VkDescriptorSetLayoutCreateInfo DescriptorSetLayoutInformation = {0};
+    DescriptorSetLayoutInformation.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    DescriptorSetLayoutInformation.bindingCount = ComputePipeline->StorageBufferCount;
+    DescriptorSetLayoutInformation.pBindings = DescriptorSetLayoutBindings;
+
+    GC_VULKAN_VALIDATE(vkCreateDescriptorSetLayout(DeviceHandle, &DescriptorSetLayoutInformation, NULL,
+                                                   &ComputePipeline->DescriptorSetLayoutHandle),
+                       "Failed to create a Vulkan descriptor set layout");
+
+    GCMemory_Free(DescriptorSetLayoutBindings);
+}
+
+void GCRendererComputePipeline_CreateComputePipeline(GCRendererComputePipeline* const ComputePipeline)
+{
+    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(ComputePipeline->Device);
+
+    VkPipelineLayoutCreateInfo PipelineLayoutInformation = {0};
+    PipelineLayoutInformation.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    PipelineLayoutInformation.setLayoutCount = 1;
+    PipelineLayoutInformation.pSetLayouts = &ComputePipeline->DescriptorSetLayoutHandle;
+
+    VkPushConstantRange PushConstantRange = {0};
+    PushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    PushConstantRange.offset = 0;
+    PushConstantRange.size = ComputePipeline->PushConstantSize;
+
+    if (ComputePipeline->PushConstantSize)
+    {
+        PipelineLayoutInformation.pushConstantRangeCount = 1;
+        PipelineLayoutInformation.pPushConstantRanges = &PushConstantRange;
+    }
+
+    GC_VULKAN_VALIDATE(
+        vkCreatePipelineLayout(DeviceHandle, &PipelineLayoutInformation, NULL, &ComputePipeline->PipelineLayoutHandle),
+        "Failed to create a Vulkan pipeline layout");
+
+    VkPipelineShaderStageCreateInfo ComputeShaderStageInformation = {0};
+    ComputeShaderStageInformation.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    ComputeShaderStageInformation.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    ComputeShaderStageInformation.module = GCRendererShader_GetComputeShaderModuleHandle(ComputePipeline->Shader);
+    ComputeShaderStageInformation.pName = "main";
+
+    VkComputePipelineCreateInfo ComputePipelineInformation = {0};
+    ComputePipelineInformation.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    ComputePipelineInformation.stage = ComputeShaderStageInformation;
+    ComputePipelineInformation.layout = ComputePipeline->PipelineLayoutHandle;
+
+    GC_VULKAN_VALIDATE(vkCreateComputePipelines(DeviceHandle, VK_NULL_HANDLE, 1, &ComputePipelineInformation, NULL,
+                                                &ComputePipeline->PipelineHandle),
+                       "Failed to create a Vulkan compute pipeline");
+}
+
+void GCRendererComputePipeline_CreateDescriptorPool(GCRendererComputePipeline* const ComputePipeline)
+{
+    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(ComputePipeline->Device);
+
+    VkDescriptorPoolSize DescriptorPoolSize = {0};
+    DescriptorPoolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    DescriptorPoolSize.descriptorCount = ComputePipeline->StorageBufferCount * ComputePipeline->DescriptorSetCount;
+
+    VkDescriptorPoolCreateInfo DescriptorPoolInformation = {0};
+    DescriptorPoolInformation.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    DescriptorPoolInformation.maxSets = ComputePipeline->DescriptorSetCount;
+    DescriptorPoolInformation.poolSizeCount = 1;
+    DescriptorPoolInformation.pPoolSizes = &DescriptorPoolSize;
+
+    GC_VULKAN_VALIDATE(
+        vkCreateDescriptorPool(DeviceHandle, &DescriptorPoolInformation, NULL, &ComputePipeline->DescriptorPoolHandle),
+        "Failed to create a Vulkan descriptor pool");
+}
+
+void GCRendererComputePipeline_CreateDescriptorSets(GCRendererComputePipeline* const ComputePipeline)
+{
+    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(ComputePipeline->Device);
+
+    VkDescriptorSetLayout* DescriptorSetLayoutHandles = (VkDescriptorSetLayout*)GCMemory_Allocate(
+        ComputePipeline->DescriptorSetCount * sizeof(VkDescriptorSetLayout));
+
+    for (uint32_t Counter = 0; Counter < ComputePipeline->DescriptorSetCount; Counter++)
+    {
+        DescriptorSetLayoutHandles[Counter] = ComputePipeline->DescriptorSetLayoutHandle;
+    }
+
+    ComputePipeline->DescriptorSetHandles =
+        (VkDescriptorSet*)GCMemory_AllocateZero(ComputePipeline->DescriptorSetCount * sizeof(VkDescriptorSet));
+
+    VkDescriptorSetAllocateInfo DescriptorSetAllocateInformation = {0};
+    DescriptorSetAllocateInformation.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    DescriptorSetAllocateInformation.descriptorPool = ComputePipeline->DescriptorPoolHandle;
+    DescriptorSetAllocateInformation.descriptorSetCount = ComputePipeline->DescriptorSetCount;
+    DescriptorSetAllocateInformation.pSetLayouts = DescriptorSetLayoutHandles;
+
+    GC_VULKAN_VALIDATE(vkAllocateDescriptorSets(DeviceHandle, &DescriptorSetAllocateInformation,
+                                                ComputePipeline->DescriptorSetHandles),
+                       "Failed to allocate Vulkan descriptor sets");
+
+    GCMemory_Free(DescriptorSetLayoutHandles);
+}
+
+void GCRendererComputePipeline_DestroyObjects(GCRendererComputePipeline* const ComputePipeline)
+{
+    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(ComputePipeline->Device);
+
+    vkDestroyDescriptorPool(DeviceHandle, ComputePipeline->DescriptorPoolHandle, NULL);
+
+    vkDestroyPipeline(DeviceHandle, ComputePipeline->PipelineHandle, NULL);
+    vkDestroyPipelineLayout(DeviceHandle, ComputePipeline->PipelineLayoutHandle, NULL);
+    vkDestroyDescriptorSetLayout(DeviceHandle, ComputePipeline->DescriptorSetLayoutHandle, NULL);
+}
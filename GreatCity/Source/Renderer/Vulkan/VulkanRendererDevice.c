@@ -20,6 +20,8 @@
 #include "Core/Log.h"
 #include "Core/Memory/Allocator.h"
 #include "Renderer/RendererDevice.h"
+#include "Renderer/Vulkan/VulkanDeletionQueue.h"
+#include "Renderer/Vulkan/VulkanMemoryAllocator.h"
 #include "Renderer/Vulkan/VulkanRendererSwapChain.h"
 #include "Renderer/Vulkan/VulkanUtilities.h"
 
@@ -31,6 +33,8 @@
 
 #ifdef GC_PLATFORM_WINDOWS
 #define GC_VULKAN_PLATFORM_REQUIRED_EXTENSION_NAME "VK_KHR_win32_surface"
+#elif defined(GC_PLATFORM_LINUX)
+#define GC_VULKAN_PLATFORM_REQUIRED_EXTENSION_NAME "VK_EXT_headless_surface"
 #endif
 
 typedef struct GCRendererDevice
@@ -42,10 +46,14 @@ typedef struct GCRendererDevice
     VkDevice DeviceHandle;
     VkQueue GraphicsQueueHandle;
     VkQueue PresentQueueHandle;
+    VkQueue TransferQueueHandle;
 
     bool IsValidationLayerEnabled;
-    uint32_t GraphicsFamilyQueueIndex, PresentFamilyQueueIndex;
+    uint32_t GraphicsFamilyQueueIndex, PresentFamilyQueueIndex, TransferFamilyQueueIndex;
     GCRendererDeviceCapabilities Capabilities;
+
+    GCVulkanMemoryAllocator* MemoryAllocator;
+    GCVulkanDeletionQueue* DeletionQueue;
 } GCRendererDevice;
 
 typedef struct GCRendererDeviceQueueFamilyIndices
@@ -54,6 +62,8 @@ typedef struct GCRendererDeviceQueueFamilyIndices
     bool GraphicsFamilyHasValue;
     uint32_t PresentFamily;
     bool PresentFamilyHasValue;
+    uint32_t TransferFamily;
+    bool TransferFamilyHasValue;
 } GCRendererDeviceQueueFamilyIndices;
 
 static bool GCRendererDevice_IsValidationLayerSupported(void);
@@ -92,6 +102,7 @@ GCRendererDevice* GCRendererDevice_Create(void)
     Device->DeviceHandle = VK_NULL_HANDLE;
     Device->GraphicsQueueHandle = VK_NULL_HANDLE;
     Device->PresentQueueHandle = VK_NULL_HANDLE;
+    Device->TransferQueueHandle = VK_NULL_HANDLE;
 
 #ifndef GC_BUILD_TYPE_DISTRIBUTION
     Device->IsValidationLayerEnabled = true;
@@ -101,7 +112,10 @@ GCRendererDevice* GCRendererDevice_Create(void)
 
     Device->GraphicsFamilyQueueIndex = 0;
     Device->PresentFamilyQueueIndex = 0;
+    Device->TransferFamilyQueueIndex = 0;
     Device->Capabilities = (GCRendererDeviceCapabilities){0};
+    Device->MemoryAllocator = NULL;
+    Device->DeletionQueue = NULL;
 
     if (Device->IsValidationLayerEnabled && !GCRendererDevice_IsValidationLayerSupported())
     {
@@ -117,8 +131,11 @@ GCRendererDevice* GCRendererDevice_Create(void)
 
     GCRendererDevice_CreateSurface(Device->InstanceHandle, &Device->SurfaceHandle);
     GCRendererDevice_SelectPhysicalDevice(Device);
-    GCRendererDevice_CreateDevice(Device);
     GCRendererDevice_QueryDeviceCapabilities(Device);
+    GCRendererDevice_CreateDevice(Device);
+
+    Device->MemoryAllocator = GCVulkanMemoryAllocator_Create(Device);
+    Device->DeletionQueue = GCVulkanDeletionQueue_Create(Device);
 
     return Device;
 }
@@ -133,6 +150,11 @@ GCRendererDeviceCapabilities GCRendererDevice_GetDeviceCapabilities(const GCRend
     return Device->Capabilities;
 }
 
+GCRendererDeviceMemoryStatistics GCRendererDevice_GetMemoryStatistics(const GCRendererDevice* const Device)
+{
+    return GCVulkanMemoryAllocator_GetStatistics(Device->MemoryAllocator);
+}
+
 void GCRendererDevice_Destroy(GCRendererDevice* Device)
 {
     GCRendererDevice_WaitIdle(Device);
@@ -182,6 +204,26 @@ VkQueue GCRendererDevice_GetPresentQueueHandle(const GCRendererDevice* const Dev
     return Device->PresentQueueHandle;
 }
 
+uint32_t GCRendererDevice_GetTransferFamilyQueueIndex(const GCRendererDevice* const Device)
+{
+    return Device->TransferFamilyQueueIndex;
+}
+
+VkQueue GCRendererDevice_GetTransferQueueHandle(const GCRendererDevice* const Device)
+{
+    return Device->TransferQueueHandle;
+}
+
+GCVulkanMemoryAllocator* GCRendererDevice_GetMemoryAllocator(const GCRendererDevice* const Device)
+{
+    return Device->MemoryAllocator;
+}
+
+GCVulkanDeletionQueue* GCRendererDevice_GetDeletionQueue(const GCRendererDevice* const Device)
+{
+    return Device->DeletionQueue;
+}
+
 uint32_t GCRendererDevice_GetMemoryTypeIndex(const GCRendererDevice* const Device, const uint32_t TypeFilter,
                                              const VkMemoryPropertyFlags PropertyFlags)
 {
@@ -238,8 +280,11 @@ bool GCRendererDevice_IsDeviceSuitable(const VkPhysicalDevice PhysicalDeviceHand
         IsSwapChainSupported = GCRendererSwapChain_IsSwapChainSupported(PhysicalDeviceHandle, SurfaceHandle);
     }
 
+    VkPhysicalDeviceFeatures PhysicalDeviceFeatures = {0};
+    vkGetPhysicalDeviceFeatures(PhysicalDeviceHandle, &PhysicalDeviceFeatures);
+
     return QueueFamilyIndices.GraphicsFamilyHasValue && QueueFamilyIndices.PresentFamilyHasValue &&
-           IsExtensionSupported && IsSwapChainSupported;
+           IsExtensionSupported && IsSwapChainSupported && PhysicalDeviceFeatures.drawIndirectFirstInstance;
 }
 
 GCRendererDeviceQueueFamilyIndices GCRendererDevice_FindQueueFamilies(const VkPhysicalDevice PhysicalDeviceHandle,
@@ -256,7 +301,21 @@ GCRendererDeviceQueueFamilyIndices GCRendererDevice_FindQueueFamilies(const VkPh
 
     for (uint32_t Counter = 0; Counter < QueueFamilyCount; Counter++)
     {
-        if (QueueFamilies[Counter].queueFlags & VK_QUEUE_GRAPHICS_BIT)
+        const VkQueueFlags QueueFlags = QueueFamilies[Counter].queueFlags;
+
+        if ((QueueFlags & VK_QUEUE_TRANSFER_BIT) && !(QueueFlags & VK_QUEUE_GRAPHICS_BIT) &&
+            (!QueueFamilyIndices.TransferFamilyHasValue || !(QueueFlags & VK_QUEUE_COMPUTE_BIT)))
+        {
+            QueueFamilyIndices.TransferFamily = Counter;
+            QueueFamilyIndices.TransferFamilyHasValue = true;
+        }
+
+        if (QueueFamilyIndices.GraphicsFamilyHasValue && QueueFamilyIndices.PresentFamilyHasValue)
+        {
+            continue;
+        }
+
+        if (QueueFlags & VK_QUEUE_GRAPHICS_BIT)
         {
             QueueFamilyIndices.GraphicsFamily = Counter;
             QueueFamilyIndices.GraphicsFamilyHasValue = true;
@@ -270,11 +329,6 @@ GCRendererDeviceQueueFamilyIndices GCRendererDevice_FindQueueFamilies(const VkPh
             QueueFamilyIndices.PresentFamily = Counter;
             QueueFamilyIndices.PresentFamilyHasValue = true;
         }
-
-        if (QueueFamilyIndices.GraphicsFamilyHasValue && QueueFamilyIndices.PresentFamilyHasValue)
-        {
-            break;
-        }
     }
 
     GCMemory_Free(QueueFamilies);
@@ -408,41 +462,46 @@ void GCRendererDevice_CreateDevice(GCRendererDevice* const Device)
         GCRendererDevice_FindQueueFamilies(Device->PhysicalDeviceHandle, Device->SurfaceHandle);
     Device->GraphicsFamilyQueueIndex = QueueFamilyIndices.GraphicsFamily;
     Device->PresentFamilyQueueIndex = QueueFamilyIndices.PresentFamily;
+    Device->TransferFamilyQueueIndex = QueueFamilyIndices.TransferFamilyHasValue ? QueueFamilyIndices.TransferFamily
+                                                                                 : QueueFamilyIndices.GraphicsFamily;
+
+    const uint32_t QueueFamilyIndexArray[3] = {Device->GraphicsFamilyQueueIndex, Device->PresentFamilyQueueIndex,
+                                               Device->TransferFamilyQueueIndex};
+    const float QueuePriority = 1.0f;
 
-    VkDeviceQueueCreateInfo DeviceQueueInformation[2] = {0};
+    VkDeviceQueueCreateInfo DeviceQueueInformation[3] = {0};
     uint32_t DeviceQueueInformationCount = 0;
 
-    if (QueueFamilyIndices.GraphicsFamily == QueueFamilyIndices.PresentFamily)
+    for (uint32_t Counter = 0; Counter < 3; Counter++)
     {
-        DeviceQueueInformation[0].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-        DeviceQueueInformation[0].queueFamilyIndex = QueueFamilyIndices.GraphicsFamily;
-        DeviceQueueInformation[0].queueCount = 1;
+        bool IsQueueFamilyUnique = true;
 
-        const float QueuePriority = 1.0f;
-        DeviceQueueInformation[0].pQueuePriorities = &QueuePriority;
-
-        DeviceQueueInformationCount = 1;
-    }
-    else
-    {
-        const float QueuePriority = 1.0f;
+        for (uint32_t InformationIndex = 0; InformationIndex < DeviceQueueInformationCount; InformationIndex++)
+        {
+            if (DeviceQueueInformation[InformationIndex].queueFamilyIndex == QueueFamilyIndexArray[Counter])
+            {
+                IsQueueFamilyUnique = false;
 
-        DeviceQueueInformation[0].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-        DeviceQueueInformation[0].queueFamilyIndex = QueueFamilyIndices.GraphicsFamily;
-        DeviceQueueInformation[0].queueCount = 1;
-        DeviceQueueInformation[0].pQueuePriorities = &QueuePriority;
+                break;
+            }
+        }
 
-        DeviceQueueInformation[1].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-        DeviceQueueInformation[1].queueFamilyIndex = QueueFamilyIndices.PresentFamily;
-        DeviceQueueInformation[1].queueCount = 1;
-        DeviceQueueInformation[1].pQueuePriorities = &QueuePriority;
+        if (IsQueueFamilyUnique)
+        {
+            DeviceQueueInformation[DeviceQueueInformationCount].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+            DeviceQueueInformation[DeviceQueueInformationCount].queueFamilyIndex = QueueFamilyIndexArray[Counter];
+            DeviceQueueInformation[DeviceQueueInformationCount].queueCount = 1;
+            DeviceQueueInformation[DeviceQueueInformationCount].pQueuePriorities = &QueuePriority;
 
-        DeviceQueueInformationCount = 2;
+            DeviceQueueInformationCount++;
+        }
     }
 
     VkPhysicalDeviceFeatures DeviceFeatures = {0};
     DeviceFeatures.samplerAnisotropy = VK_TRUE;
     DeviceFeatures.independentBlend = VK_TRUE;
+    DeviceFeatures.drawIndirectFirstInstance = VK_TRUE;
+    DeviceFeatures.multiDrawIndirect = Device->Capabilities.IsMultiDrawIndirectSupported;
 
     VkDeviceCreateInfo DeviceInformation = {0};
     DeviceInformation.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
@@ -468,6 +527,7 @@ void GCRendererDevice_CreateDevice(GCRendererDevice* const Device)
 
     vkGetDeviceQueue(Device->DeviceHandle, QueueFamilyIndices.GraphicsFamily, 0, &Device->GraphicsQueueHandle);
     vkGetDeviceQueue(Device->DeviceHandle, QueueFamilyIndices.PresentFamily, 0, &Device->PresentQueueHandle);
+    vkGetDeviceQueue(Device->DeviceHandle, Device->TransferFamilyQueueIndex, 0, &Device->TransferQueueHandle);
 }
 
 void GCRendererDevice_QueryDeviceCapabilities(GCRendererDevice* const Device)
@@ -480,6 +540,11 @@ void GCRendererDevice_QueryDeviceCapabilities(GCRendererDevice* const Device)
 
     Device->Capabilities.IsAnisotropySupported = PhysicalDeviceFeatures.samplerAnisotropy;
     Device->Capabilities.MaximumAnisotropy = PhysicalDeviceProperties.limits.maxSamplerAnisotropy;
+    Device->Capabilities.IsMultiDrawIndirectSupported = PhysicalDeviceFeatures.multiDrawIndirect;
+    Device->Capabilities.MinimumUniformBufferOffsetAlignment =
+        (uint32_t)PhysicalDeviceProperties.limits.minUniformBufferOffsetAlignment;
+    Device->Capabilities.MinimumStorageBufferOffsetAlignment =
+        (uint32_t)PhysicalDeviceProperties.limits.minStorageBufferOffsetAlignment;
 }
 
 VKAPI_ATTR VkBool32 VKAPI_CALL GCRendererDevice_DebugCallback(VkDebugUtilsMessageSeverityFlagBitsEXT Severity,
@@ -507,6 +572,9 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GCRendererDevice_DebugCallback(VkDebugUtilsMessag
 
         break;
     }
+    default: {
+        break;
+    }
     }
 
     return VK_FALSE;
@@ -514,6 +582,9 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GCRendererDevice_DebugCallback(VkDebugUtilsMessag
 
 void GCRendererDevice_DestroyObjects(GCRendererDevice* const Device)
 {
+    GCVulkanDeletionQueue_Destroy(Device->DeletionQueue);
+    GCVulkanMemoryAllocator_Destroy(Device->MemoryAllocator);
+
     vkDestroyDevice(Device->DeviceHandle, NULL);
     vkDestroySurfaceKHR(Device->InstanceHandle, Device->SurfaceHandle, NULL);
 
@@ -28,6 +28,8 @@ extern "C"
 #endif
 
     typedef struct GCRendererDevice GCRendererDevice;
+    typedef struct GCVulkanMemoryAllocator GCVulkanMemoryAllocator;
+    typedef struct GCVulkanDeletionQueue GCVulkanDeletionQueue;
 
     VkInstance GCRendererDevice_GetInstanceHandle(const GCRendererDevice* const Device);
     VkSurfaceKHR GCRendererDevice_GetSurfaceHandle(const GCRendererDevice* const Device);
@@ -37,6 +39,10 @@ extern "C"
     uint32_t GCRendererDevice_GetPresentFamilyQueueIndex(const GCRendererDevice* const Device);
     VkQueue GCRendererDevice_GetGraphicsQueueHandle(const GCRendererDevice* const Device);
     VkQueue GCRendererDevice_GetPresentQueueHandle(const GCRendererDevice* const Device);
+    uint32_t GCRendererDevice_GetTransferFamilyQueueIndex(const GCRendererDevice* const Device);
+    VkQueue GCRendererDevice_GetTransferQueueHandle(const GCRendererDevice* const Device);
+    GCVulkanMemoryAllocator* GCRendererDevice_GetMemoryAllocator(const GCRendererDevice* const Device);
+    GCVulkanDeletionQueue* GCRendererDevice_GetDeletionQueue(const GCRendererDevice* const Device);
     uint32_t GCRendererDevice_GetMemoryTypeIndex(const GCRendererDevice* const Device, const uint32_t TypeFilter,
                                                  const VkMemoryPropertyFlags PropertyFlags);
 
@@ -21,9 +21,11 @@
 #include "Core/Memory/Allocator.h"
 #include "Renderer/RendererDevice.h"
 #include "Renderer/RendererEnums.h"
+#include "Renderer/RendererCommandList.h"
 #include "Renderer/RendererFramebuffer.h"
 #include "Renderer/Vulkan/VulkanRendererCommandList.h"
 #include "Renderer/Vulkan/VulkanRendererDevice.h"
+#include "Renderer/Vulkan/VulkanMemoryAllocator.h"
 #include "Renderer/Vulkan/VulkanRendererGraphicsPipeline.h"
 #include "Renderer/Vulkan/VulkanRendererSwapChain.h"
 #include "Renderer/Vulkan/VulkanUtilities.h"
@@ -46,15 +48,15 @@ typedef struct GCRendererFramebuffer
     uint32_t Width, Height;
 
     VkImage* ColorAttachmentImageHandles;
-    VkDeviceMemory* ColorAttachmentImageMemoryHandles;
+    GCVulkanMemoryAllocation* ColorAttachmentImageMemories;
     VkImageView* ColorAttachmentImageViewHandles;
 
     VkImage* ColorResolveAttachmentImageHandles;
-    VkDeviceMemory* ColorResolveAttachmentImageMemoryHandles;
+    GCVulkanMemoryAllocation* ColorResolveAttachmentImageMemories;
     VkImageView* ColorResolveAttachmentImageViewHandles;
 
     VkImage* DepthAttachmentImageHandles;
-    VkDeviceMemory* DepthAttachmentImageMemoryHandles;
+    GCVulkanMemoryAllocation* DepthAttachmentImageMemories;
     VkImageView* DepthAttachmentImageViewHandles;
 
     VkSampler* ColorAttachmentSampledSamplerHandles;
@@ -62,6 +64,16 @@ typedef struct GCRendererFramebuffer
     VkFramebuffer* SwapChainFramebufferHandles;
     VkFramebuffer AttachmentFramebufferHandle;
 
+    VkBuffer PixelReadbackBufferHandle;
+    GCVulkanMemoryAllocation PixelReadbackBufferMemory;
+    bool* IsPixelReadbackPending;
+    uint32_t PixelReadbackFrameCount;
+
+    uint32_t PixelRequestAttachmentIndex;
+    int32_t PixelRequestX, PixelRequestY;
+    int32_t Pixel;
+    bool HasPixelRequest;
+
     bool HasColorAttachment, HasColorAttachmentSampled, HasColorAttachmentMapped, HasColorResolveAttachment;
     bool HasDepthAtachment;
 } GCRendererFramebuffer;
@@ -73,6 +85,7 @@ static uint32_t GCRendererFramebuffer_GetDepthAttachmentCount(const GCRendererFr
 static void GCRendererFramebuffer_CreateAttachments(GCRendererFramebuffer* const Framebuffer);
 static void GCRendererFramebuffer_CreateSwapChainFramebuffers(GCRendererFramebuffer* const Framebuffer);
 static void GCRendererFramebuffer_CreateAttachmentFramebuffer(GCRendererFramebuffer* const Framebuffer);
+static void GCRendererFramebuffer_CreatePixelReadbackBuffer(GCRendererFramebuffer* const Framebuffer);
 static void GCRendererFramebuffer_DestroyObjectsSwapChain(GCRendererFramebuffer* const Framebuffer);
 static void GCRendererFramebuffer_DestroyObjectsAttachments(GCRendererFramebuffer* const Framebuffer);
 
@@ -87,15 +100,15 @@ GCRendererFramebuffer* GCRendererFramebuffer_Create(const GCRendererFramebufferD
     Framebuffer->Width = Description->Width;
     Framebuffer->Height = Description->Height;
     Framebuffer->ColorAttachmentImageHandles = NULL;
-    Framebuffer->ColorAttachmentImageMemoryHandles = NULL;
+    Framebuffer->ColorAttachmentImageMemories = NULL;
     Framebuffer->ColorAttachmentImageViewHandles = NULL;
 
     Framebuffer->ColorResolveAttachmentImageHandles = NULL;
-    Framebuffer->ColorResolveAttachmentImageMemoryHandles = NULL;
+    Framebuffer->ColorResolveAttachmentImageMemories = NULL;
     Framebuffer->ColorResolveAttachmentImageViewHandles = NULL;
 
     Framebuffer->DepthAttachmentImageHandles = NULL;
-    Framebuffer->DepthAttachmentImageMemoryHandles = NULL;
+    Framebuffer->DepthAttachmentImageMemories = NULL;
     Framebuffer->DepthAttachmentImageViewHandles = NULL;
 
     Framebuffer->ColorAttachmentSampledSamplerHandles = NULL;
@@ -103,6 +116,17 @@ GCRendererFramebuffer* GCRendererFramebuffer_Create(const GCRendererFramebufferD
     Framebuffer->SwapChainFramebufferHandles = NULL;
     Framebuffer->AttachmentFramebufferHandle = VK_NULL_HANDLE;
 
+    Framebuffer->PixelReadbackBufferHandle = VK_NULL_HANDLE;
+    Framebuffer->PixelReadbackBufferMemory = (GCVulkanMemoryAllocation){0};
+    Framebuffer->IsPixelReadbackPending = NULL;
+    Framebuffer->PixelReadbackFrameCount = GCRendererCommandList_GetMaximumFramesInFlight(Description->CommandList);
+
+    Framebuffer->PixelRequestAttachmentIndex = 0;
+    Framebuffer->PixelRequestX = 0;
+    Framebuffer->PixelRequestY = 0;
+    Framebuffer->Pixel = -1;
+    Framebuffer->HasPixelRequest = false;
+
     Framebuffer->HasColorAttachment = false;
     Framebuffer->HasColorAttachmentSampled = false;
     Framebuffer->HasColorAttachmentMapped = false;
@@ -129,8 +153,8 @@ GCRendererFramebuffer* GCRendererFramebuffer_Create(const GCRendererFramebufferD
         Framebuffer->HasColorAttachment = true;
 
         Framebuffer->ColorAttachmentImageHandles = (VkImage*)GCMemory_Allocate(ColorAttachmentCount * sizeof(VkImage));
-        Framebuffer->ColorAttachmentImageMemoryHandles =
-            (VkDeviceMemory*)GCMemory_Allocate(ColorAttachmentCount * sizeof(VkDeviceMemory));
+        Framebuffer->ColorAttachmentImageMemories =
+            (GCVulkanMemoryAllocation*)GCMemory_Allocate(ColorAttachmentCount * sizeof(GCVulkanMemoryAllocation));
         Framebuffer->ColorAttachmentImageViewHandles =
             (VkImageView*)GCMemory_Allocate(ColorAttachmentCount * sizeof(VkImageView));
     }
@@ -141,8 +165,8 @@ GCRendererFramebuffer* GCRendererFramebuffer_Create(const GCRendererFramebufferD
 
         Framebuffer->ColorResolveAttachmentImageHandles =
             (VkImage*)GCMemory_Allocate(ColorResolveAttachmentCount * sizeof(VkImage));
-        Framebuffer->ColorResolveAttachmentImageMemoryHandles =
-            (VkDeviceMemory*)GCMemory_Allocate(ColorResolveAttachmentCount * sizeof(VkDeviceMemory));
+        Framebuffer->ColorResolveAttachmentImageMemories = (GCVulkanMemoryAllocation*)GCMemory_Allocate(
+            ColorResolveAttachmentCount * sizeof(GCVulkanMemoryAllocation));
         Framebuffer->ColorResolveAttachmentImageViewHandles =
             (VkImageView*)GCMemory_Allocate(ColorResolveAttachmentCount * sizeof(VkImageView));
     }
@@ -152,8 +176,8 @@ GCRendererFramebuffer* GCRendererFramebuffer_Create(const GCRendererFramebufferD
         Framebuffer->HasDepthAtachment = true;
 
         Framebuffer->DepthAttachmentImageHandles = (VkImage*)GCMemory_Allocate(DepthAttachmentCount * sizeof(VkImage));
-        Framebuffer->DepthAttachmentImageMemoryHandles =
-            (VkDeviceMemory*)GCMemory_Allocate(DepthAttachmentCount * sizeof(VkDeviceMemory));
+        Framebuffer->DepthAttachmentImageMemories =
+            (GCVulkanMemoryAllocation*)GCMemory_Allocate(DepthAttachmentCount * sizeof(GCVulkanMemoryAllocation));
         Framebuffer->DepthAttachmentImageViewHandles =
             (VkImageView*)GCMemory_Allocate(DepthAttachmentCount * sizeof(VkImageView));
     }
@@ -169,6 +193,7 @@ GCRendererFramebuffer* GCRendererFramebuffer_Create(const GCRendererFramebufferD
     GCRendererFramebuffer_CreateAttachments(Framebuffer);
     GCRendererFramebuffer_CreateSwapChainFramebuffers(Framebuffer);
     GCRendererFramebuffer_CreateAttachmentFramebuffer(Framebuffer);
+    GCRendererFramebuffer_CreatePixelReadbackBuffer(Framebuffer);
 
     return Framebuffer;
 }
@@ -201,44 +226,30 @@ void GCRendererFramebuffer_GetSize(const GCRendererFramebuffer* const Framebuffe
     *Height = Framebuffer->Height;
 }
 
-int32_t GCRendererFramebuffer_GetPixel(const GCRendererFramebuffer* const Framebuffer,
-                                       const GCRendererCommandList* const CommandList, const uint32_t AttachmentIndex,
-                                       const int32_t X, const int32_t Y)
+void GCRendererFramebuffer_RequestPixel(GCRendererFramebuffer* const Framebuffer, const uint32_t AttachmentIndex,
+                                        const int32_t X, const int32_t Y)
 {
-    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(Framebuffer->Device);
-
-    VkBuffer ColorAttachmentDataBufferHandle = VK_NULL_HANDLE;
-    VkDeviceMemory ColorAttachmentDataBufferMemoryHandle = VK_NULL_HANDLE;
-
-    GCVulkanUtilities_CreateBuffer(Framebuffer->Device, 4, VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-                                   VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                                   &ColorAttachmentDataBufferHandle, &ColorAttachmentDataBufferMemoryHandle);
-
-    const VkCommandBuffer CommandBufferHandle = GCRendererCommandList_BeginSingleTimeCommands(CommandList);
-    GCVulkanUtilities_CopyImageToBuffer(CommandBufferHandle, Framebuffer->ColorAttachmentImageHandles[AttachmentIndex],
-                                        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, ColorAttachmentDataBufferHandle, 1, 1, X,
-                                        Y);
-    GCRendererCommandList_EndSingleTimeCommands(CommandList, CommandBufferHandle);
-
-    void* ColorAttachmentData = NULL;
-    int32_t Pixel = 0;
-    vkMapMemory(DeviceHandle, ColorAttachmentDataBufferMemoryHandle, 0, 4, 0, &ColorAttachmentData);
-    Pixel = *(int32_t*)ColorAttachmentData;
-    vkUnmapMemory(DeviceHandle, ColorAttachmentDataBufferMemoryHandle);
-
-    vkFreeMemory(DeviceHandle, ColorAttachmentDataBufferMemoryHandle, NULL);
-    vkDestroyBuffer(DeviceHandle, ColorAttachmentDataBufferHandle, NULL);
+    Framebuffer->PixelRequestAttachmentIndex = AttachmentIndex;
+    Framebuffer->PixelRequestX = X;
+    Framebuffer->PixelRequestY = Y;
+    Framebuffer->HasPixelRequest = true;
+}
 
-    return Pixel;
+int32_t GCRendererFramebuffer_GetPixel(const GCRendererFramebuffer* const Framebuffer)
+{
+    return Framebuffer->Pixel;
 }
 
 void GCRendererFramebuffer_Destroy(GCRendererFramebuffer* Framebuffer)
 {
     GCRendererDevice_WaitIdle(Framebuffer->Device);
 
+    GCVulkanUtilities_DestroyBuffer(Framebuffer->Device, Framebuffer->PixelReadbackBufferHandle,
+                                    &Framebuffer->PixelReadbackBufferMemory);
     GCRendererFramebuffer_DestroyObjectsAttachments(Framebuffer);
     GCRendererFramebuffer_DestroyObjectsSwapChain(Framebuffer);
 
+    GCMemory_Free(Framebuffer->IsPixelReadbackPending);
     GCMemory_Free(Framebuffer->SwapChainFramebufferHandles);
 
     if (Framebuffer->HasColorAttachmentSampled)
@@ -249,21 +260,21 @@ void GCRendererFramebuffer_Destroy(GCRendererFramebuffer* Framebuffer)
     if (Framebuffer->HasDepthAtachment)
     {
         GCMemory_Free(Framebuffer->DepthAttachmentImageViewHandles);
-        GCMemory_Free(Framebuffer->DepthAttachmentImageMemoryHandles);
+        GCMemory_Free(Framebuffer->DepthAttachmentImageMemories);
         GCMemory_Free(Framebuffer->DepthAttachmentImageHandles);
     }
 
     if (Framebuffer->HasColorResolveAttachment)
     {
         GCMemory_Free(Framebuffer->ColorResolveAttachmentImageViewHandles);
-        GCMemory_Free(Framebuffer->ColorResolveAttachmentImageMemoryHandles);
+        GCMemory_Free(Framebuffer->ColorResolveAttachmentImageMemories);
         GCMemory_Free(Framebuffer->ColorResolveAttachmentImageHandles);
     }
 
     if (Framebuffer->HasColorAttachment)
     {
         GCMemory_Free(Framebuffer->ColorAttachmentImageViewHandles);
-        GCMemory_Free(Framebuffer->ColorAttachmentImageMemoryHandles);
+        GCMemory_Free(Framebuffer->ColorAttachmentImageMemories);
         GCMemory_Free(Framebuffer->ColorAttachmentImageHandles);
     }
 
@@ -308,6 +319,47 @@ VkExtent2D GCRendererFramebuffer_GetFramebufferSize(const GCRendererFramebuffer*
     return Extent;
 }
 
+void GCRendererFramebuffer_RecordPixelReadback(GCRendererFramebuffer* const Framebuffer,
+                                               const VkCommandBuffer CommandBufferHandle, const uint32_t FrameIndex)
+{
+    const int32_t* const PixelReadbackData = (const int32_t*)Framebuffer->PixelReadbackBufferMemory.MappedData;
+
+    if (Framebuffer->IsPixelReadbackPending[FrameIndex])
+    {
+        Framebuffer->Pixel = PixelReadbackData[FrameIndex];
+        Framebuffer->IsPixelReadbackPending[FrameIndex] = false;
+    }
+
+    if (!Framebuffer->HasPixelRequest)
+    {
+        return;
+    }
+
+    Framebuffer->HasPixelRequest = false;
+
+    if (Framebuffer->PixelRequestX < 0 || Framebuffer->PixelRequestY < 0 ||
+        (uint32_t)Framebuffer->PixelRequestX >= Framebuffer->Width ||
+        (uint32_t)Framebuffer->PixelRequestY >= Framebuffer->Height)
+    {
+        return;
+    }
+
+    GCVulkanUtilities_CopyImageToBuffer(
+        CommandBufferHandle, Framebuffer->ColorAttachmentImageHandles[Framebuffer->PixelRequestAttachmentIndex],
+        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, Framebuffer->PixelReadbackBufferHandle,
+        (VkDeviceSize)FrameIndex * sizeof(int32_t), 1, 1, Framebuffer->PixelRequestX, Framebuffer->PixelRequestY);
+
+    VkMemoryBarrier MemoryBarrier = {0};
+    MemoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    MemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    MemoryBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+
+    vkCmdPipelineBarrier(CommandBufferHandle, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 1,
+                         &MemoryBarrier, 0, NULL, 0, NULL);
+
+    Framebuffer->IsPixelReadbackPending[FrameIndex] = true;
+}
+
 uint32_t GCRendererFramebuffer_GetColorAttachmentCount(const GCRendererFramebuffer* const Framebuffer)
 {
     uint32_t Count = 0;
@@ -383,7 +435,7 @@ void GCRendererFramebuffer_CreateAttachments(GCRendererFramebuffer* const Frameb
             GCVulkanUtilities_ToVkSampleCountFlagBits(Framebuffer->Device, Attachment.SampleCount);
 
         VkImage* AttachmentImageHandle = NULL;
-        VkDeviceMemory* AttachmentImageMemoryHandle = NULL;
+        GCVulkanMemoryAllocation* AttachmentImageMemory = NULL;
         VkImageView* AttachmentImageViewHandle = NULL;
 
         VkImageUsageFlagBits AttachmentImageUsage = 0;
@@ -394,7 +446,7 @@ void GCRendererFramebuffer_CreateAttachments(GCRendererFramebuffer* const Frameb
         if (Attachment.Type == GCRendererAttachmentType_Color)
         {
             AttachmentImageHandle = &Framebuffer->ColorAttachmentImageHandles[ColorAttachmentIndex];
-            AttachmentImageMemoryHandle = &Framebuffer->ColorAttachmentImageMemoryHandles[ColorAttachmentIndex];
+            AttachmentImageMemory = &Framebuffer->ColorAttachmentImageMemories[ColorAttachmentIndex];
             AttachmentImageViewHandle = &Framebuffer->ColorAttachmentImageViewHandles[ColorAttachmentIndex];
 
             AttachmentImageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
@@ -423,7 +475,7 @@ void GCRendererFramebuffer_CreateAttachments(GCRendererFramebuffer* const Frameb
                     VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT,
                     VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
                     &Framebuffer->ColorResolveAttachmentImageHandles[ColorResolveAttachmentIndex],
-                    &Framebuffer->ColorResolveAttachmentImageMemoryHandles[ColorResolveAttachmentIndex]);
+                    &Framebuffer->ColorResolveAttachmentImageMemories[ColorResolveAttachmentIndex]);
                 GCVulkanUtilities_CreateImageView(
                     Framebuffer->Device, Framebuffer->ColorResolveAttachmentImageHandles[Counter], AttachmentFormat,
                     AttachmentImageAspect, 1,
@@ -437,7 +489,7 @@ void GCRendererFramebuffer_CreateAttachments(GCRendererFramebuffer* const Frameb
         else if (Attachment.Type == GCRendererAttachmentType_DepthStencil)
         {
             AttachmentImageHandle = &Framebuffer->DepthAttachmentImageHandles[DepthAttachmentIndex];
-            AttachmentImageMemoryHandle = &Framebuffer->DepthAttachmentImageMemoryHandles[DepthAttachmentIndex];
+            AttachmentImageMemory = &Framebuffer->DepthAttachmentImageMemories[DepthAttachmentIndex];
             AttachmentImageViewHandle = &Framebuffer->DepthAttachmentImageViewHandles[DepthAttachmentIndex];
 
             AttachmentImageUsage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
@@ -449,7 +501,7 @@ void GCRendererFramebuffer_CreateAttachments(GCRendererFramebuffer* const Frameb
         GCVulkanUtilities_CreateImage(
             Framebuffer->Device, Framebuffer->Width, Framebuffer->Height, 1, AttachmentFormat, AttachmentImageTiling,
             Attachment.Type == GCRendererAttachmentType_Color ? VK_SAMPLE_COUNT_1_BIT : AttachmentSampleCount,
-            AttachmentImageUsage, AttachmentMemoryProperty, AttachmentImageHandle, AttachmentImageMemoryHandle);
+            AttachmentImageUsage, AttachmentMemoryProperty, AttachmentImageHandle, AttachmentImageMemory);
         GCVulkanUtilities_CreateImageView(Framebuffer->Device, *AttachmentImageHandle, AttachmentFormat,
                                           AttachmentImageAspect, 1, AttachmentImageViewHandle);
     }
@@ -550,6 +602,17 @@ void GCRendererFramebuffer_CreateAttachmentFramebuffer(GCRendererFramebuffer* co
     GCMemory_Free(AttachmentHandles);
 }
 
+void GCRendererFramebuffer_CreatePixelReadbackBuffer(GCRendererFramebuffer* const Framebuffer)
+{
+    GCVulkanUtilities_CreateBuffer(Framebuffer->Device, Framebuffer->PixelReadbackFrameCount * sizeof(int32_t),
+                                   VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                   VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                   &Framebuffer->PixelReadbackBufferHandle, &Framebuffer->PixelReadbackBufferMemory);
+
+    Framebuffer->IsPixelReadbackPending =
+        (bool*)GCMemory_AllocateZero(Framebuffer->PixelReadbackFrameCount * sizeof(bool));
+}
+
 void GCRendererFramebuffer_DestroyObjectsAttachments(GCRendererFramebuffer* const Framebuffer)
 {
     const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(Framebuffer->Device);
@@ -564,22 +627,22 @@ void GCRendererFramebuffer_DestroyObjectsAttachments(GCRendererFramebuffer* cons
     for (uint32_t Counter = 0; Counter < GCRendererFramebuffer_GetDepthAttachmentCount(Framebuffer); Counter++)
     {
         vkDestroyImageView(DeviceHandle, Framebuffer->DepthAttachmentImageViewHandles[Counter], NULL);
-        vkFreeMemory(DeviceHandle, Framebuffer->DepthAttachmentImageMemoryHandles[Counter], NULL);
-        vkDestroyImage(DeviceHandle, Framebuffer->DepthAttachmentImageHandles[Counter], NULL);
+        GCVulkanUtilities_DestroyImage(Framebuffer->Device, Framebuffer->DepthAttachmentImageHandles[Counter],
+                                       &Framebuffer->DepthAttachmentImageMemories[Counter]);
     }
 
     for (uint32_t Counter = 0; Counter < GCRendererFramebuffer_GetColorResolveAttachmentCount(Framebuffer); Counter++)
     {
         vkDestroyImageView(DeviceHandle, Framebuffer->ColorResolveAttachmentImageViewHandles[Counter], NULL);
-        vkFreeMemory(DeviceHandle, Framebuffer->ColorResolveAttachmentImageMemoryHandles[Counter], NULL);
-        vkDestroyImage(DeviceHandle, Framebuffer->ColorResolveAttachmentImageHandles[Counter], NULL);
+        GCVulkanUtilities_DestroyImage(Framebuffer->Device, Framebuffer->ColorResolveAttachmentImageHandles[Counter],
+                                       &Framebuffer->ColorResolveAttachmentImageMemories[Counter]);
     }
 
     for (uint32_t Counter = 0; Counter < GCRendererFramebuffer_GetColorAttachmentCount(Framebuffer); Counter++)
     {
         vkDestroyImageView(DeviceHandle, Framebuffer->ColorAttachmentImageViewHandles[Counter], NULL);
-        vkFreeMemory(DeviceHandle, Framebuffer->ColorAttachmentImageMemoryHandles[Counter], NULL);
-        vkDestroyImage(DeviceHandle, Framebuffer->ColorAttachmentImageHandles[Counter], NULL);
+        GCVulkanUtilities_DestroyImage(Framebuffer->Device, Framebuffer->ColorAttachmentImageHandles[Counter],
+                                       &Framebuffer->ColorAttachmentImageMemories[Counter]);
     }
 }
 
@@ -36,6 +36,9 @@ extern "C"
     VkFramebuffer* GCRendererFramebuffer_GetSwapChainFramebufferHandles(const GCRendererFramebuffer* const Framebuffer);
     VkFramebuffer GCRendererFramebuffer_GetAttachmentFramebufferHandle(const GCRendererFramebuffer* const Framebuffer);
     VkExtent2D GCRendererFramebuffer_GetFramebufferSize(const GCRendererFramebuffer* const Framebuffer);
+    void GCRendererFramebuffer_RecordPixelReadback(GCRendererFramebuffer* const Framebuffer,
+                                                   const VkCommandBuffer CommandBufferHandle,
+                                                   const uint32_t FrameIndex);
 
 #ifdef __cplusplus
 }
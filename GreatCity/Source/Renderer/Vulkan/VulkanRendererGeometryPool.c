@@ -0,0 +1,298 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Renderer/Vulkan/VulkanRendererGeometryPool.h"
+#include "Core/Assert.h"
+#include "Core/Log.h"
+#include "Core/Memory/Allocator.h"
+#include "Core/Memory/FreeListAllocator.h"
+#include "Renderer/RendererGeometryPool.h"
+#include "Renderer/Vulkan/VulkanRendererCommandList.h"
+#include "Renderer/Vulkan/VulkanDeletionQueue.h"
+#include "Renderer/Vulkan/VulkanMemoryAllocator.h"
+#include "Renderer/Vulkan/VulkanRendererDevice.h"
+#include "Renderer/Vulkan/VulkanUploadQueue.h"
+#include "Renderer/Vulkan/VulkanUtilities.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <vulkan/vulkan.h>
+
+typedef struct GCRendererGeometryPoolPendingFree
+{
+    GCRendererGeometryAllocation Allocation;
+    uint64_t FrameNumber;
+} GCRendererGeometryPoolPendingFree;
+
+typedef struct GCRendererGeometryPool
+{
+    const GCRendererDevice* Device;
+    const GCRendererCommandList* CommandList;
+
+    VkBuffer VertexBufferHandle;
+    GCVulkanMemoryAllocation VertexBufferMemory;
+    VkBuffer IndexBufferHandle;
+    GCVulkanMemoryAllocation IndexBufferMemory;
+
+    GCRendererGeometryPoolPendingFree* PendingFrees;
+    uint32_t PendingFreeCount;
+    uint32_t PendingFreeCapacity;
+
+    GCFreeListAllocator* VertexAllocator;
+    GCFreeListAllocator* IndexAllocator;
+
+    size_t VertexSize;
+} GCRendererGeometryPool;
+
+static void GCRendererGeometryPool_CreateBuffers(GCRendererGeometryPool* const GeometryPool);
+static void GCRendererGeometryPool_ReleasePendingFrees(GCRendererGeometryPool* const GeometryPool);
+static void GCRendererGeometryPool_GrowBuffer(GCRendererGeometryPool* const GeometryPool,
+                                              GCFreeListAllocator* const Allocator, const size_t ElementSize,
+                                              const uint32_t RequiredCount, const VkBufferUsageFlags Usage,
+                                              VkBuffer* const BufferHandle,
+                                              GCVulkanMemoryAllocation* const BufferMemory);
+static uint32_t GCRendererGeometryPool_AllocateRange(GCRendererGeometryPool* const GeometryPool,
+                                                     GCFreeListAllocator* const Allocator, const size_t ElementSize,
+                                                     const uint32_t Count, const VkBufferUsageFlags Usage,
+                                                     VkBuffer* const BufferHandle,
+                                                     GCVulkanMemoryAllocation* const BufferMemory);
+static void GCRendererGeometryPool_DestroyObjects(GCRendererGeometryPool* const GeometryPool);
+
+GCRendererGeometryPool* GCRendererGeometryPool_Create(const GCRendererGeometryPoolDescription* const Description)
+{
+    GCRendererGeometryPool* GeometryPool = (GCRendererGeometryPool*)GCMemory_Allocate(sizeof(GCRendererGeometryPool));
+    GeometryPool->Device = Description->Device;
+    GeometryPool->CommandList = Description->CommandList;
+    GeometryPool->VertexBufferHandle = VK_NULL_HANDLE;
+    GeometryPool->VertexBufferMemory = (GCVulkanMemoryAllocation){0};
+    GeometryPool->IndexBufferHandle = VK_NULL_HANDLE;
+    GeometryPool->IndexBufferMemory = (GCVulkanMemoryAllocation){0};
+    GeometryPool->PendingFrees = NULL;
+    GeometryPool->PendingFreeCount = 0;
+    GeometryPool->PendingFreeCapacity = 0;
+    GeometryPool->VertexAllocator = GCFreeListAllocator_Create(Description->VertexCapacity);
+    GeometryPool->IndexAllocator = GCFreeListAllocator_Create(Description->IndexCapacity);
+    GeometryPool->VertexSize = Description->VertexSize;
+
+    GCRendererGeometryPool_CreateBuffers(GeometryPool);
+
+    return GeometryPool;
+}
+
+GCRendererGeometryAllocation GCRendererGeometryPool_Allocate(GCRendererGeometryPool* const GeometryPool,
+                                                             const void* const Vertices, const uint32_t VertexCount,
+                                                             const uint32_t* const Indices, const uint32_t IndexCount)
+{
+    GCRendererGeometryPool_ReleasePendingFrees(GeometryPool);
+
+    const uint32_t VertexOffset = GCRendererGeometryPool_AllocateRange(
+        GeometryPool, GeometryPool->VertexAllocator, GeometryPool->VertexSize, VertexCount,
+        VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, &GeometryPool->VertexBufferHandle, &GeometryPool->VertexBufferMemory);
+    const uint32_t FirstIndex = GCRendererGeometryPool_AllocateRange(
+        GeometryPool, GeometryPool->IndexAllocator, sizeof(uint32_t), IndexCount, VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+        &GeometryPool->IndexBufferHandle, &GeometryPool->IndexBufferMemory);
+
+    GCVulkanUploadQueue* const UploadQueue = GCRendererCommandList_GetUploadQueue(GeometryPool->CommandList);
+
+    GCVulkanUploadQueue_UploadBuffer(UploadQueue, GeometryPool->VertexBufferHandle,
+                                     (VkDeviceSize)VertexOffset * GeometryPool->VertexSize, Vertices,
+                                     VertexCount * GeometryPool->VertexSize);
+    GCVulkanUploadQueue_UploadBuffer(UploadQueue, GeometryPool->IndexBufferHandle,
+                                     (VkDeviceSize)FirstIndex * sizeof(uint32_t), Indices,
+                                     IndexCount * sizeof(uint32_t));
+
+    GCRendererGeometryAllocation Allocation = {0};
+    Allocation.VertexOffset = (int32_t)VertexOffset;
+    Allocation.VertexCount = VertexCount;
+    Allocation.FirstIndex = FirstIndex;
+    Allocation.IndexCount = IndexCount;
+
+    return Allocation;
+}
+
+void GCRendererGeometryPool_Free(GCRendererGeometryPool* const GeometryPool,
+                                 const GCRendererGeometryAllocation* const Allocation)
+{
+    if (GeometryPool->PendingFreeCount == GeometryPool->PendingFreeCapacity)
+    {
+        GeometryPool->PendingFreeCapacity =
+            GeometryPool->PendingFreeCapacity ? GeometryPool->PendingFreeCapacity * 2 : 64;
+        GeometryPool->PendingFrees = (GCRendererGeometryPoolPendingFree*)GCMemory_Reallocate(
+            GeometryPool->PendingFrees, GeometryPool->PendingFreeCapacity * sizeof(GCRendererGeometryPoolPendingFree));
+    }
+
+    GCRendererGeometryPoolPendingFree* const PendingFree = &GeometryPool->PendingFrees[GeometryPool->PendingFreeCount];
+    PendingFree->Allocation = *Allocation;
+    PendingFree->FrameNumber =
+        GCVulkanDeletionQueue_GetFrameNumber(GCRendererDevice_GetDeletionQueue(GeometryPool->Device));
+
+    GeometryPool->PendingFreeCount++;
+}
+
+void GCRendererGeometryPool_BeginFrame(GCRendererGeometryPool* const GeometryPool)
+{
+    GCRendererGeometryPool_ReleasePendingFrees(GeometryPool);
+}
+
+GCRendererGeometryPoolStatistics GCRendererGeometryPool_GetStatistics(const GCRendererGeometryPool* const GeometryPool)
+{
+    GCRendererGeometryPoolStatistics Statistics = {0};
+    Statistics.VertexCapacity = (uint32_t)GCFreeListAllocator_GetSize(GeometryPool->VertexAllocator);
+    Statistics.UsedVertexCount = (uint32_t)GCFreeListAllocator_GetUsedSize(GeometryPool->VertexAllocator);
+    Statistics.IndexCapacity = (uint32_t)GCFreeListAllocator_GetSize(GeometryPool->IndexAllocator);
+    Statistics.UsedIndexCount = (uint32_t)GCFreeListAllocator_GetUsedSize(GeometryPool->IndexAllocator);
+
+    return Statistics;
+}
+
+void GCRendererGeometryPool_Destroy(GCRendererGeometryPool* GeometryPool)
+{
+    GCRendererGeometryPool_DestroyObjects(GeometryPool);
+
+    GCFreeListAllocator_Destroy(GeometryPool->IndexAllocator);
+    GCFreeListAllocator_Destroy(GeometryPool->VertexAllocator);
+
+    GCMemory_Free(GeometryPool->PendingFrees);
+    GCMemory_Free(GeometryPool);
+}
+
+VkBuffer GCRendererGeometryPool_GetVertexBufferHandle(const GCRendererGeometryPool* const GeometryPool)
+{
+    return GeometryPool->VertexBufferHandle;
+}
+
+VkBuffer GCRendererGeometryPool_GetIndexBufferHandle(const GCRendererGeometryPool* const GeometryPool)
+{
+    return GeometryPool->IndexBufferHandle;
+}
+
+void GCRendererGeometryPool_CreateBuffers(GCRendererGeometryPool* const GeometryPool)
+{
+    GCVulkanUtilities_CreateBuffer(
+        GeometryPool->Device, GCFreeListAllocator_GetSize(GeometryPool->VertexAllocator) * GeometryPool->VertexSize,
+        VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &GeometryPool->VertexBufferHandle, &GeometryPool->VertexBufferMemory);
+
+    GCVulkanUtilities_CreateBuffer(
+        GeometryPool->Device, GCFreeListAllocator_GetSize(GeometryPool->IndexAllocator) * sizeof(uint32_t),
+        VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &GeometryPool->IndexBufferHandle, &GeometryPool->IndexBufferMemory);
+}
+
+void GCRendererGeometryPool_ReleasePendingFrees(GCRendererGeometryPool* const GeometryPool)
+{
+    const uint64_t CompletedFrameCount =
+        GCVulkanDeletionQueue_GetCompletedFrameCount(GCRendererDevice_GetDeletionQueue(GeometryPool->Device));
+
+    uint32_t ReleasedCount = 0;
+
+    while (ReleasedCount < GeometryPool->PendingFreeCount &&
+           GeometryPool->PendingFrees[ReleasedCount].FrameNumber < CompletedFrameCount)
+    {
+        const GCRendererGeometryAllocation* const Allocation = &GeometryPool->PendingFrees[ReleasedCount].Allocation;
+
+        GCFreeListAllocator_Free(GeometryPool->VertexAllocator, (uint64_t)Allocation->VertexOffset,
+                                 Allocation->VertexCount);
+        GCFreeListAllocator_Free(GeometryPool->IndexAllocator, Allocation->FirstIndex, Allocation->IndexCount);
+
+        ReleasedCount++;
+    }
+
+    if (ReleasedCount)
+    {
+        GeometryPool->PendingFreeCount -= ReleasedCount;
+
+        memmove(GeometryPool->PendingFrees, GeometryPool->PendingFrees + ReleasedCount,
+                GeometryPool->PendingFreeCount * sizeof(GCRendererGeometryPoolPendingFree));
+    }
+}
+
+uint32_t GCRendererGeometryPool_AllocateRange(GCRendererGeometryPool* const GeometryPool,
+                                              GCFreeListAllocator* const Allocator, const size_t ElementSize,
+                                              const uint32_t Count, const VkBufferUsageFlags Usage,
+                                              VkBuffer* const BufferHandle,
+                                              GCVulkanMemoryAllocation* const BufferMemory)
+{
+    if (!Count)
+    {
+        return 0;
+    }
+
+    uint64_t Offset = 0;
+
+    if (!GCFreeListAllocator_Allocate(Allocator, Count, 1, &Offset))
+    {
+        GCRendererGeometryPool_GrowBuffer(GeometryPool, Allocator, ElementSize, Count, Usage, BufferHandle,
+                                          BufferMemory);
+
+        const bool IsAllocated = GCFreeListAllocator_Allocate(Allocator, Count, 1, &Offset);
+        GC_ASSERT_WITH_MESSAGE(IsAllocated, "Failed to allocate %u elements from the geometry pool", Count);
+        (void)IsAllocated;
+    }
+
+    return (uint32_t)Offset;
+}
+
+void GCRendererGeometryPool_GrowBuffer(GCRendererGeometryPool* const GeometryPool, GCFreeListAllocator* const Allocator,
+                                       const size_t ElementSize, const uint32_t RequiredCount,
+                                       const VkBufferUsageFlags Usage, VkBuffer* const BufferHandle,
+                                       GCVulkanMemoryAllocation* const BufferMemory)
+{
+    const uint64_t OldCapacity = GCFreeListAllocator_GetSize(Allocator);
+    uint64_t NewCapacity = OldCapacity ? OldCapacity * 2 : RequiredCount;
+
+    while (NewCapacity - OldCapacity < RequiredCount)
+    {
+        NewCapacity *= 2;
+    }
+
+    GC_LOG_INFORMATION("Growing a geometry pool buffer from %llu to %llu elements", (unsigned long long)OldCapacity,
+                       (unsigned long long)NewCapacity);
+
+    VkBuffer NewBufferHandle = VK_NULL_HANDLE;
+    GCVulkanMemoryAllocation NewBufferMemory = {0};
+
+    GCVulkanUtilities_CreateBuffer(GeometryPool->Device, NewCapacity * ElementSize,
+                                   VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | Usage,
+                                   VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &NewBufferHandle, &NewBufferMemory);
+
+    if (OldCapacity)
+    {
+        GCVulkanUploadQueue_CopyBuffer(GCRendererCommandList_GetUploadQueue(GeometryPool->CommandList), *BufferHandle,
+                                       NewBufferHandle, OldCapacity * ElementSize);
+    }
+
+    GCVulkanDeletionQueue_EnqueueBuffer(GCRendererDevice_GetDeletionQueue(GeometryPool->Device), *BufferHandle,
+                                        BufferMemory);
+
+    *BufferHandle = NewBufferHandle;
+    *BufferMemory = NewBufferMemory;
+
+    GCFreeListAllocator_Grow(Allocator, NewCapacity);
+}
+
+void GCRendererGeometryPool_DestroyObjects(GCRendererGeometryPool* const GeometryPool)
+{
+    GCVulkanDeletionQueue* const DeletionQueue = GCRendererDevice_GetDeletionQueue(GeometryPool->Device);
+
+    GCVulkanDeletionQueue_EnqueueBuffer(DeletionQueue, GeometryPool->IndexBufferHandle,
+                                        &GeometryPool->IndexBufferMemory);
+    GCVulkanDeletionQueue_EnqueueBuffer(DeletionQueue, GeometryPool->VertexBufferHandle,
+                                        &GeometryPool->VertexBufferMemory);
+}
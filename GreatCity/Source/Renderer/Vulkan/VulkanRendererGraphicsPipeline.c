@@ -24,10 +24,10 @@
 #include "Renderer/RendererGraphicsPipeline.h"
 #include "Renderer/Vulkan/VulkanRendererCommandList.h"
 #include "Renderer/Vulkan/VulkanRendererDevice.h"
+#include "Renderer/Vulkan/VulkanRendererRingBuffer.h"
 #include "Renderer/Vulkan/VulkanRendererShader.h"
 #include "Renderer/Vulkan/VulkanRendererSwapChain.h"
 #include "Renderer/Vulkan/VulkanRendererTexture2D.h"
-#include "Renderer/Vulkan/VulkanRendererUniformBuffer.h"
 #include "Renderer/Vulkan/VulkanUtilities.h"
 
 #include <stdbool.h>
@@ -39,7 +39,7 @@ typedef struct GCRendererGraphicsPipeline
     const GCRendererDevice* Device;
     const GCRendererSwapChain* SwapChain;
     const GCRendererCommandList* CommandList;
-    const GCRendererUniformBuffer* UniformBuffer;
+    const GCRendererRingBuffer* UniformRingBuffer;
     const GCRendererTexture2D* const* Texture2Ds;
     const GCRendererShader* Shader;
 
@@ -50,8 +50,10 @@ typedef struct GCRendererGraphicsPipeline
     VkPipelineLayout PipelineLayoutHandle;
     VkPipeline PipelineHandle;
 
+    size_t UniformDataSize;
     uint32_t Texture2DCount;
     uint32_t DescriptorCount;
+    uint32_t ColorAttachmentCount;
 } GCRendererGraphicsPipeline;
 
 static uint32_t GCRendererGraphicsPipeline_GetColorAttachmentCount(
@@ -83,7 +85,7 @@ GCRendererGraphicsPipeline* GCRendererGraphicsPipeline_Create(
     GraphicsPipeline->Device = Description->Device;
     GraphicsPipeline->SwapChain = Description->SwapChain;
     GraphicsPipeline->CommandList = Description->CommandList;
-    GraphicsPipeline->UniformBuffer = Description->UniformBuffer;
+    GraphicsPipeline->UniformRingBuffer = Description->UniformRingBuffer;
     GraphicsPipeline->Texture2Ds = Description->Texture2Ds;
     GraphicsPipeline->Shader = Description->Shader;
     GraphicsPipeline->SwapChainRenderPassHandle = VK_NULL_HANDLE;
@@ -93,8 +95,11 @@ GCRendererGraphicsPipeline* GCRendererGraphicsPipeline_Create(
     GraphicsPipeline->DescriptorSetHandle = VK_NULL_HANDLE;
     GraphicsPipeline->PipelineLayoutHandle = VK_NULL_HANDLE;
     GraphicsPipeline->PipelineHandle = VK_NULL_HANDLE;
+    GraphicsPipeline->UniformDataSize = Description->UniformDataSize;
     GraphicsPipeline->Texture2DCount = Description->Texture2DCount;
     GraphicsPipeline->DescriptorCount = 1 + GraphicsPipeline->Texture2DCount;
+    GraphicsPipeline->ColorAttachmentCount =
+        GCRendererGraphicsPipeline_GetColorAttachmentCount(Description->Attachments, Description->AttachmentCount);
 
     GCRendererGraphicsPipeline_CreateSwapChainRenderPass(GraphicsPipeline);
     GCRendererGraphicsPipeline_CreateAttachmentRenderPass(GraphicsPipeline, Description->Attachments,
@@ -379,7 +384,7 @@ void GCRendererGraphicsPipeline_CreateDescriptorSetLayout(GCRendererGraphicsPipe
     VkDescriptorSetLayoutBinding* DescriptorSetLayoutBindings = (VkDescriptorSetLayoutBinding*)GCMemory_AllocateZero(
         GraphicsPipeline->DescriptorCount * sizeof(VkDescriptorSetLayoutBinding));
     DescriptorSetLayoutBindings[0].binding = 0;
-    DescriptorSetLayoutBindings[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    DescriptorSetLayoutBindings[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
     DescriptorSetLayoutBindings[0].descriptorCount = 1;
     DescriptorSetLayoutBindings[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
 
@@ -443,7 +448,10 @@ void GCRendererGraphicsPipeline_CreateGraphicsPipeline(GCRendererGraphicsPipelin
     {
         VertexInputBindingDescriptions[Counter].binding = VertexInput->Bindings[Counter].Binding;
         VertexInputBindingDescriptions[Counter].stride = VertexInput->Bindings[Counter].Stride;
-        VertexInputBindingDescriptions[Counter].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        VertexInputBindingDescriptions[Counter].inputRate =
+            VertexInput->Bindings[Counter].InputRate == GCRendererGraphicsPipelineVertexInputRate_Instance
+                ? VK_VERTEX_INPUT_RATE_INSTANCE
+                : VK_VERTEX_INPUT_RATE_VERTEX;
     }
 
     VkVertexInputAttributeDescription* VertexInputAttributeDescriptions =
@@ -453,7 +461,7 @@ void GCRendererGraphicsPipeline_CreateGraphicsPipeline(GCRendererGraphicsPipelin
     for (uint32_t Counter = 0; Counter < VertexInput->AttributeCount; Counter++)
     {
         VertexInputAttributeDescriptions[Counter].location = VertexInput->Attributes[Counter].Location;
-        VertexInputAttributeDescriptions[Counter].binding = 0;
+        VertexInputAttributeDescriptions[Counter].binding = VertexInput->Attributes[Counter].Binding;
         VertexInputAttributeDescriptions[Counter].format =
             GCRendererGraphicsPipeline_ToVkFormat(VertexInput->Attributes[Counter].Format);
         VertexInputAttributeDescriptions[Counter].offset = VertexInput->Attributes[Counter].Offset;
@@ -525,7 +533,7 @@ void GCRendererGraphicsPipeline_CreateGraphicsPipeline(GCRendererGraphicsPipelin
     VkPipelineColorBlendStateCreateInfo PipelineColorBlendStateInformation = {0};
     PipelineColorBlendStateInformation.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
     PipelineColorBlendStateInformation.logicOpEnable = VK_FALSE;
-    PipelineColorBlendStateInformation.attachmentCount = 2;
+    PipelineColorBlendStateInformation.attachmentCount = GraphicsPipeline->ColorAttachmentCount;
     PipelineColorBlendStateInformation.pAttachments = PipelineColorBlendAttachmentStates;
 
     const VkDynamicState DynamicStates[2] = {VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR};
@@ -565,7 +573,7 @@ void GCRendererGraphicsPipeline_CreateDescriptorPool(GCRendererGraphicsPipeline*
 
     VkDescriptorPoolSize* DescriptorPoolSizes =
         (VkDescriptorPoolSize*)GCMemory_AllocateZero(GraphicsPipeline->DescriptorCount * sizeof(VkDescriptorPoolSize));
-    DescriptorPoolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    DescriptorPoolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
     DescriptorPoolSizes[0].descriptorCount = 1;
 
     for (uint32_t Counter = 0; Counter < GraphicsPipeline->Texture2DCount; Counter++)
@@ -605,9 +613,9 @@ void GCRendererGraphicsPipeline_CreateDescriptorSets(GCRendererGraphicsPipeline*
         (VkWriteDescriptorSet*)GCMemory_AllocateZero(GraphicsPipeline->DescriptorCount * sizeof(VkWriteDescriptorSet));
 
     VkDescriptorBufferInfo DescriptorBufferInformation = {0};
-    DescriptorBufferInformation.buffer = GCRendererUniformBuffer_GetBufferHandle(GraphicsPipeline->UniformBuffer);
+    DescriptorBufferInformation.buffer = GCRendererRingBuffer_GetBufferHandle(GraphicsPipeline->UniformRingBuffer);
     DescriptorBufferInformation.offset = 0;
-    DescriptorBufferInformation.range = GCRendererUniformBuffer_GetDataSize(GraphicsPipeline->UniformBuffer);
+    DescriptorBufferInformation.range = GraphicsPipeline->UniformDataSize;
 
     for (uint32_t Counter = 0; Counter < GraphicsPipeline->Texture2DCount; Counter++)
     {
@@ -632,7 +640,7 @@ void GCRendererGraphicsPipeline_CreateDescriptorSets(GCRendererGraphicsPipeline*
     WriteDescriptorSets[0].dstBinding = 0;
     WriteDescriptorSets[0].dstArrayElement = 0;
     WriteDescriptorSets[0].descriptorCount = 1;
-    WriteDescriptorSets[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    WriteDescriptorSets[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
     WriteDescriptorSets[0].pBufferInfo = &DescriptorBufferInformation;
 
     vkUpdateDescriptorSets(DeviceHandle, GraphicsPipeline->DescriptorCount, WriteDescriptorSets, 0, NULL);
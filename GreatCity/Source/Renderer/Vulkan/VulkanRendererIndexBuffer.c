@@ -21,7 +21,10 @@
 #include "Core/Memory/Allocator.h"
 #include "Renderer/RendererIndexBuffer.h"
 #include "Renderer/Vulkan/VulkanRendererCommandList.h"
+#include "Renderer/Vulkan/VulkanDeletionQueue.h"
+#include "Renderer/Vulkan/VulkanMemoryAllocator.h"
 #include "Renderer/Vulkan/VulkanRendererDevice.h"
+#include "Renderer/Vulkan/VulkanUploadQueue.h"
 #include "Renderer/Vulkan/VulkanUtilities.h"
 
 #include <stdbool.h>
@@ -36,7 +39,7 @@ typedef struct GCRendererIndexBuffer
     const GCRendererCommandList* CommandList;
 
     VkBuffer IndexBufferHandle;
-    VkDeviceMemory IndexBufferMemoryHandle;
+    GCVulkanMemoryAllocation IndexBufferMemory;
 
     uint32_t* Indices;
     uint32_t IndexCount;
@@ -52,7 +55,7 @@ GCRendererIndexBuffer* GCRendererIndexBuffer_Create(const GCRendererIndexBufferD
     IndexBuffer->Device = Description->Device;
     IndexBuffer->CommandList = Description->CommandList;
     IndexBuffer->IndexBufferHandle = VK_NULL_HANDLE;
-    IndexBuffer->IndexBufferMemoryHandle = VK_NULL_HANDLE;
+    IndexBuffer->IndexBufferMemory = (GCVulkanMemoryAllocation){0};
     IndexBuffer->Indices = Description->Indices;
     IndexBuffer->IndexCount = Description->IndexCount;
     IndexBuffer->IndexSize = Description->IndexSize;
@@ -81,38 +84,17 @@ VkBuffer GCRendererIndexBuffer_GetHandle(const GCRendererIndexBuffer* const Inde
 
 void GCRendererIndexBuffer_CreateIndexBuffer(GCRendererIndexBuffer* const IndexBuffer)
 {
-    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(IndexBuffer->Device);
-
-    VkBuffer StagingIndexBufferHandle = VK_NULL_HANDLE;
-    VkDeviceMemory StagingIndexBufferMemoryHandle = VK_NULL_HANDLE;
-
-    GCVulkanUtilities_CreateBuffer(IndexBuffer->Device, IndexBuffer->IndexSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                                   VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                                   &StagingIndexBufferHandle, &StagingIndexBufferMemoryHandle);
-
-    void* IndexData = NULL;
-    vkMapMemory(DeviceHandle, StagingIndexBufferMemoryHandle, 0, IndexBuffer->IndexSize, 0, &IndexData);
-    memcpy(IndexData, IndexBuffer->Indices, IndexBuffer->IndexSize);
-    vkUnmapMemory(DeviceHandle, StagingIndexBufferMemoryHandle);
-
     GCVulkanUtilities_CreateBuffer(IndexBuffer->Device, IndexBuffer->IndexSize,
                                    VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
                                    VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &IndexBuffer->IndexBufferHandle,
-                                   &IndexBuffer->IndexBufferMemoryHandle);
-
-    const VkCommandBuffer CommandBufferHandle = GCRendererCommandList_BeginSingleTimeCommands(IndexBuffer->CommandList);
-    GCVulkanUtilities_CopyBuffer(CommandBufferHandle, StagingIndexBufferHandle, IndexBuffer->IndexBufferHandle,
-                                 IndexBuffer->IndexSize);
-    GCRendererCommandList_EndSingleTimeCommands(IndexBuffer->CommandList, CommandBufferHandle);
+                                   &IndexBuffer->IndexBufferMemory);
 
-    vkFreeMemory(DeviceHandle, StagingIndexBufferMemoryHandle, NULL);
-    vkDestroyBuffer(DeviceHandle, StagingIndexBufferHandle, NULL);
+    GCVulkanUploadQueue_UploadBuffer(GCRendererCommandList_GetUploadQueue(IndexBuffer->CommandList),
+                                     IndexBuffer->IndexBufferHandle, 0, IndexBuffer->Indices, IndexBuffer->IndexSize);
 }
 
 void GCRendererIndexBuffer_DestroyObjects(GCRendererIndexBuffer* const IndexBuffer)
 {
-    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(IndexBuffer->Device);
-
-    vkFreeMemory(DeviceHandle, IndexBuffer->IndexBufferMemoryHandle, NULL);
-    vkDestroyBuffer(DeviceHandle, IndexBuffer->IndexBufferHandle, NULL);
+    GCVulkanDeletionQueue_EnqueueBuffer(GCRendererDevice_GetDeletionQueue(IndexBuffer->Device),
+                                        IndexBuffer->IndexBufferHandle, &IndexBuffer->IndexBufferMemory);
 }
\ No newline at end of file
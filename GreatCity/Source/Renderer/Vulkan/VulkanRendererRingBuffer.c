@@ -0,0 +1,183 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Renderer/Vulkan/VulkanRendererRingBuffer.h"
+#include "Core/Assert.h"
+#include "Core/Log.h"
+#include "Core/Memory/Allocator.h"
+#include "Renderer/RendererCommandList.h"
+#include "Renderer/RendererDevice.h"
+#include "Renderer/RendererRingBuffer.h"
+#include "Renderer/Vulkan/VulkanMemoryAllocator.h"
+#include "Renderer/Vulkan/VulkanRendererDevice.h"
+#include "Renderer/Vulkan/VulkanUtilities.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vulkan/vulkan.h>
+
+typedef struct GCRendererRingBuffer
+{
+    const GCRendererDevice* Device;
+    const GCRendererCommandList* CommandList;
+
+    VkBuffer RingBufferHandle;
+    GCVulkanMemoryAllocation RingBufferMemory;
+
+    uint8_t* Data;
+    GCRendererRingBufferFlags Flags;
+    size_t Alignment;
+    size_t FrameSize;
+    size_t FrameOffset;
+    size_t FrameUsedSize;
+    uint32_t FrameCount;
+} GCRendererRingBuffer;
+
+static void GCRendererRingBuffer_CreateRingBuffer(GCRendererRingBuffer* const RingBuffer);
+static void GCRendererRingBuffer_DestroyObjects(GCRendererRingBuffer* const RingBuffer);
+
+static size_t GCRendererRingBuffer_AlignSize(const size_t Size, const size_t Alignment);
+static VkBufferUsageFlags GCRendererRingBuffer_ToVkBufferUsageFlags(const GCRendererRingBufferFlags Flags);
+
+GCRendererRingBuffer* GCRendererRingBuffer_Create(const GCRendererRingBufferDescription* const Description)
+{
+    const GCRendererDeviceCapabilities DeviceCapabilities = GCRendererDevice_GetDeviceCapabilities(Description->Device);
+
+    GCRendererRingBuffer* RingBuffer = (GCRendererRingBuffer*)GCMemory_Allocate(sizeof(GCRendererRingBuffer));
+    RingBuffer->Device = Description->Device;
+    RingBuffer->CommandList = Description->CommandList;
+    RingBuffer->RingBufferHandle = VK_NULL_HANDLE;
+    RingBuffer->RingBufferMemory = (GCVulkanMemoryAllocation){0};
+    RingBuffer->Data = NULL;
+    RingBuffer->Flags = Description->Flags;
+    RingBuffer->Alignment = 16;
+
+    if ((Description->Flags & GCRendererRingBufferFlags_Uniform) &&
+        DeviceCapabilities.MinimumUniformBufferOffsetAlignment > RingBuffer->Alignment)
+    {
+        RingBuffer->Alignment = DeviceCapabilities.MinimumUniformBufferOffsetAlignment;
+    }
+
+    if ((Description->Flags & GCRendererRingBufferFlags_Storage) &&
+        DeviceCapabilities.MinimumStorageBufferOffsetAlignment > RingBuffer->Alignment)
+    {
+        RingBuffer->Alignment = DeviceCapabilities.MinimumStorageBufferOffsetAlignment;
+    }
+
+    RingBuffer->FrameSize = GCRendererRingBuffer_AlignSize(Description->FrameSize, RingBuffer->Alignment);
+    RingBuffer->FrameOffset = 0;
+    RingBuffer->FrameUsedSize = 0;
+    RingBuffer->FrameCount = GCRendererCommandList_GetMaximumFramesInFlight(Description->CommandList);
+
+    GCRendererRingBuffer_CreateRingBuffer(RingBuffer);
+
+    return RingBuffer;
+}
+
+void GCRendererRingBuffer_BeginFrame(GCRendererRingBuffer* const RingBuffer)
+{
+    RingBuffer->FrameOffset =
+        (size_t)GCRendererCommandList_GetCurrentFrame(RingBuffer->CommandList) * RingBuffer->FrameSize;
+    RingBuffer->FrameUsedSize = 0;
+}
+
+GCRendererRingBufferAllocation GCRendererRingBuffer_Allocate(GCRendererRingBuffer* const RingBuffer,
+                                                             const size_t Size)
+{
+    const size_t Offset = GCRendererRingBuffer_AlignSize(RingBuffer->FrameUsedSize, RingBuffer->Alignment);
+
+    GC_ASSERT_WITH_MESSAGE(Offset + Size <= RingBuffer->FrameSize,
+                           "Failed to allocate %zu bytes from a ring buffer frame of %zu bytes", Size,
+                           RingBuffer->FrameSize);
+
+    RingBuffer->FrameUsedSize = Offset + Size;
+
+    GCRendererRingBufferAllocation Allocation = {0};
+    Allocation.Data = RingBuffer->Data + RingBuffer->FrameOffset + Offset;
+    Allocation.Offset = (uint32_t)(RingBuffer->FrameOffset + Offset);
+
+    return Allocation;
+}
+
+size_t GCRendererRingBuffer_GetFrameSize(const GCRendererRingBuffer* const RingBuffer)
+{
+    return RingBuffer->FrameSize;
+}
+
+size_t GCRendererRingBuffer_GetFrameUsedSize(const GCRendererRingBuffer* const RingBuffer)
+{
+    return RingBuffer->FrameUsedSize;
+}
+
+void GCRendererRingBuffer_Destroy(GCRendererRingBuffer* RingBuffer)
+{
+    GCRendererDevice_WaitIdle(RingBuffer->Device);
+
+    GCRendererRingBuffer_DestroyObjects(RingBuffer);
+
+    GCMemory_Free(RingBuffer);
+}
+
+VkBuffer GCRendererRingBuffer_GetBufferHandle(const GCRendererRingBuffer* const RingBuffer)
+{
+    return RingBuffer->RingBufferHandle;
+}
+
+void GCRendererRingBuffer_CreateRingBuffer(GCRendererRingBuffer* const RingBuffer)
+{
+    const size_t RingBufferSize = RingBuffer->FrameSize * RingBuffer->FrameCount;
+
+    GCVulkanUtilities_CreateBuffer(RingBuffer->Device, RingBufferSize,
+                                   GCRendererRingBuffer_ToVkBufferUsageFlags(RingBuffer->Flags),
+                                   VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                   &RingBuffer->RingBufferHandle, &RingBuffer->RingBufferMemory);
+
+    RingBuffer->Data = (uint8_t*)RingBuffer->RingBufferMemory.MappedData;
+}
+
+void GCRendererRingBuffer_DestroyObjects(GCRendererRingBuffer* const RingBuffer)
+{
+    GCVulkanUtilities_DestroyBuffer(RingBuffer->Device, RingBuffer->RingBufferHandle, &RingBuffer->RingBufferMemory);
+}
+
+size_t GCRendererRingBuffer_AlignSize(const size_t Size, const size_t Alignment)
+{
+    return (Size + Alignment - 1) & ~(Alignment - 1);
+}
+
+VkBufferUsageFlags GCRendererRingBuffer_ToVkBufferUsageFlags(const GCRendererRingBufferFlags Flags)
+{
+    VkBufferUsageFlags BufferUsageFlags = 0;
+
+    if (Flags & GCRendererRingBufferFlags_Uniform)
+    {
+        BufferUsageFlags |= VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    }
+
+    if (Flags & GCRendererRingBufferFlags_Storage)
+    {
+        BufferUsageFlags |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    }
+
+    if (Flags & GCRendererRingBufferFlags_Vertex)
+    {
+        BufferUsageFlags |= VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+    }
+
+    return BufferUsageFlags;
+}
@@ -36,20 +36,23 @@
 typedef enum GCRendererShaderType
 {
     GCRendererShaderType_Vertex,
-    GCRendererShaderType_Fragment
+    GCRendererShaderType_Fragment,
+    GCRendererShaderType_Compute
 } GCRendererShaderType;
 
 typedef struct GCRendererShader
 {
     const GCRendererDevice* Device;
 
-    VkShaderModule VertexShaderModuleHandle, FragmentShaderModuleHandle;
+    VkShaderModule VertexShaderModuleHandle, FragmentShaderModuleHandle, ComputeShaderModuleHandle;
 
     const char* ShaderCacheDirectory;
     uint32_t* VertexShaderData;
     size_t VertexShaderDataSize;
     uint32_t* FragmentShaderData;
     size_t FragmentShaderDataSize;
+    uint32_t* ComputeShaderData;
+    size_t ComputeShaderDataSize;
 } GCRendererShader;
 
 static void GCRendererShader_CreateCacheDirectoryIfNeeded(const GCRendererShader* const Shader);
@@ -63,26 +66,57 @@ static shaderc_compilation_result_t GCRendererShader_CompileShader(const shaderc
 static char* GCRendererShader_GetShaderName(const char* const Path);
 static char* GCRendererShader_GetShaderCachePath(const GCRendererShader* const Shader, const char* const Path,
                                                  const GCRendererShaderType Type);
-static void GCRendererShader_CompileOrGetBinaries(GCRendererShader* const Shader, const char* const VertexShaderPath,
-                                                  const char* const FragmentShaderPath);
-static void GCRendererShader_CreateShaderModule(GCRendererShader* const Shader);
+static void GCRendererShader_CompileOrGetBinary(const GCRendererShader* const Shader, const char* const Path,
+                                                const GCRendererShaderType Type, uint32_t** Data, size_t* DataSize);
+static VkShaderModule GCRendererShader_CreateShaderModule(const GCRendererShader* const Shader, uint32_t* Data,
+                                                          const size_t DataSize, const GCRendererShaderType Type);
 static void GCRendererShader_DestroyObjects(GCRendererShader* const Shader);
 
+static shaderc_shader_kind GCRendererShader_ToShadercShaderKind(const GCRendererShaderType Type);
+static const char* GCRendererShader_GetShaderTypeName(const GCRendererShaderType Type);
+static const char* GCRendererShader_GetShaderCacheFileExtension(const GCRendererShaderType Type);
+
 GCRendererShader* GCRendererShader_Create(const GCRendererShaderDescription* const Description)
 {
     GCRendererShader* Shader = (GCRendererShader*)GCMemory_Allocate(sizeof(GCRendererShader));
     Shader->Device = Description->Device;
     Shader->VertexShaderModuleHandle = VK_NULL_HANDLE;
     Shader->FragmentShaderModuleHandle = VK_NULL_HANDLE;
+    Shader->ComputeShaderModuleHandle = VK_NULL_HANDLE;
+#ifdef GC_RENDERER_CPU_PICKING
+    Shader->ShaderCacheDirectory = "Assets/Cache/Shaders/Vulkan/CPUPicking/";
+#else
     Shader->ShaderCacheDirectory = "Assets/Cache/Shaders/Vulkan/";
+#endif
     Shader->VertexShaderData = NULL;
     Shader->VertexShaderDataSize = 0;
     Shader->FragmentShaderData = NULL;
     Shader->FragmentShaderDataSize = 0;
+    Shader->ComputeShaderData = NULL;
+    Shader->ComputeShaderDataSize = 0;
 
     GCRendererShader_CreateCacheDirectoryIfNeeded(Shader);
-    GCRendererShader_CompileOrGetBinaries(Shader, Description->VertexShaderPath, Description->FragmentShaderPath);
-    GCRendererShader_CreateShaderModule(Shader);
+
+    if (Description->ComputeShaderPath)
+    {
+        GCRendererShader_CompileOrGetBinary(Shader, Description->ComputeShaderPath, GCRendererShaderType_Compute,
+                                            &Shader->ComputeShaderData, &Shader->ComputeShaderDataSize);
+
+        Shader->ComputeShaderModuleHandle = GCRendererShader_CreateShaderModule(
+            Shader, Shader->ComputeShaderData, Shader->ComputeShaderDataSize, GCRendererShaderType_Compute);
+    }
+    else
+    {
+        GCRendererShader_CompileOrGetBinary(Shader, Description->VertexShaderPath, GCRendererShaderType_Vertex,
+                                            &Shader->VertexShaderData, &Shader->VertexShaderDataSize);
+        GCRendererShader_CompileOrGetBinary(Shader, Description->FragmentShaderPath, GCRendererShaderType_Fragment,
+                                            &Shader->FragmentShaderData, &Shader->FragmentShaderDataSize);
+
+        Shader->VertexShaderModuleHandle = GCRendererShader_CreateShaderModule(
+            Shader, Shader->VertexShaderData, Shader->VertexShaderDataSize, GCRendererShaderType_Vertex);
+        Shader->FragmentShaderModuleHandle = GCRendererShader_CreateShaderModule(
+            Shader, Shader->FragmentShaderData, Shader->FragmentShaderDataSize, GCRendererShaderType_Fragment);
+    }
 
     return Shader;
 }
@@ -106,6 +140,11 @@ VkShaderModule GCRendererShader_GetFragmentShaderModuleHandle(const GCRendererSh
     return Shader->FragmentShaderModuleHandle;
 }
 
+VkShaderModule GCRendererShader_GetComputeShaderModuleHandle(const GCRendererShader* const Shader)
+{
+    return Shader->ComputeShaderModuleHandle;
+}
+
 void GCRendererShader_CreateCacheDirectoryIfNeeded(const GCRendererShader* const Shader)
 {
     if (!GCFileSystem_Exists(Shader->ShaderCacheDirectory))
@@ -173,15 +212,13 @@ shaderc_compilation_result_t GCRendererShader_CompileShader(const shaderc_compil
 {
     const shaderc_compilation_result_t ShaderCompilationResult =
         shaderc_compile_into_spv(Compiler, Source, strlen(Source) * sizeof(char),
-                                 Type == GCRendererShaderType_Vertex ? shaderc_vertex_shader : shaderc_fragment_shader,
-                                 Path, "main", CompileOptions);
+                                 GCRendererShader_ToShadercShaderKind(Type), Path, "main", CompileOptions);
     const shaderc_compilation_status ShaderCompilationStatus =
         shaderc_result_get_compilation_status(ShaderCompilationResult);
 
     if (ShaderCompilationStatus != shaderc_compilation_status_success)
     {
-        GC_ASSERT_WITH_MESSAGE(false, "Failed to compile GLSL %s shader:\n%s",
-                               Type == GCRendererShaderType_Vertex ? "vertex" : "fragment",
+        GC_ASSERT_WITH_MESSAGE(false, "Failed to compile GLSL %s shader:\n%s", GCRendererShader_GetShaderTypeName(Type),
                                shaderc_result_get_error_message(ShaderCompilationResult));
     }
 
@@ -198,7 +235,7 @@ char* GCRendererShader_GetShaderCachePath(const GCRendererShader* const Shader,
                                           const GCRendererShaderType Type)
 {
     char* ShaderName = GCRendererShader_GetShaderName(Path);
-    const char* const ShaderFileExtension = Type == GCRendererShaderType_Vertex ? ".cached.vert" : ".cached.frag";
+    const char* const ShaderFileExtension = GCRendererShader_GetShaderCacheFileExtension(Type);
     char* ShaderCachePath = (char*)GCMemory_Allocate(
         (strlen(Shader->ShaderCacheDirectory) + strlen(ShaderName) + strlen(ShaderFileExtension) + 1) * sizeof(char));
 
@@ -211,52 +248,31 @@ char* GCRendererShader_GetShaderCachePath(const GCRendererShader* const Shader,
     return ShaderCachePath;
 }
 
-void GCRendererShader_CompileOrGetBinaries(GCRendererShader* const Shader, const char* const VertexShaderPath,
-                                           const char* const FragmentShaderPath)
+void GCRendererShader_CompileOrGetBinary(const GCRendererShader* const Shader, const char* const Path,
+                                         const GCRendererShaderType Type, uint32_t** Data, size_t* DataSize)
 {
-    char* VertexShaderCachePath =
-        GCRendererShader_GetShaderCachePath(Shader, VertexShaderPath, GCRendererShaderType_Vertex);
-    char* FragmentShaderCachePath =
-        GCRendererShader_GetShaderCachePath(Shader, FragmentShaderPath, GCRendererShaderType_Fragment);
+    char* ShaderCachePath = GCRendererShader_GetShaderCachePath(Shader, Path, Type);
 
-    if (GCFileSystem_Exists(VertexShaderCachePath) && GCFileSystem_Exists(FragmentShaderCachePath))
+    if (GCFileSystem_Exists(ShaderCachePath))
     {
-        const GCFileSystemFileAttributes VertexShaderFileAttributes = GCFileSystem_GetFileAttributes(VertexShaderPath);
-        const GCFileSystemFileAttributes VertexShaderCacheFileAttributes =
-            GCFileSystem_GetFileAttributes(VertexShaderCachePath);
-        const GCFileSystemFileAttributes FragmentShaderFileAttributes =
-            GCFileSystem_GetFileAttributes(FragmentShaderPath);
-        const GCFileSystemFileAttributes FragmentShaderCacheFileAttributes =
-            GCFileSystem_GetFileAttributes(FragmentShaderCachePath);
-
-        const GCFileSystemFileTime VertexShaderFileTime = VertexShaderFileAttributes.LastWriteTime;
-        const GCFileSystemFileTime VertexShaderCacheFileTime = VertexShaderCacheFileAttributes.LastWriteTime;
-        const GCFileSystemFileTime FragmentShaderFileTime = FragmentShaderFileAttributes.LastWriteTime;
-        const GCFileSystemFileTime FragmentShaderCacheFileTime = FragmentShaderCacheFileAttributes.LastWriteTime;
-
-        if (!GCFileSystemFileTime_IsNewer(VertexShaderFileTime, VertexShaderCacheFileTime) &&
-            !GCFileSystemFileTime_IsNewer(FragmentShaderFileTime, FragmentShaderCacheFileTime))
+        const GCFileSystemFileAttributes ShaderFileAttributes = GCFileSystem_GetFileAttributes(Path);
+        const GCFileSystemFileAttributes ShaderCacheFileAttributes = GCFileSystem_GetFileAttributes(ShaderCachePath);
+
+        const GCFileSystemFileTime ShaderFileTime = ShaderFileAttributes.LastWriteTime;
+        const GCFileSystemFileTime ShaderCacheFileTime = ShaderCacheFileAttributes.LastWriteTime;
+
+        if (!GCFileSystemFileTime_IsNewer(ShaderFileTime, ShaderCacheFileTime))
         {
-            char* VertexShaderCacheData = NULL;
-            char* FragmentShaderCacheData = NULL;
-
-            Shader->VertexShaderDataSize =
-                GCRendererShader_ReadShaderBinaryFile(VertexShaderCachePath, &VertexShaderCacheData);
-            Shader->FragmentShaderDataSize =
-                GCRendererShader_ReadShaderBinaryFile(FragmentShaderCachePath, &FragmentShaderCacheData);
-
-            if (VertexShaderCacheData && FragmentShaderCacheData)
-            {
-                Shader->VertexShaderData = (uint32_t*)VertexShaderCacheData;
-                Shader->FragmentShaderData = (uint32_t*)FragmentShaderCacheData;
-            }
+            char* ShaderCacheData = NULL;
+
+            *DataSize = GCRendererShader_ReadShaderBinaryFile(ShaderCachePath, &ShaderCacheData);
+            *Data = (uint32_t*)ShaderCacheData;
         }
     }
 
-    if (!Shader->VertexShaderData || !Shader->FragmentShaderData)
+    if (!*Data)
     {
-        char* VertexShaderSource = GCRendererShader_ReadShaderSourceFile(VertexShaderPath);
-        char* FragmentShaderSource = GCRendererShader_ReadShaderSourceFile(FragmentShaderPath);
+        char* ShaderSource = GCRendererShader_ReadShaderSourceFile(Path);
 
         shaderc_compiler_t ShaderCompiler = shaderc_compiler_initialize();
         shaderc_compile_options_t ShaderCompileOptions = shaderc_compile_options_initialize();
@@ -268,73 +284,130 @@ void GCRendererShader_CompileOrGetBinaries(GCRendererShader* const Shader, const
         shaderc_compile_options_set_optimization_level(ShaderCompileOptions, shaderc_optimization_level_performance);
 #endif
 
-        char* VertexShaderCacheData = NULL;
-        char* FragmentShaderCacheData = NULL;
-
-        const shaderc_compilation_result_t VertexShaderCompilationResult = GCRendererShader_CompileShader(
-            ShaderCompiler, ShaderCompileOptions, VertexShaderPath, VertexShaderSource, GCRendererShaderType_Vertex);
-        VertexShaderCacheData = (char*)shaderc_result_get_bytes(VertexShaderCompilationResult);
-        Shader->VertexShaderDataSize = shaderc_result_get_length(VertexShaderCompilationResult);
-
-        const shaderc_compilation_result_t FragmentShaderCompilationResult =
-            GCRendererShader_CompileShader(ShaderCompiler, ShaderCompileOptions, FragmentShaderPath,
-                                           FragmentShaderSource, GCRendererShaderType_Fragment);
-        FragmentShaderCacheData = (char*)shaderc_result_get_bytes(FragmentShaderCompilationResult);
-        Shader->FragmentShaderDataSize = shaderc_result_get_length(FragmentShaderCompilationResult);
+#ifdef GC_RENDERER_CPU_PICKING
+        shaderc_compile_options_add_macro_definition(ShaderCompileOptions, "GC_RENDERER_CPU_PICKING",
+                                                     strlen("GC_RENDERER_CPU_PICKING"), "1", 1);
+#endif
 
-        GCRendererShader_WriteShaderBinaryFile(VertexShaderCachePath, VertexShaderCacheData,
-                                               Shader->VertexShaderDataSize);
-        GCRendererShader_WriteShaderBinaryFile(FragmentShaderCachePath, FragmentShaderCacheData,
-                                               Shader->FragmentShaderDataSize);
+        const shaderc_compilation_result_t ShaderCompilationResult =
+            GCRendererShader_CompileShader(ShaderCompiler, ShaderCompileOptions, Path, ShaderSource, Type);
+        const char* const ShaderCacheData = shaderc_result_get_bytes(ShaderCompilationResult);
+        *DataSize = shaderc_result_get_length(ShaderCompilationResult);
 
-        Shader->VertexShaderData = (uint32_t*)GCMemory_Allocate(Shader->VertexShaderDataSize);
-        Shader->FragmentShaderData = (uint32_t*)GCMemory_Allocate(Shader->FragmentShaderDataSize);
+        GCRendererShader_WriteShaderBinaryFile(ShaderCachePath, ShaderCacheData, *DataSize);
 
-        memcpy(Shader->VertexShaderData, VertexShaderCacheData, Shader->VertexShaderDataSize);
-        memcpy(Shader->FragmentShaderData, FragmentShaderCacheData, Shader->FragmentShaderDataSize);
+        *Data = (uint32_t*)GCMemory_Allocate(*DataSize);
+        memcpy(*Data, ShaderCacheData, *DataSize);
 
-        shaderc_result_release(FragmentShaderCompilationResult);
-        shaderc_result_release(VertexShaderCompilationResult);
+        shaderc_result_release(ShaderCompilationResult);
         shaderc_compile_options_release(ShaderCompileOptions);
         shaderc_compiler_release(ShaderCompiler);
 
-        GCMemory_Free(FragmentShaderSource);
-        GCMemory_Free(VertexShaderSource);
+        GCMemory_Free(ShaderSource);
     }
 
-    GCMemory_Free(FragmentShaderCachePath);
-    GCMemory_Free(VertexShaderCachePath);
+    GCMemory_Free(ShaderCachePath);
 }
 
-void GCRendererShader_CreateShaderModule(GCRendererShader* const Shader)
+VkShaderModule GCRendererShader_CreateShaderModule(const GCRendererShader* const Shader, uint32_t* Data,
+                                                   const size_t DataSize, const GCRendererShaderType Type)
 {
     const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(Shader->Device);
 
-    VkShaderModuleCreateInfo VertexShaderModuleInformation = {0};
-    VertexShaderModuleInformation.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-    VertexShaderModuleInformation.codeSize = Shader->VertexShaderDataSize;
-    VertexShaderModuleInformation.pCode = Shader->VertexShaderData;
-
-    VkShaderModuleCreateInfo FragmentShaderModuleInformation = {0};
-    FragmentShaderModuleInformation.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-    FragmentShaderModuleInformation.codeSize = Shader->FragmentShaderDataSize;
-    FragmentShaderModuleInformation.pCode = Shader->FragmentShaderData;
-
-    GC_VULKAN_VALIDATE(
-        vkCreateShaderModule(DeviceHandle, &VertexShaderModuleInformation, NULL, &Shader->VertexShaderModuleHandle),
-        "Failed to create a Vulkan vertex shader module");
-    GC_VULKAN_VALIDATE(
-        vkCreateShaderModule(DeviceHandle, &FragmentShaderModuleInformation, NULL, &Shader->FragmentShaderModuleHandle),
-        "Failed to create a Vulkan fragment shader module");
-
-    GCMemory_Free(Shader->FragmentShaderData);
-    GCMemory_Free(Shader->VertexShaderData);
+    VkShaderModuleCreateInfo ShaderModuleInformation = {0};
+    ShaderModuleInformation.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    ShaderModuleInformation.codeSize = DataSize;
+    ShaderModuleInformation.pCode = Data;
+
+    VkShaderModule ShaderModuleHandle = VK_NULL_HANDLE;
+    GC_VULKAN_VALIDATE(vkCreateShaderModule(DeviceHandle, &ShaderModuleInformation, NULL, &ShaderModuleHandle),
+                       "Failed to create a Vulkan %s shader module", GCRendererShader_GetShaderTypeName(Type));
+
+    GCMemory_Free(Data);
+
+    return ShaderModuleHandle;
 }
 
 void GCRendererShader_DestroyObjects(GCRendererShader* const Shader)
 {
     const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(Shader->Device);
 
+    vkDestroyShaderModule(DeviceHandle, Shader->ComputeShaderModuleHandle, NULL);
     vkDestroyShaderModule(DeviceHandle, Shader->FragmentShaderModuleHandle, NULL);
     vkDestroyShaderModule(DeviceHandle, Shader->VertexShaderModuleHandle, NULL);
-}
\ No newline at end of file
+}
+
+shaderc_shader_kind GCRendererShader_ToShadercShaderKind(const GCRendererShaderType Type)
+{
+    switch (Type)
+    {
+    case GCRendererShaderType_Vertex: {
+        return shaderc_vertex_shader;
+
+        break;
+    }
+    case GCRendererShaderType_Fragment: {
+        return shaderc_fragment_shader;
+
+        break;
+    }
+    case GCRendererShaderType_Compute: {
+        return shaderc_compute_shader;
+
+        break;
+    }
+    }
+
+    GC_ASSERT_WITH_MESSAGE(false, "'%d': Invalid GCRendererShaderType", Type);
+    return shaderc_vertex_shader;
+}
+
+const char* GCRendererShader_GetShaderTypeName(const GCRendererShaderType Type)
+{
+    switch (Type)
+    {
+    case GCRendererShaderType_Vertex: {
+        return "vertex";
+
+        break;
+    }
+    case GCRendererShaderType_Fragment: {
+        return "fragment";
+
+        break;
+    }
+    case GCRendererShaderType_Compute: {
+        return "compute";
+
+        break;
+    }
+    }
+
+    GC_ASSERT_WITH_MESSAGE(false, "'%d': Invalid GCRendererShaderType", Type);
+    return "";
+}
+
+const char* GCRendererShader_GetShaderCacheFileExtension(const GCRendererShaderType Type)
+{
+    switch (Type)
+    {
+    case GCRendererShaderType_Vertex: {
+        return ".cached.vert";
+
+        break;
+    }
+    case GCRendererShaderType_Fragment: {
+        return ".cached.frag";
+
+        break;
+    }
+    case GCRendererShaderType_Compute: {
+        return ".cached.comp";
+
+        break;
+    }
+    }
+
+    GC_ASSERT_WITH_MESSAGE(false, "'%d': Invalid GCRendererShaderType", Type);
+    return "";
+}
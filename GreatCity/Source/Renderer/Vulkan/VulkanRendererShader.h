@@ -29,6 +29,7 @@ extern "C"
 
     VkShaderModule GCRendererShader_GetVertexShaderModuleHandle(const GCRendererShader* const Shader);
     VkShaderModule GCRendererShader_GetFragmentShaderModuleHandle(const GCRendererShader* const Shader);
+    VkShaderModule GCRendererShader_GetComputeShaderModuleHandle(const GCRendererShader* const Shader);
 
 #ifdef __cplusplus
 }
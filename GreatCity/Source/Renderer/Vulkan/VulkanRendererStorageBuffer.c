@@ -0,0 +1,124 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "Renderer/Vulkan/VulkanRendererStorageBuffer.h"
+#include "Core/Assert.h"
+#include "Core/Log.h"
+#include "Core/Memory/Allocator.h"
+#include "Renderer/RendererDevice.h"
+#include "Renderer/RendererStorageBuffer.h"
+#include "Renderer/Vulkan/VulkanDeletionQueue.h"
+#include "Renderer/Vulkan/VulkanMemoryAllocator.h"
+#include "Renderer/Vulkan/VulkanRendererDevice.h"
+#include "Renderer/Vulkan/VulkanUtilities.h"
+
+#include <string.h>
+
+#include <vulkan/vulkan.h>
+
+typedef struct GCRendererStorageBuffer
+{
+    const GCRendererDevice* Device;
+    const GCRendererCommandList* CommandList;
+
+    VkBuffer StorageBufferHandle;
+    GCVulkanMemoryAllocation StorageBufferMemory;
+
+    GCRendererStorageBufferFlags Flags;
+    void* Data;
+    size_t DataSize;
+} GCRendererStorageBuffer;
+
+static void GCRendererStorageBuffer_CreateStorageBuffer(GCRendererStorageBuffer* const StorageBuffer);
+static void GCRendererStorageBuffer_DestroyObjects(GCRendererStorageBuffer* const StorageBuffer);
+
+GCRendererStorageBuffer* GCRendererStorageBuffer_Create(const GCRendererStorageBufferDescription* const Description)
+{
+    GCRendererStorageBuffer* StorageBuffer =
+        (GCRendererStorageBuffer*)GCMemory_Allocate(sizeof(GCRendererStorageBuffer));
+    StorageBuffer->Device = Description->Device;
+    StorageBuffer->CommandList = Description->CommandList;
+    StorageBuffer->StorageBufferHandle = VK_NULL_HANDLE;
+    StorageBuffer->StorageBufferMemory = (GCVulkanMemoryAllocation){0};
+    StorageBuffer->Flags = Description->Flags;
+    StorageBuffer->Data = NULL;
+    StorageBuffer->DataSize = Description->DataSize;
+
+    GCRendererStorageBuffer_CreateStorageBuffer(StorageBuffer);
+
+    return StorageBuffer;
+}
+
+void GCRendererStorageBuffer_SetData(const GCRendererStorageBuffer* const StorageBuffer, const void* const Data,
+                                     const size_t DataSize)
+{
+    GC_ASSERT_WITH_MESSAGE(StorageBuffer->Data, "Only host-visible storage buffers can be written from the CPU");
+
+    memcpy(StorageBuffer->Data, Data, DataSize);
+}
+
+void* GCRendererStorageBuffer_GetData(const GCRendererStorageBuffer* const StorageBuffer)
+{
+    return StorageBuffer->Data;
+}
+
+size_t GCRendererStorageBuffer_GetDataSize(const GCRendererStorageBuffer* const StorageBuffer)
+{
+    return StorageBuffer->DataSize;
+}
+
+void GCRendererStorageBuffer_Destroy(GCRendererStorageBuffer* StorageBuffer)
+{
+    GCRendererStorageBuffer_DestroyObjects(StorageBuffer);
+
+    GCMemory_Free(StorageBuffer);
+}
+
+VkBuffer GCRendererStorageBuffer_GetBufferHandle(const GCRendererStorageBuffer* const StorageBuffer)
+{
+    return StorageBuffer->StorageBufferHandle;
+}
+
+void GCRendererStorageBuffer_CreateStorageBuffer(GCRendererStorageBuffer* const StorageBuffer)
+{
+    VkBufferUsageFlags Usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+
+    if (StorageBuffer->Flags & GCRendererStorageBufferFlags_Vertex)
+    {
+        Usage |= VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+    }
+
+    if (StorageBuffer->Flags & GCRendererStorageBufferFlags_Indirect)
+    {
+        Usage |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+    }
+
+    const VkMemoryPropertyFlags MemoryProperty =
+        StorageBuffer->Flags & GCRendererStorageBufferFlags_HostVisible
+            ? VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+            : VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+
+    GCVulkanUtilities_CreateBuffer(StorageBuffer->Device, StorageBuffer->DataSize, Usage, MemoryProperty,
+                                   &StorageBuffer->StorageBufferHandle, &StorageBuffer->StorageBufferMemory);
+
+    StorageBuffer->Data = StorageBuffer->StorageBufferMemory.MappedData;
+}
+
+void GCRendererStorageBuffer_DestroyObjects(GCRendererStorageBuffer* const StorageBuffer)
+{
+    GCVulkanDeletionQueue_EnqueueBuffer(GCRendererDevice_GetDeletionQueue(StorageBuffer->Device),
+                                        StorageBuffer->StorageBufferHandle, &StorageBuffer->StorageBufferMemory);
+}
@@ -14,11 +14,8 @@
     You should have received a copy of the GNU General Public License
     along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
-
-#ifndef GC_RENDERER_VULKAN_VULKAN_RENDERER_UNIFORM_BUFFER_H
-#define GC_RENDERER_VULKAN_VULKAN_RENDERER_UNIFORM_BUFFER_H
-
-#include <stdint.h>
+#ifndef GC_RENDERER_VULKAN_VULKAN_RENDERER_STORAGE_BUFFER_H
+#define GC_RENDERER_VULKAN_VULKAN_RENDERER_STORAGE_BUFFER_H
 
 #include <vulkan/vulkan.h>
 
@@ -27,14 +24,12 @@ extern "C"
 {
 #endif
 
-    typedef struct GCRendererUniformBuffer GCRendererUniformBuffer;
+    typedef struct GCRendererStorageBuffer GCRendererStorageBuffer;
 
-    VkBuffer GCRendererUniformBuffer_GetBufferHandle(const GCRendererUniformBuffer* const UniformBuffer);
-    void* GCRendererUniformBuffer_GetData(const GCRendererUniformBuffer* const UniformBuffer);
-    size_t GCRendererUniformBuffer_GetDataSize(const GCRendererUniformBuffer* const UniformBuffer);
+    VkBuffer GCRendererStorageBuffer_GetBufferHandle(const GCRendererStorageBuffer* const StorageBuffer);
 
 #ifdef __cplusplus
 }
 #endif
 
-#endif
\ No newline at end of file
+#endif
@@ -23,7 +23,10 @@
 #include "Renderer/RendererDevice.h"
 #include "Renderer/RendererTexture2D.h"
 #include "Renderer/Vulkan/VulkanRendererCommandList.h"
+#include "Renderer/Vulkan/VulkanDeletionQueue.h"
+#include "Renderer/Vulkan/VulkanMemoryAllocator.h"
 #include "Renderer/Vulkan/VulkanRendererDevice.h"
+#include "Renderer/Vulkan/VulkanUploadQueue.h"
 #include "Renderer/Vulkan/VulkanUtilities.h"
 
 #include <math.h>
@@ -40,7 +43,7 @@ typedef struct GCRendererTexture2D
     const GCRendererCommandList* CommandList;
 
     VkImage ImageHandle;
-    VkDeviceMemory ImageMemoryHandle;
+    GCVulkanMemoryAllocation ImageMemory;
     VkImageView ImageViewHandle;
     VkSampler ImageSamplerHandle;
 } GCRendererTexture2D;
@@ -56,7 +59,7 @@ GCRendererTexture2D* GCRendererTexture2D_Create(const GCRendererTexture2DDescrip
     Texture2D->Device = Description->Device;
     Texture2D->CommandList = Description->CommandList;
     Texture2D->ImageHandle = VK_NULL_HANDLE;
-    Texture2D->ImageMemoryHandle = VK_NULL_HANDLE;
+    Texture2D->ImageMemory = (GCVulkanMemoryAllocation){0};
     Texture2D->ImageViewHandle = VK_NULL_HANDLE;
     Texture2D->ImageSamplerHandle = VK_NULL_HANDLE;
 
@@ -161,8 +164,6 @@ void GCRendererTexture2D_LoadPNG(const char* const TexturePath, uint32_t* const
 
 void GCRendererTexture2D_CreateTexture(GCRendererTexture2D* const Texture2D, const char* const TexturePath)
 {
-    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(Texture2D->Device);
-
     uint32_t TextureWidth = 0, TextureHeight = 0, TextureChannels = 0;
     uint8_t* TextureData = NULL;
     uint8_t** TextureRowPointers = NULL;
@@ -173,35 +174,15 @@ void GCRendererTexture2D_CreateTexture(GCRendererTexture2D* const Texture2D, con
     const size_t ImageSize = TextureWidth * TextureHeight * TextureChannels;
     const uint32_t MipLevels = (uint32_t)floorf(log2f(fmaxf((float)TextureWidth, (float)TextureHeight))) + 1;
 
-    VkBuffer StagingImageBufferHandle = VK_NULL_HANDLE;
-    VkDeviceMemory StagingImageBufferMemoryHandle = VK_NULL_HANDLE;
-
-    GCVulkanUtilities_CreateBuffer(Texture2D->Device, ImageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                                   VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                                   &StagingImageBufferHandle, &StagingImageBufferMemoryHandle);
-
-    void* ImageData = NULL;
-    vkMapMemory(DeviceHandle, StagingImageBufferMemoryHandle, 0, ImageSize, 0, &ImageData);
-    memcpy(ImageData, TextureData, ImageSize);
-    vkUnmapMemory(DeviceHandle, StagingImageBufferMemoryHandle);
-
     GCVulkanUtilities_CreateImage(
         Texture2D->Device, TextureWidth, TextureHeight, MipLevels, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_TILING_OPTIMAL,
         VK_SAMPLE_COUNT_1_BIT,
         VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
-        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &Texture2D->ImageHandle, &Texture2D->ImageMemoryHandle);
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &Texture2D->ImageHandle, &Texture2D->ImageMemory);
 
-    const VkCommandBuffer CommandBufferHandle = GCRendererCommandList_BeginSingleTimeCommands(Texture2D->CommandList);
-    GCVulkanUtilities_TransitionImageLayout(CommandBufferHandle, Texture2D->ImageHandle, MipLevels,
-                                            VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-    GCVulkanUtilities_CopyBufferToImage(CommandBufferHandle, StagingImageBufferHandle, Texture2D->ImageHandle,
-                                        TextureWidth, TextureHeight);
-    GCVulkanUtilities_GenerateMipmap(Texture2D->Device, CommandBufferHandle, Texture2D->ImageHandle, TextureWidth,
-                                     TextureHeight, MipLevels, VK_FORMAT_R8G8B8A8_SRGB);
-    GCRendererCommandList_EndSingleTimeCommands(Texture2D->CommandList, CommandBufferHandle);
-
-    vkFreeMemory(DeviceHandle, StagingImageBufferMemoryHandle, NULL);
-    vkDestroyBuffer(DeviceHandle, StagingImageBufferHandle, NULL);
+    GCVulkanUploadQueue_UploadTexture2D(GCRendererCommandList_GetUploadQueue(Texture2D->CommandList),
+                                        Texture2D->ImageHandle, TextureWidth, TextureHeight, MipLevels,
+                                        VK_FORMAT_R8G8B8A8_SRGB, TextureData, ImageSize);
 
     GCVulkanUtilities_CreateImageView(Texture2D->Device, Texture2D->ImageHandle, VK_FORMAT_R8G8B8A8_SRGB,
                                       VK_IMAGE_ASPECT_COLOR_BIT, MipLevels, &Texture2D->ImageViewHandle);
@@ -214,12 +195,9 @@ void GCRendererTexture2D_CreateTexture(GCRendererTexture2D* const Texture2D, con
 
 void GCRendererTexture2D_DestroyObjects(GCRendererTexture2D* const Texture2D)
 {
-    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(Texture2D->Device);
-
-    vkDestroySampler(DeviceHandle, Texture2D->ImageSamplerHandle, NULL);
-
-    vkDestroyImageView(DeviceHandle, Texture2D->ImageViewHandle, NULL);
+    GCVulkanDeletionQueue* const DeletionQueue = GCRendererDevice_GetDeletionQueue(Texture2D->Device);
 
-    vkFreeMemory(DeviceHandle, Texture2D->ImageMemoryHandle, NULL);
-    vkDestroyImage(DeviceHandle, Texture2D->ImageHandle, NULL);
+    GCVulkanDeletionQueue_EnqueueSampler(DeletionQueue, Texture2D->ImageSamplerHandle);
+    GCVulkanDeletionQueue_EnqueueImageView(DeletionQueue, Texture2D->ImageViewHandle);
+    GCVulkanDeletionQueue_EnqueueImage(DeletionQueue, Texture2D->ImageHandle, &Texture2D->ImageMemory);
 }
\ No newline at end of file
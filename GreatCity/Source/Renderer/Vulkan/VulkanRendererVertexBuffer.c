@@ -21,7 +21,10 @@
 #include "Core/Memory/Allocator.h"
 #include "Renderer/RendererVertexBuffer.h"
 #include "Renderer/Vulkan/VulkanRendererCommandList.h"
+#include "Renderer/Vulkan/VulkanDeletionQueue.h"
+#include "Renderer/Vulkan/VulkanMemoryAllocator.h"
 #include "Renderer/Vulkan/VulkanRendererDevice.h"
+#include "Renderer/Vulkan/VulkanUploadQueue.h"
 #include "Renderer/Vulkan/VulkanUtilities.h"
 
 #include <stdbool.h>
@@ -36,7 +39,7 @@ typedef struct GCRendererVertexBuffer
     const GCRendererCommandList* CommandList;
 
     VkBuffer VertexBufferHandle;
-    VkDeviceMemory VertexBufferMemoryHandle;
+    GCVulkanMemoryAllocation VertexBufferMemory;
 
     void* Vertices;
     void* DynamicVertices;
@@ -54,7 +57,7 @@ GCRendererVertexBuffer* GCRendererVertexBuffer_Create(const GCRendererVertexBuff
     VertexBuffer->Device = Description->Device;
     VertexBuffer->CommandList = Description->CommandList;
     VertexBuffer->VertexBufferHandle = VK_NULL_HANDLE;
-    VertexBuffer->VertexBufferMemoryHandle = VK_NULL_HANDLE;
+    VertexBuffer->VertexBufferMemory = (GCVulkanMemoryAllocation){0};
     VertexBuffer->Vertices = NULL;
     VertexBuffer->VertexCount = Description->VertexCount;
     VertexBuffer->VertexSize = Description->VertexSize;
@@ -73,13 +76,17 @@ GCRendererVertexBuffer* GCRendererVertexBuffer_CreateDynamic(const GCRendererVer
     VertexBuffer->Device = Description->Device;
     VertexBuffer->CommandList = Description->CommandList;
     VertexBuffer->VertexBufferHandle = VK_NULL_HANDLE;
-    VertexBuffer->VertexBufferMemoryHandle = VK_NULL_HANDLE;
+    VertexBuffer->VertexBufferMemory = (GCVulkanMemoryAllocation){0};
     VertexBuffer->Vertices = Description->Vertices;
     VertexBuffer->VertexCount = Description->VertexCount;
     VertexBuffer->VertexSize = Description->VertexSize;
 
-    VertexBuffer->Vertices = (void*)GCMemory_Allocate(VertexBuffer->VertexSize);
-    memcpy(VertexBuffer->Vertices, Description->Vertices, VertexBuffer->VertexSize);
+    VertexBuffer->Vertices = (void*)GCMemory_AllocateZero(VertexBuffer->VertexSize);
+
+    if (Description->Vertices)
+    {
+        memcpy(VertexBuffer->Vertices, Description->Vertices, VertexBuffer->VertexSize);
+    }
 
     GCRendererVertexBuffer_CreateVertexBufferDynamic(VertexBuffer);
     GCRendererVertexBuffer_SetVertices(VertexBuffer, VertexBuffer->Vertices, VertexBuffer->VertexSize);
@@ -118,51 +125,27 @@ VkBuffer GCRendererVertexBuffer_GetHandle(const GCRendererVertexBuffer* const Ve
 
 void GCRendererVertexBuffer_CreateVertexBuffer(GCRendererVertexBuffer* const VertexBuffer)
 {
-    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(VertexBuffer->Device);
-
-    VkBuffer StagingVertexBufferHandle = VK_NULL_HANDLE;
-    VkDeviceMemory StagingVertexBufferMemoryHandle = VK_NULL_HANDLE;
-
-    GCVulkanUtilities_CreateBuffer(VertexBuffer->Device, VertexBuffer->VertexSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                                   VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                                   &StagingVertexBufferHandle, &StagingVertexBufferMemoryHandle);
-
-    void* VertexData = NULL;
-    vkMapMemory(DeviceHandle, StagingVertexBufferMemoryHandle, 0, VertexBuffer->VertexSize, 0, &VertexData);
-    memcpy(VertexData, VertexBuffer->Vertices, VertexBuffer->VertexSize);
-    vkUnmapMemory(DeviceHandle, StagingVertexBufferMemoryHandle);
-
     GCVulkanUtilities_CreateBuffer(VertexBuffer->Device, VertexBuffer->VertexSize,
                                    VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
                                    VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &VertexBuffer->VertexBufferHandle,
-                                   &VertexBuffer->VertexBufferMemoryHandle);
-
-    const VkCommandBuffer CommandBufferHandle =
-        GCRendererCommandList_BeginSingleTimeCommands(VertexBuffer->CommandList);
-    GCVulkanUtilities_CopyBuffer(CommandBufferHandle, StagingVertexBufferHandle, VertexBuffer->VertexBufferHandle,
-                                 VertexBuffer->VertexSize);
-    GCRendererCommandList_EndSingleTimeCommands(VertexBuffer->CommandList, CommandBufferHandle);
+                                   &VertexBuffer->VertexBufferMemory);
 
-    vkFreeMemory(DeviceHandle, StagingVertexBufferMemoryHandle, NULL);
-    vkDestroyBuffer(DeviceHandle, StagingVertexBufferHandle, NULL);
+    GCVulkanUploadQueue_UploadBuffer(GCRendererCommandList_GetUploadQueue(VertexBuffer->CommandList),
+                                     VertexBuffer->VertexBufferHandle, 0, VertexBuffer->Vertices,
+                                     VertexBuffer->VertexSize);
 }
 
 void GCRendererVertexBuffer_CreateVertexBufferDynamic(GCRendererVertexBuffer* const VertexBuffer)
 {
-    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(VertexBuffer->Device);
-
     GCVulkanUtilities_CreateBuffer(VertexBuffer->Device, VertexBuffer->VertexSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
                                    VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                                   &VertexBuffer->VertexBufferHandle, &VertexBuffer->VertexBufferMemoryHandle);
+                                   &VertexBuffer->VertexBufferHandle, &VertexBuffer->VertexBufferMemory);
 
-    vkMapMemory(DeviceHandle, VertexBuffer->VertexBufferMemoryHandle, 0, VertexBuffer->VertexSize, 0,
-                &VertexBuffer->DynamicVertices);
+    VertexBuffer->DynamicVertices = VertexBuffer->VertexBufferMemory.MappedData;
 }
 
 void GCRendererVertexBuffer_DestroyObjects(GCRendererVertexBuffer* const VertexBuffer)
 {
-    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(VertexBuffer->Device);
-
-    vkFreeMemory(DeviceHandle, VertexBuffer->VertexBufferMemoryHandle, NULL);
-    vkDestroyBuffer(DeviceHandle, VertexBuffer->VertexBufferHandle, NULL);
+    GCVulkanDeletionQueue_EnqueueBuffer(GCRendererDevice_GetDeletionQueue(VertexBuffer->Device),
+                                        VertexBuffer->VertexBufferHandle, &VertexBuffer->VertexBufferMemory);
 }
\ No newline at end of file
@@ -0,0 +1,599 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Renderer/Vulkan/VulkanUploadQueue.h"
+#include "Core/Assert.h"
+#include "Core/Log.h"
+#include "Core/Memory/Allocator.h"
+#include "Renderer/Vulkan/VulkanMemoryAllocator.h"
+#include "Renderer/Vulkan/VulkanRendererDevice.h"
+#include "Renderer/Vulkan/VulkanUtilities.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <vulkan/vulkan.h>
+
+#define GC_VULKAN_UPLOAD_QUEUE_STAGING_SIZE (32ull * 1024 * 1024)
+#define GC_VULKAN_UPLOAD_QUEUE_STAGING_ALIGNMENT 16
+
+typedef struct GCVulkanUploadBatch
+{
+    VkCommandBuffer TransferCommandBufferHandle;
+    VkCommandBuffer GraphicsCommandBufferHandle;
+    VkSemaphore TransferFinishedSemaphoreHandle;
+    VkFence FenceHandle;
+
+    VkBuffer* OverflowBufferHandles;
+    GCVulkanMemoryAllocation* OverflowBufferMemories;
+    uint32_t OverflowBufferCount;
+
+    VkDeviceSize StagingEnd;
+    bool HasGraphicsCommands;
+} GCVulkanUploadBatch;
+
+typedef struct GCVulkanUploadQueue
+{
+    const GCRendererDevice* Device;
+
+    VkQueue GraphicsQueueHandle, TransferQueueHandle;
+    uint32_t GraphicsFamilyQueueIndex, TransferFamilyQueueIndex;
+    bool IsTransferQueueDedicated;
+
+    VkCommandPool GraphicsCommandPoolHandle, TransferCommandPoolHandle;
+
+    VkBuffer StagingBufferHandle;
+    GCVulkanMemoryAllocation StagingBufferMemory;
+    uint8_t* StagingData;
+    VkDeviceSize StagingHead, StagingTail;
+
+    GCVulkanUploadBatch* Batches;
+    uint32_t BatchCount;
+    uint32_t OldestBatch, SubmittedBatchCount;
+    bool IsRecording;
+} GCVulkanUploadQueue;
+
+static void GCVulkanUploadQueue_CreateCommandPools(GCVulkanUploadQueue* const UploadQueue);
+static void GCVulkanUploadQueue_CreateBatches(GCVulkanUploadQueue* const UploadQueue);
+static void GCVulkanUploadQueue_CreateStagingBuffer(GCVulkanUploadQueue* const UploadQueue);
+static uint8_t* GCVulkanUploadQueue_AllocateStaging(GCVulkanUploadQueue* const UploadQueue, const VkDeviceSize Size,
+                                                    VkBuffer* const BufferHandle, VkDeviceSize* const Offset);
+static GCVulkanUploadBatch* GCVulkanUploadQueue_BeginBatch(GCVulkanUploadQueue* const UploadQueue);
+static VkCommandBuffer GCVulkanUploadQueue_GetGraphicsCommandBuffer(GCVulkanUploadQueue* const UploadQueue,
+                                                                    GCVulkanUploadBatch* const Batch);
+static void GCVulkanUploadQueue_RetireBatches(GCVulkanUploadQueue* const UploadQueue, const bool ShouldWait);
+static void GCVulkanUploadQueue_DestroyObjects(GCVulkanUploadQueue* const UploadQueue);
+
+GCVulkanUploadQueue* GCVulkanUploadQueue_Create(const GCRendererDevice* const Device, const uint32_t BatchCount)
+{
+    GCVulkanUploadQueue* UploadQueue = (GCVulkanUploadQueue*)GCMemory_Allocate(sizeof(GCVulkanUploadQueue));
+    UploadQueue->Device = Device;
+    UploadQueue->GraphicsQueueHandle = GCRendererDevice_GetGraphicsQueueHandle(Device);
+    UploadQueue->TransferQueueHandle = GCRendererDevice_GetTransferQueueHandle(Device);
+    UploadQueue->GraphicsFamilyQueueIndex = GCRendererDevice_GetGraphicsFamilyQueueIndex(Device);
+    UploadQueue->TransferFamilyQueueIndex = GCRendererDevice_GetTransferFamilyQueueIndex(Device);
+    UploadQueue->IsTransferQueueDedicated =
+        UploadQueue->TransferFamilyQueueIndex != UploadQueue->GraphicsFamilyQueueIndex;
+    UploadQueue->GraphicsCommandPoolHandle = VK_NULL_HANDLE;
+    UploadQueue->TransferCommandPoolHandle = VK_NULL_HANDLE;
+    UploadQueue->StagingBufferHandle = VK_NULL_HANDLE;
+    UploadQueue->StagingBufferMemory = (GCVulkanMemoryAllocation){0};
+    UploadQueue->StagingData = NULL;
+    UploadQueue->StagingHead = 0;
+    UploadQueue->StagingTail = 0;
+    UploadQueue->Batches = NULL;
+    UploadQueue->BatchCount = BatchCount;
+    UploadQueue->OldestBatch = 0;
+    UploadQueue->SubmittedBatchCount = 0;
+    UploadQueue->IsRecording = false;
+
+    GCVulkanUploadQueue_CreateCommandPools(UploadQueue);
+    GCVulkanUploadQueue_CreateBatches(UploadQueue);
+    GCVulkanUploadQueue_CreateStagingBuffer(UploadQueue);
+
+    if (UploadQueue->IsTransferQueueDedicated)
+    {
+        GC_LOG_INFORMATION("Using a dedicated transfer queue family %u for uploads",
+                           UploadQueue->TransferFamilyQueueIndex);
+    }
+
+    return UploadQueue;
+}
+
+void GCVulkanUploadQueue_UploadBuffer(GCVulkanUploadQueue* const UploadQueue, const VkBuffer BufferHandle,
+                                      const VkDeviceSize Offset, const void* const Data, const VkDeviceSize Size)
+{
+    if (!Size)
+    {
+        return;
+    }
+
+    VkBuffer StagingBufferHandle = VK_NULL_HANDLE;
+    VkDeviceSize StagingOffset = 0;
+
+    uint8_t* const StagingData =
+        GCVulkanUploadQueue_AllocateStaging(UploadQueue, Size, &StagingBufferHandle, &StagingOffset);
+    memcpy(StagingData, Data, Size);
+
+    const GCVulkanUploadBatch* const Batch = GCVulkanUploadQueue_BeginBatch(UploadQueue);
+
+    GCVulkanUtilities_CopyBufferRegion(Batch->TransferCommandBufferHandle, StagingBufferHandle, StagingOffset,
+                                       BufferHandle, Offset, Size);
+}
+
+void GCVulkanUploadQueue_CopyBuffer(GCVulkanUploadQueue* const UploadQueue, const VkBuffer SourceBufferHandle,
+                                    const VkBuffer DestinationBufferHandle, const VkDeviceSize Size)
+{
+    const GCVulkanUploadBatch* const Batch = GCVulkanUploadQueue_BeginBatch(UploadQueue);
+
+    VkMemoryBarrier MemoryBarrier = {0};
+    MemoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    MemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    MemoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+
+    vkCmdPipelineBarrier(Batch->TransferCommandBufferHandle, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &MemoryBarrier, 0, NULL, 0, NULL);
+
+    GCVulkanUtilities_CopyBuffer(Batch->TransferCommandBufferHandle, SourceBufferHandle, DestinationBufferHandle,
+                                 Size);
+
+    vkCmdPipelineBarrier(Batch->TransferCommandBufferHandle, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &MemoryBarrier, 0, NULL, 0, NULL);
+}
+
+void GCVulkanUploadQueue_UploadTexture2D(GCVulkanUploadQueue* const UploadQueue, const VkImage ImageHandle,
+                                         const uint32_t Width, const uint32_t Height, const uint32_t MipLevels,
+                                         const VkFormat Format, const void* const Data, const VkDeviceSize Size)
+{
+    VkBuffer StagingBufferHandle = VK_NULL_HANDLE;
+    VkDeviceSize StagingOffset = 0;
+
+    uint8_t* const StagingData =
+        GCVulkanUploadQueue_AllocateStaging(UploadQueue, Size, &StagingBufferHandle, &StagingOffset);
+    memcpy(StagingData, Data, Size);
+
+    GCVulkanUploadBatch* const Batch = GCVulkanUploadQueue_BeginBatch(UploadQueue);
+
+    GCVulkanUtilities_TransitionImageLayout(Batch->TransferCommandBufferHandle, ImageHandle, MipLevels,
+                                            VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    GCVulkanUtilities_CopyBufferToImage(Batch->TransferCommandBufferHandle, StagingBufferHandle, StagingOffset,
+                                        ImageHandle, Width, Height);
+
+    const VkCommandBuffer GraphicsCommandBufferHandle =
+        GCVulkanUploadQueue_GetGraphicsCommandBuffer(UploadQueue, Batch);
+
+    if (UploadQueue->IsTransferQueueDedicated)
+    {
+        VkImageMemoryBarrier ImageMemoryBarrier = {0};
+        ImageMemoryBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        ImageMemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        ImageMemoryBarrier.dstAccessMask = 0;
+        ImageMemoryBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        ImageMemoryBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        ImageMemoryBarrier.srcQueueFamilyIndex = UploadQueue->TransferFamilyQueueIndex;
+        ImageMemoryBarrier.dstQueueFamilyIndex = UploadQueue->GraphicsFamilyQueueIndex;
+        ImageMemoryBarrier.image = ImageHandle;
+        ImageMemoryBarrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        ImageMemoryBarrier.subresourceRange.baseMipLevel = 0;
+        ImageMemoryBarrier.subresourceRange.levelCount = MipLevels;
+        ImageMemoryBarrier.subresourceRange.baseArrayLayer = 0;
+        ImageMemoryBarrier.subresourceRange.layerCount = 1;
+
+        vkCmdPipelineBarrier(Batch->TransferCommandBufferHandle, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, NULL, 0, NULL, 1, &ImageMemoryBarrier);
+
+        ImageMemoryBarrier.srcAccessMask = 0;
+        ImageMemoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+
+        vkCmdPipelineBarrier(GraphicsCommandBufferHandle, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, NULL, 0, NULL, 1, &ImageMemoryBarrier);
+    }
+
+    GCVulkanUtilities_GenerateMipmap(UploadQueue->Device, GraphicsCommandBufferHandle, ImageHandle, Width, Height,
+                                     MipLevels, Format);
+}
+
+bool GCVulkanUploadQueue_Submit(GCVulkanUploadQueue* const UploadQueue, const VkSemaphore SignalSemaphoreHandle)
+{
+    if (!UploadQueue->IsRecording)
+    {
+        GCVulkanUploadQueue_RetireBatches(UploadQueue, false);
+
+        return false;
+    }
+
+    GCVulkanUploadBatch* const Batch =
+        &UploadQueue->Batches[(UploadQueue->OldestBatch + UploadQueue->SubmittedBatchCount) % UploadQueue->BatchCount];
+
+    VkSubmitInfo SubmitInformation = {0};
+    SubmitInformation.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+
+    bool IsSemaphoreSignaled = false;
+
+    if (UploadQueue->IsTransferQueueDedicated)
+    {
+        GC_VULKAN_VALIDATE(vkEndCommandBuffer(Batch->TransferCommandBufferHandle),
+                           "Failed to end a Vulkan upload command buffer");
+
+        SubmitInformation.commandBufferCount = 1;
+        SubmitInformation.pCommandBuffers = &Batch->TransferCommandBufferHandle;
+
+        if (Batch->HasGraphicsCommands)
+        {
+            SubmitInformation.signalSemaphoreCount = 1;
+            SubmitInformation.pSignalSemaphores = &Batch->TransferFinishedSemaphoreHandle;
+
+            GC_VULKAN_VALIDATE(
+                vkQueueSubmit(UploadQueue->TransferQueueHandle, 1, &SubmitInformation, VK_NULL_HANDLE),
+                "Failed to submit a Vulkan transfer queue");
+
+            VkMemoryBarrier MemoryBarrier = {0};
+            MemoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            MemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            MemoryBarrier.dstAccessMask =
+                VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+
+            vkCmdPipelineBarrier(Batch->GraphicsCommandBufferHandle, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                 VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1,
+                                 &MemoryBarrier, 0, NULL, 0, NULL);
+
+            GC_VULKAN_VALIDATE(vkEndCommandBuffer(Batch->GraphicsCommandBufferHandle),
+                               "Failed to end a Vulkan upload command buffer");
+
+            const VkPipelineStageFlags PipelineWaitStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+
+            SubmitInformation = (VkSubmitInfo){0};
+            SubmitInformation.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            SubmitInformation.waitSemaphoreCount = 1;
+            SubmitInformation.pWaitSemaphores = &Batch->TransferFinishedSemaphoreHandle;
+            SubmitInformation.pWaitDstStageMask = &PipelineWaitStage;
+            SubmitInformation.commandBufferCount = 1;
+            SubmitInformation.pCommandBuffers = &Batch->GraphicsCommandBufferHandle;
+
+            GC_VULKAN_VALIDATE(
+                vkQueueSubmit(UploadQueue->GraphicsQueueHandle, 1, &SubmitInformation, Batch->FenceHandle),
+                "Failed to submit a Vulkan queue");
+        }
+        else
+        {
+            if (SignalSemaphoreHandle != VK_NULL_HANDLE)
+            {
+                SubmitInformation.signalSemaphoreCount = 1;
+                SubmitInformation.pSignalSemaphores = &SignalSemaphoreHandle;
+
+                IsSemaphoreSignaled = true;
+            }
+
+            GC_VULKAN_VALIDATE(
+                vkQueueSubmit(UploadQueue->TransferQueueHandle, 1, &SubmitInformation, Batch->FenceHandle),
+                "Failed to submit a Vulkan transfer queue");
+        }
+    }
+    else
+    {
+        VkMemoryBarrier MemoryBarrier = {0};
+        MemoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        MemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        MemoryBarrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+
+        vkCmdPipelineBarrier(Batch->TransferCommandBufferHandle, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &MemoryBarrier, 0, NULL, 0, NULL);
+
+        GC_VULKAN_VALIDATE(vkEndCommandBuffer(Batch->TransferCommandBufferHandle),
+                           "Failed to end a Vulkan upload command buffer");
+
+        SubmitInformation.commandBufferCount = 1;
+        SubmitInformation.pCommandBuffers = &Batch->TransferCommandBufferHandle;
+
+        GC_VULKAN_VALIDATE(
+            vkQueueSubmit(UploadQueue->GraphicsQueueHandle, 1, &SubmitInformation, Batch->FenceHandle),
+            "Failed to submit a Vulkan queue");
+    }
+
+    Batch->StagingEnd = UploadQueue->StagingHead;
+
+    UploadQueue->SubmittedBatchCount++;
+    UploadQueue->IsRecording = false;
+
+    GCVulkanUploadQueue_RetireBatches(UploadQueue, false);
+
+    return IsSemaphoreSignaled;
+}
+
+void GCVulkanUploadQueue_Destroy(GCVulkanUploadQueue* UploadQueue)
+{
+    while (UploadQueue->SubmittedBatchCount)
+    {
+        GCVulkanUploadQueue_RetireBatches(UploadQueue, true);
+    }
+
+    GCVulkanUploadQueue_DestroyObjects(UploadQueue);
+
+    GCMemory_Free(UploadQueue->Batches);
+    GCMemory_Free(UploadQueue);
+}
+
+void GCVulkanUploadQueue_CreateCommandPools(GCVulkanUploadQueue* const UploadQueue)
+{
+    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(UploadQueue->Device);
+
+    VkCommandPoolCreateInfo CommandPoolInformation = {0};
+    CommandPoolInformation.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    CommandPoolInformation.flags =
+        VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    CommandPoolInformation.queueFamilyIndex = UploadQueue->TransferFamilyQueueIndex;
+
+    GC_VULKAN_VALIDATE(
+        vkCreateCommandPool(DeviceHandle, &CommandPoolInformation, NULL, &UploadQueue->TransferCommandPoolHandle),
+        "Failed to create a Vulkan upload command pool");
+
+    if (UploadQueue->IsTransferQueueDedicated)
+    {
+        CommandPoolInformation.queueFamilyIndex = UploadQueue->GraphicsFamilyQueueIndex;
+
+        GC_VULKAN_VALIDATE(
+            vkCreateCommandPool(DeviceHandle, &CommandPoolInformation, NULL, &UploadQueue->GraphicsCommandPoolHandle),
+            "Failed to create a Vulkan upload command pool");
+    }
+}
+
+void GCVulkanUploadQueue_CreateBatches(GCVulkanUploadQueue* const UploadQueue)
+{
+    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(UploadQueue->Device);
+
+    UploadQueue->Batches =
+        (GCVulkanUploadBatch*)GCMemory_AllocateZero(UploadQueue->BatchCount * sizeof(GCVulkanUploadBatch));
+
+    VkCommandBufferAllocateInfo CommandBufferAllocateInformation = {0};
+    CommandBufferAllocateInformation.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    CommandBufferAllocateInformation.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    CommandBufferAllocateInformation.commandBufferCount = 1;
+
+    VkSemaphoreCreateInfo SemaphoreInformation = {0};
+    SemaphoreInformation.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+
+    VkFenceCreateInfo FenceInformation = {0};
+    FenceInformation.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+    for (uint32_t Counter = 0; Counter < UploadQueue->BatchCount; Counter++)
+    {
+        GCVulkanUploadBatch* const Batch = &UploadQueue->Batches[Counter];
+
+        CommandBufferAllocateInformation.commandPool = UploadQueue->TransferCommandPoolHandle;
+
+        GC_VULKAN_VALIDATE(vkAllocateCommandBuffers(DeviceHandle, &CommandBufferAllocateInformation,
+                                                    &Batch->TransferCommandBufferHandle),
+                           "Failed to allocate a Vulkan upload command buffer");
+
+        if (UploadQueue->IsTransferQueueDedicated)
+        {
+            CommandBufferAllocateInformation.commandPool = UploadQueue->GraphicsCommandPoolHandle;
+
+            GC_VULKAN_VALIDATE(vkAllocateCommandBuffers(DeviceHandle, &CommandBufferAllocateInformation,
+                                                        &Batch->GraphicsCommandBufferHandle),
+                               "Failed to allocate a Vulkan upload command buffer");
+            GC_VULKAN_VALIDATE(vkCreateSemaphore(DeviceHandle, &SemaphoreInformation, NULL,
+                                                 &Batch->TransferFinishedSemaphoreHandle),
+                               "Failed to create a Vulkan semaphore");
+        }
+
+        GC_VULKAN_VALIDATE(vkCreateFence(DeviceHandle, &FenceInformation, NULL, &Batch->FenceHandle),
+                           "Failed to create a Vulkan fence");
+    }
+}
+
+void GCVulkanUploadQueue_CreateStagingBuffer(GCVulkanUploadQueue* const UploadQueue)
+{
+    GCVulkanUtilities_CreateDedicatedBuffer(UploadQueue->Device, GC_VULKAN_UPLOAD_QUEUE_STAGING_SIZE,
+                                            VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                                            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                            &UploadQueue->StagingBufferHandle, &UploadQueue->StagingBufferMemory);
+
+    UploadQueue->StagingData = (uint8_t*)UploadQueue->StagingBufferMemory.MappedData;
+}
+
+uint8_t* GCVulkanUploadQueue_AllocateStaging(GCVulkanUploadQueue* const UploadQueue, const VkDeviceSize Size,
+                                             VkBuffer* const BufferHandle, VkDeviceSize* const Offset)
+{
+    const VkDeviceSize StagingSize = GC_VULKAN_UPLOAD_QUEUE_STAGING_SIZE;
+
+    if (Size > StagingSize)
+    {
+        GCVulkanUploadBatch* const Batch = GCVulkanUploadQueue_BeginBatch(UploadQueue);
+
+        Batch->OverflowBufferHandles = (VkBuffer*)GCMemory_Reallocate(
+            Batch->OverflowBufferHandles, (Batch->OverflowBufferCount + 1) * sizeof(VkBuffer));
+        Batch->OverflowBufferMemories = (GCVulkanMemoryAllocation*)GCMemory_Reallocate(
+            Batch->OverflowBufferMemories, (Batch->OverflowBufferCount + 1) * sizeof(GCVulkanMemoryAllocation));
+
+        VkBuffer* const OverflowBufferHandle = &Batch->OverflowBufferHandles[Batch->OverflowBufferCount];
+        GCVulkanMemoryAllocation* const OverflowBufferMemory =
+            &Batch->OverflowBufferMemories[Batch->OverflowBufferCount];
+        Batch->OverflowBufferCount++;
+
+        GCVulkanUtilities_CreateBuffer(UploadQueue->Device, Size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                                       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                       OverflowBufferHandle, OverflowBufferMemory);
+
+        *BufferHandle = *OverflowBufferHandle;
+        *Offset = 0;
+
+        return (uint8_t*)OverflowBufferMemory->MappedData;
+    }
+
+    VkDeviceSize StagingOffset = 0;
+
+    while (true)
+    {
+        if (!UploadQueue->SubmittedBatchCount && UploadQueue->StagingHead == UploadQueue->StagingTail)
+        {
+            UploadQueue->StagingHead = 0;
+            UploadQueue->StagingTail = 0;
+        }
+
+        StagingOffset = (UploadQueue->StagingHead + GC_VULKAN_UPLOAD_QUEUE_STAGING_ALIGNMENT - 1) &
+                        ~(VkDeviceSize)(GC_VULKAN_UPLOAD_QUEUE_STAGING_ALIGNMENT - 1);
+
+        if (StagingOffset % StagingSize + Size > StagingSize)
+        {
+            StagingOffset = (StagingOffset / StagingSize + 1) * StagingSize;
+        }
+
+        if (StagingOffset + Size - UploadQueue->StagingTail <= StagingSize)
+        {
+            break;
+        }
+
+        if (!UploadQueue->SubmittedBatchCount)
+        {
+            GCVulkanUploadQueue_Submit(UploadQueue, VK_NULL_HANDLE);
+        }
+
+        GCVulkanUploadQueue_RetireBatches(UploadQueue, true);
+    }
+
+    UploadQueue->StagingHead = StagingOffset + Size;
+
+    *BufferHandle = UploadQueue->StagingBufferHandle;
+    *Offset = StagingOffset % StagingSize;
+
+    return UploadQueue->StagingData + *Offset;
+}
+
+GCVulkanUploadBatch* GCVulkanUploadQueue_BeginBatch(GCVulkanUploadQueue* const UploadQueue)
+{
+    if (!UploadQueue->IsRecording)
+    {
+        if (UploadQueue->SubmittedBatchCount == UploadQueue->BatchCount)
+        {
+            GCVulkanUploadQueue_RetireBatches(UploadQueue, true);
+        }
+
+        GCVulkanUploadBatch* const Batch =
+            &UploadQueue->Batches[(UploadQueue->OldestBatch + UploadQueue->SubmittedBatchCount) %
+                                  UploadQueue->BatchCount];
+
+        VkCommandBufferBeginInfo CommandBufferBeginInformation = {0};
+        CommandBufferBeginInformation.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        CommandBufferBeginInformation.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        GC_VULKAN_VALIDATE(vkBeginCommandBuffer(Batch->TransferCommandBufferHandle, &CommandBufferBeginInformation),
+                           "Failed to begin a Vulkan upload command buffer");
+
+        Batch->HasGraphicsCommands = false;
+
+        UploadQueue->IsRecording = true;
+    }
+
+    return &UploadQueue->Batches[(UploadQueue->OldestBatch + UploadQueue->SubmittedBatchCount) %
+                                 UploadQueue->BatchCount];
+}
+
+VkCommandBuffer GCVulkanUploadQueue_GetGraphicsCommandBuffer(GCVulkanUploadQueue* const UploadQueue,
+                                                             GCVulkanUploadBatch* const Batch)
+{
+    if (!UploadQueue->IsTransferQueueDedicated)
+    {
+        return Batch->TransferCommandBufferHandle;
+    }
+
+    if (!Batch->HasGraphicsCommands)
+    {
+        VkCommandBufferBeginInfo CommandBufferBeginInformation = {0};
+        CommandBufferBeginInformation.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        CommandBufferBeginInformation.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        GC_VULKAN_VALIDATE(vkBeginCommandBuffer(Batch->GraphicsCommandBufferHandle, &CommandBufferBeginInformation),
+                           "Failed to begin a Vulkan upload command buffer");
+
+        Batch->HasGraphicsCommands = true;
+    }
+
+    return Batch->GraphicsCommandBufferHandle;
+}
+
+void GCVulkanUploadQueue_RetireBatches(GCVulkanUploadQueue* const UploadQueue, const bool ShouldWait)
+{
+    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(UploadQueue->Device);
+
+    bool ShouldWaitBatch = ShouldWait;
+
+    while (UploadQueue->SubmittedBatchCount)
+    {
+        GCVulkanUploadBatch* const Batch = &UploadQueue->Batches[UploadQueue->OldestBatch];
+
+        if (ShouldWaitBatch)
+        {
+            vkWaitForFences(DeviceHandle, 1, &Batch->FenceHandle, VK_TRUE, UINT64_MAX);
+
+            ShouldWaitBatch = false;
+        }
+        else if (vkGetFenceStatus(DeviceHandle, Batch->FenceHandle) != VK_SUCCESS)
+        {
+            break;
+        }
+
+        vkResetFences(DeviceHandle, 1, &Batch->FenceHandle);
+        vkResetCommandBuffer(Batch->TransferCommandBufferHandle, 0);
+
+        if (UploadQueue->IsTransferQueueDedicated)
+        {
+            vkResetCommandBuffer(Batch->GraphicsCommandBufferHandle, 0);
+        }
+
+        for (uint32_t Counter = 0; Counter < Batch->OverflowBufferCount; Counter++)
+        {
+            GCVulkanUtilities_DestroyBuffer(UploadQueue->Device, Batch->OverflowBufferHandles[Counter],
+                                            &Batch->OverflowBufferMemories[Counter]);
+        }
+
+        Batch->OverflowBufferCount = 0;
+
+        UploadQueue->StagingTail = Batch->StagingEnd;
+        UploadQueue->OldestBatch = (UploadQueue->OldestBatch + 1) % UploadQueue->BatchCount;
+        UploadQueue->SubmittedBatchCount--;
+    }
+}
+
+void GCVulkanUploadQueue_DestroyObjects(GCVulkanUploadQueue* const UploadQueue)
+{
+    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(UploadQueue->Device);
+
+    GCVulkanUtilities_DestroyBuffer(UploadQueue->Device, UploadQueue->StagingBufferHandle,
+                                    &UploadQueue->StagingBufferMemory);
+
+    for (uint32_t Counter = 0; Counter < UploadQueue->BatchCount; Counter++)
+    {
+        GCVulkanUploadBatch* const Batch = &UploadQueue->Batches[Counter];
+
+        for (uint32_t OverflowCounter = 0; OverflowCounter < Batch->OverflowBufferCount; OverflowCounter++)
+        {
+            GCVulkanUtilities_DestroyBuffer(UploadQueue->Device, Batch->OverflowBufferHandles[OverflowCounter],
+                                            &Batch->OverflowBufferMemories[OverflowCounter]);
+        }
+
+        GCMemory_Free(Batch->OverflowBufferMemories);
+        GCMemory_Free(Batch->OverflowBufferHandles);
+
+        vkDestroyFence(DeviceHandle, Batch->FenceHandle, NULL);
+        vkDestroySemaphore(DeviceHandle, Batch->TransferFinishedSemaphoreHandle, NULL);
+    }
+
+    vkDestroyCommandPool(DeviceHandle, UploadQueue->GraphicsCommandPoolHandle, NULL);
+    vkDestroyCommandPool(DeviceHandle, UploadQueue->TransferCommandPoolHandle, NULL);
+}
@@ -0,0 +1,49 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GC_RENDERER_VULKAN_VULKAN_UPLOAD_QUEUE_H
+#define GC_RENDERER_VULKAN_VULKAN_UPLOAD_QUEUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <vulkan/vulkan.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct GCVulkanUploadQueue GCVulkanUploadQueue;
+    typedef struct GCRendererDevice GCRendererDevice;
+
+    GCVulkanUploadQueue* GCVulkanUploadQueue_Create(const GCRendererDevice* const Device, const uint32_t BatchCount);
+    void GCVulkanUploadQueue_UploadBuffer(GCVulkanUploadQueue* const UploadQueue, const VkBuffer BufferHandle,
+                                          const VkDeviceSize Offset, const void* const Data, const VkDeviceSize Size);
+    void GCVulkanUploadQueue_CopyBuffer(GCVulkanUploadQueue* const UploadQueue, const VkBuffer SourceBufferHandle,
+                                        const VkBuffer DestinationBufferHandle, const VkDeviceSize Size);
+    void GCVulkanUploadQueue_UploadTexture2D(GCVulkanUploadQueue* const UploadQueue, const VkImage ImageHandle,
+                                             const uint32_t Width, const uint32_t Height, const uint32_t MipLevels,
+                                             const VkFormat Format, const void* const Data, const VkDeviceSize Size);
+    bool GCVulkanUploadQueue_Submit(GCVulkanUploadQueue* const UploadQueue, const VkSemaphore SignalSemaphoreHandle);
+    void GCVulkanUploadQueue_Destroy(GCVulkanUploadQueue* UploadQueue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -21,6 +21,7 @@
 #include "Renderer/RendererDevice.h"
 #include "Renderer/RendererEnums.h"
 #include "Renderer/Vulkan/VulkanRendererCommandList.h"
+#include "Renderer/Vulkan/VulkanMemoryAllocator.h"
 #include "Renderer/Vulkan/VulkanRendererDevice.h"
 
 #include <stdbool.h>
@@ -28,40 +29,30 @@
 
 #include <vulkan/vulkan.h>
 
+static void GCVulkanUtilities_CreateBufferWithMemory(const GCRendererDevice* const Device, const size_t Size,
+                                                     const VkBufferUsageFlags Usage,
+                                                     const VkMemoryPropertyFlags MemoryProperty, const bool IsDedicated,
+                                                     VkBuffer* BufferHandle, GCVulkanMemoryAllocation* BufferMemory);
+
 void GCVulkanUtilities_CreateBuffer(const GCRendererDevice* const Device, const size_t Size,
                                     const VkBufferUsageFlags Usage, const VkMemoryPropertyFlags MemoryProperty,
-                                    VkBuffer* BufferHandle, VkDeviceMemory* BufferMemoryHandle)
+                                    VkBuffer* BufferHandle, GCVulkanMemoryAllocation* BufferMemory)
 {
-    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(Device);
-
-    VkBufferCreateInfo BufferInformation = {0};
-    BufferInformation.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-    BufferInformation.size = Size;
-    BufferInformation.usage = Usage;
-    BufferInformation.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-
-    GC_VULKAN_VALIDATE(vkCreateBuffer(DeviceHandle, &BufferInformation, NULL, BufferHandle),
-                       "Failed to create a Vulkan buffer");
-
-    VkMemoryRequirements MemoryRequirements = {0};
-    vkGetBufferMemoryRequirements(DeviceHandle, *BufferHandle, &MemoryRequirements);
-
-    VkMemoryAllocateInfo MemoryAllocateInformation = {0};
-    MemoryAllocateInformation.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    MemoryAllocateInformation.allocationSize = MemoryRequirements.size;
-    MemoryAllocateInformation.memoryTypeIndex =
-        GCRendererDevice_GetMemoryTypeIndex(Device, MemoryRequirements.memoryTypeBits, MemoryProperty);
+    GCVulkanUtilities_CreateBufferWithMemory(Device, Size, Usage, MemoryProperty, false, BufferHandle, BufferMemory);
+}
 
-    GC_VULKAN_VALIDATE(vkAllocateMemory(DeviceHandle, &MemoryAllocateInformation, NULL, BufferMemoryHandle),
-                       "Failed to allocate a Vulkan buffer memory");
-    vkBindBufferMemory(DeviceHandle, *BufferHandle, *BufferMemoryHandle, 0);
+void GCVulkanUtilities_CreateDedicatedBuffer(const GCRendererDevice* const Device, const size_t Size,
+                                             const VkBufferUsageFlags Usage, const VkMemoryPropertyFlags MemoryProperty,
+                                             VkBuffer* BufferHandle, GCVulkanMemoryAllocation* BufferMemory)
+{
+    GCVulkanUtilities_CreateBufferWithMemory(Device, Size, Usage, MemoryProperty, true, BufferHandle, BufferMemory);
 }
 
 void GCVulkanUtilities_CreateImage(const GCRendererDevice* const Device, const uint32_t Width, const uint32_t Height,
                                    const uint32_t MipLevels, const VkFormat Format, const VkImageTiling Tiling,
                                    const VkSampleCountFlagBits SampleCount, const VkImageUsageFlags Usage,
                                    const VkMemoryPropertyFlags MemoryProperty, VkImage* ImageHandle,
-                                   VkDeviceMemory* ImageMemoryHandle)
+                                   GCVulkanMemoryAllocation* ImageMemory)
 {
     const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(Device);
 
@@ -86,15 +77,36 @@ void GCVulkanUtilities_CreateImage(const GCRendererDevice* const Device, const u
     VkMemoryRequirements MemoryRequirements = {0};
     vkGetImageMemoryRequirements(DeviceHandle, *ImageHandle, &MemoryRequirements);
 
-    VkMemoryAllocateInfo MemoryAllocateInformation = {0};
-    MemoryAllocateInformation.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    MemoryAllocateInformation.allocationSize = MemoryRequirements.size;
-    MemoryAllocateInformation.memoryTypeIndex =
-        GCRendererDevice_GetMemoryTypeIndex(Device, MemoryRequirements.memoryTypeBits, MemoryProperty);
+    GCVulkanMemoryAllocationDescription MemoryAllocationDescription = {0};
+    MemoryAllocationDescription.MemoryRequirements = MemoryRequirements;
+    MemoryAllocationDescription.MemoryProperty = MemoryProperty;
+    MemoryAllocationDescription.ResourceType = Tiling == VK_IMAGE_TILING_OPTIMAL ? GCVulkanMemoryResourceType_Optimal
+                                                                                 : GCVulkanMemoryResourceType_Linear;
+    MemoryAllocationDescription.Strategy = GCVulkanMemoryAllocationStrategy_General;
+    MemoryAllocationDescription.IsDedicated =
+        (Usage & (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT)) != 0;
+
+    *ImageMemory =
+        GCVulkanMemoryAllocator_Allocate(GCRendererDevice_GetMemoryAllocator(Device), &MemoryAllocationDescription);
 
-    GC_VULKAN_VALIDATE(vkAllocateMemory(DeviceHandle, &MemoryAllocateInformation, NULL, ImageMemoryHandle),
-                       "Failed to allocate a Vulkan image memory");
-    vkBindImageMemory(DeviceHandle, *ImageHandle, *ImageMemoryHandle, 0);
+    GC_VULKAN_VALIDATE(vkBindImageMemory(DeviceHandle, *ImageHandle, ImageMemory->MemoryHandle, ImageMemory->Offset),
+                       "Failed to bind a Vulkan image memory");
+}
+
+void GCVulkanUtilities_DestroyBuffer(const GCRendererDevice* const Device, const VkBuffer BufferHandle,
+                                     const GCVulkanMemoryAllocation* const BufferMemory)
+{
+    vkDestroyBuffer(GCRendererDevice_GetDeviceHandle(Device), BufferHandle, NULL);
+
+    GCVulkanMemoryAllocator_Free(GCRendererDevice_GetMemoryAllocator(Device), BufferMemory);
+}
+
+void GCVulkanUtilities_DestroyImage(const GCRendererDevice* const Device, const VkImage ImageHandle,
+                                    const GCVulkanMemoryAllocation* const ImageMemory)
+{
+    vkDestroyImage(GCRendererDevice_GetDeviceHandle(Device), ImageHandle, NULL);
+
+    GCVulkanMemoryAllocator_Free(GCRendererDevice_GetMemoryAllocator(Device), ImageMemory);
 }
 
 void GCVulkanUtilities_CreateImageView(const GCRendererDevice* const Device, const VkImage ImageHandle,
@@ -363,10 +375,11 @@ void GCVulkanUtilities_CopyImage(const VkCommandBuffer CommandBufferHandle, cons
 
 void GCVulkanUtilities_CopyImageToBuffer(const VkCommandBuffer CommandBufferHandle, const VkImage SourceImageHandle,
                                          const VkImageLayout SourceImageLayout, const VkBuffer DestinationBufferHandle,
-                                         const uint32_t Width, const uint32_t Height, const int32_t X, const int32_t Y)
+                                         const VkDeviceSize DestinationOffset, const uint32_t Width,
+                                         const uint32_t Height, const int32_t X, const int32_t Y)
 {
     VkBufferImageCopy BufferImageCopyRegion = {0};
-    BufferImageCopyRegion.bufferOffset = 0;
+    BufferImageCopyRegion.bufferOffset = DestinationOffset;
     BufferImageCopyRegion.bufferRowLength = 0;
     BufferImageCopyRegion.bufferImageHeight = 0;
     BufferImageCopyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
@@ -389,12 +402,24 @@ void GCVulkanUtilities_CopyBuffer(const VkCommandBuffer CommandBufferHandle, con
     vkCmdCopyBuffer(CommandBufferHandle, SourceBufferHandle, DestinationBufferHandle, 1, &BufferCopyRegion);
 }
 
+void GCVulkanUtilities_CopyBufferRegion(const VkCommandBuffer CommandBufferHandle, const VkBuffer SourceBufferHandle,
+                                        const VkDeviceSize SourceOffset, const VkBuffer DestinationBufferHandle,
+                                        const VkDeviceSize DestinationOffset, const VkDeviceSize Size)
+{
+    VkBufferCopy BufferCopyRegion = {0};
+    BufferCopyRegion.srcOffset = SourceOffset;
+    BufferCopyRegion.dstOffset = DestinationOffset;
+    BufferCopyRegion.size = Size;
+
+    vkCmdCopyBuffer(CommandBufferHandle, SourceBufferHandle, DestinationBufferHandle, 1, &BufferCopyRegion);
+}
+
 void GCVulkanUtilities_CopyBufferToImage(const VkCommandBuffer CommandBufferHandle, const VkBuffer SourceBufferHandle,
-                                         const VkImage DestinationImageHandle, const uint32_t Width,
-                                         const uint32_t Height)
+                                         const VkDeviceSize SourceOffset, const VkImage DestinationImageHandle,
+                                         const uint32_t Width, const uint32_t Height)
 {
     VkBufferImageCopy BufferImageCopyRegion = {0};
-    BufferImageCopyRegion.bufferOffset = 0;
+    BufferImageCopyRegion.bufferOffset = SourceOffset;
     BufferImageCopyRegion.bufferRowLength = 0;
     BufferImageCopyRegion.bufferImageHeight = 0;
     BufferImageCopyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
@@ -508,3 +533,49 @@ VkSampleCountFlagBits GCVulkanUtilities_ToVkSampleCountFlagBits(const GCRenderer
     GC_ASSERT_WITH_MESSAGE(false, "'%d': Invalid GCRendererAttachmentSampleCount");
     return (VkSampleCountFlagBits)-1;
 }
+
+void GCVulkanUtilities_CreateBufferWithMemory(const GCRendererDevice* const Device, const size_t Size,
+                                              const VkBufferUsageFlags Usage,
+                                              const VkMemoryPropertyFlags MemoryProperty, const bool IsDedicated,
+                                              VkBuffer* BufferHandle, GCVulkanMemoryAllocation* BufferMemory)
+{
+    const VkDevice DeviceHandle = GCRendererDevice_GetDeviceHandle(Device);
+
+    VkBufferCreateInfo BufferInformation = {0};
+    BufferInformation.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    BufferInformation.size = Size;
+    BufferInformation.usage = Usage;
+    BufferInformation.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    const uint32_t QueueFamilyIndices[2] = {GCRendererDevice_GetGraphicsFamilyQueueIndex(Device),
+                                            GCRendererDevice_GetTransferFamilyQueueIndex(Device)};
+
+    if ((Usage & VK_BUFFER_USAGE_TRANSFER_DST_BIT) && QueueFamilyIndices[0] != QueueFamilyIndices[1])
+    {
+        BufferInformation.sharingMode = VK_SHARING_MODE_CONCURRENT;
+        BufferInformation.queueFamilyIndexCount = 2;
+        BufferInformation.pQueueFamilyIndices = QueueFamilyIndices;
+    }
+
+    GC_VULKAN_VALIDATE(vkCreateBuffer(DeviceHandle, &BufferInformation, NULL, BufferHandle),
+                       "Failed to create a Vulkan buffer");
+
+    VkMemoryRequirements MemoryRequirements = {0};
+    vkGetBufferMemoryRequirements(DeviceHandle, *BufferHandle, &MemoryRequirements);
+
+    GCVulkanMemoryAllocationDescription MemoryAllocationDescription = {0};
+    MemoryAllocationDescription.MemoryRequirements = MemoryRequirements;
+    MemoryAllocationDescription.MemoryProperty = MemoryProperty;
+    MemoryAllocationDescription.ResourceType = GCVulkanMemoryResourceType_Linear;
+    MemoryAllocationDescription.Strategy = Usage == VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+                                               ? GCVulkanMemoryAllocationStrategy_Linear
+                                               : GCVulkanMemoryAllocationStrategy_General;
+    MemoryAllocationDescription.IsDedicated = IsDedicated;
+
+    *BufferMemory =
+        GCVulkanMemoryAllocator_Allocate(GCRendererDevice_GetMemoryAllocator(Device), &MemoryAllocationDescription);
+
+    GC_VULKAN_VALIDATE(
+        vkBindBufferMemory(DeviceHandle, *BufferHandle, BufferMemory->MemoryHandle, BufferMemory->Offset),
+        "Failed to bind a Vulkan buffer memory");
+}
@@ -20,6 +20,7 @@
 
 #include "Core/Assert.h"
 #include "Core/Log.h"
+#include "Renderer/RendererEnums.h"
 
 #include <stdbool.h>
 #include <stdint.h>
@@ -48,18 +49,24 @@ extern "C"
 
     typedef struct GCRendererDevice GCRendererDevice;
     typedef struct GCRendererCommandList GCRendererCommandList;
-
-    typedef enum GCRendererAttachmentFormat GCRendererAttachmentFormat;
-    typedef enum GCRendererAttachmentSampleCount GCRendererAttachmentSampleCount;
+    typedef struct GCVulkanMemoryAllocation GCVulkanMemoryAllocation;
 
     void GCVulkanUtilities_CreateBuffer(const GCRendererDevice* const Device, const size_t Size,
                                         const VkBufferUsageFlags Usage, const VkMemoryPropertyFlags MemoryProperty,
-                                        VkBuffer* BufferHandle, VkDeviceMemory* BufferMemoryHandle);
+                                        VkBuffer* BufferHandle, GCVulkanMemoryAllocation* BufferMemory);
+    void GCVulkanUtilities_CreateDedicatedBuffer(const GCRendererDevice* const Device, const size_t Size,
+                                                 const VkBufferUsageFlags Usage,
+                                                 const VkMemoryPropertyFlags MemoryProperty, VkBuffer* BufferHandle,
+                                                 GCVulkanMemoryAllocation* BufferMemory);
     void GCVulkanUtilities_CreateImage(const GCRendererDevice* const Device, const uint32_t Width,
                                        const uint32_t Height, const uint32_t MipLevels, const VkFormat Format,
                                        const VkImageTiling Tiling, const VkSampleCountFlagBits SampleCount,
                                        const VkImageUsageFlags Usage, const VkMemoryPropertyFlags MemoryProperty,
-                                       VkImage* ImageHandle, VkDeviceMemory* ImageMemoryHandle);
+                                       VkImage* ImageHandle, GCVulkanMemoryAllocation* ImageMemory);
+    void GCVulkanUtilities_DestroyBuffer(const GCRendererDevice* const Device, const VkBuffer BufferHandle,
+                                         const GCVulkanMemoryAllocation* const BufferMemory);
+    void GCVulkanUtilities_DestroyImage(const GCRendererDevice* const Device, const VkImage ImageHandle,
+                                        const GCVulkanMemoryAllocation* const ImageMemory);
     void GCVulkanUtilities_CreateImageView(const GCRendererDevice* const Device, const VkImage ImageHandle,
                                            const VkFormat Format, const VkImageAspectFlags ImageAspect,
                                            const uint32_t MipLevels, VkImageView* ImageViewHandle);
@@ -79,13 +86,19 @@ extern "C"
                                      const uint32_t Height);
     void GCVulkanUtilities_CopyImageToBuffer(const VkCommandBuffer CommandBufferHandle, const VkImage SourceImageHandle,
                                              const VkImageLayout SourceImageLayout,
-                                             const VkBuffer DestinationBufferHandle, const uint32_t Width,
+                                             const VkBuffer DestinationBufferHandle,
+                                             const VkDeviceSize DestinationOffset, const uint32_t Width,
                                              const uint32_t Height, const int32_t X, const int32_t Y);
     void GCVulkanUtilities_CopyBuffer(const VkCommandBuffer CommandBufferHandle, const VkBuffer SourceBufferHandle,
                                       const VkBuffer DestinationBufferHandle, const VkDeviceSize Size);
+    void GCVulkanUtilities_CopyBufferRegion(const VkCommandBuffer CommandBufferHandle,
+                                            const VkBuffer SourceBufferHandle, const VkDeviceSize SourceOffset,
+                                            const VkBuffer DestinationBufferHandle,
+                                            const VkDeviceSize DestinationOffset, const VkDeviceSize Size);
     void GCVulkanUtilities_CopyBufferToImage(const VkCommandBuffer CommandBufferHandle,
-                                             const VkBuffer SourceBufferHandle, const VkImage DestinationImageHandle,
-                                             const uint32_t Width, const uint32_t Height);
+                                             const VkBuffer SourceBufferHandle, const VkDeviceSize SourceOffset,
+                                             const VkImage DestinationImageHandle, const uint32_t Width,
+                                             const uint32_t Height);
 
     VkSampleCountFlagBits GCVulkanUtilities_GetMaximumUsableSampleCount(const GCRendererDevice* const Device);
 
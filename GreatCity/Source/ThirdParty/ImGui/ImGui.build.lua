@@ -23,6 +23,17 @@ project "ImGui"
     filter "system:windows"
         systemversion "latest"
 
+    filter "system:linux"
+        includedirs
+        {
+            "$(VULKAN_SDK)/include"
+        }
+
+        removefiles
+        {
+            "%{wks.location}/GreatCity/Source/ThirdParty/ImGui/Source/imgui_impl_win32.cpp"
+        }
+
     filter "configurations:Debug"
         runtime "Debug"
         symbols "On"
@@ -24,6 +24,12 @@ project "ImGuizmo"
     filter "system:windows"
         systemversion "latest"
 
+    filter "system:linux"
+        includedirs
+        {
+            "$(VULKAN_SDK)/include"
+        }
+
     filter "configurations:Debug"
         runtime "Debug"
         symbols "On"
@@ -25,11 +25,13 @@
 #include "ApplicationCore/GenericPlatform/MouseButtonCode.h"
 #include "Core/Memory/Allocator.h"
 #include "ImGui/ImGuiManager.h"
+#include "Math/Ray.h"
 #include "Math/Vector2.h"
 #include "Renderer/Renderer.h"
 #include "Renderer/RendererCommandList.h"
 #include "Renderer/RendererDevice.h"
 #include "Renderer/RendererFramebuffer.h"
+#include "Renderer/RendererGeometryPool.h"
 #include "Renderer/RendererMesh.h"
 #include "Renderer/RendererModel.h"
 #include "Renderer/RendererTexture2D.h"
@@ -92,16 +94,25 @@ void GCUI_Initialize(void)
          {"Assets/Models/Buildings/Offices/Office.obj", "Assets/Models/Buildings/Offices",
           "Assets/Textures/Buildings/Offices/Office.png"}}};
 
-    for (const std::tuple<std::string, std::string, std::string>& ModelLocation : ModelLocations)
+    std::array<GCRendererModelFuture*, ModelLocations.size()> ModelFutures{};
+
+    for (uint32_t Counter = 0; Counter < ModelLocations.size(); Counter++)
+    {
+        ModelFutures[Counter] = GCRendererModel_CreateFromFileAsync(std::get<0>(ModelLocations[Counter]).c_str(),
+                                                                    std::get<1>(ModelLocations[Counter]).c_str());
+    }
+
+    for (uint32_t Counter = 0; Counter < ModelLocations.size(); Counter++)
     {
-        GCRendererTexture2DDescription TextureDescription = {0};
+        const std::tuple<std::string, std::string, std::string>& ModelLocation = ModelLocations[Counter];
+
+        GCRendererTexture2DDescription TextureDescription{};
         TextureDescription.Device = Device;
         TextureDescription.CommandList = CommandList;
         TextureDescription.TexturePath = std::get<2>(ModelLocation).c_str();
         GCRendererTexture2D* Texture = GCRendererTexture2D_Create(&TextureDescription);
 
-        UIData->UIEntityData[GCRendererModel_CreateFromFile(std::get<0>(ModelLocation).c_str(),
-                                                            std::get<1>(ModelLocation).c_str())] =
+        UIData->UIEntityData[GCRendererModelFuture_Get(ModelFutures[Counter])] =
             std::make_pair(Texture, GCImGuiManager_AddTexture(Texture));
     }
 }
@@ -233,9 +244,10 @@ void GCUI_Render(void)
 
         if (Entity != 0)
         {
-            GCTransformComponent* const TransformComponent = GCEntity_GetTransformComponent(Entity);
-            TransformComponent->Translation =
-                GCVector3_Create(0.0f, GCEntity_GetTransformComponent(Entity)->Translation.Y - 2.5f, 0.0f);
+            GCTransformComponent TransformComponent = *GCEntity_GetTransformComponent(Entity);
+            TransformComponent.Translation = GCVector3_Create(0.0f, TransformComponent.Translation.Y - 2.5f, 0.0f);
+
+            GCEntity_SetTransformComponent(Entity, &TransformComponent);
 
             UIData->Entities.emplace_back(Entity);
         }
@@ -284,7 +296,8 @@ void GCUI_Render(void)
         GCMatrix4x4 WorldCameraProjectionMatrix = *OriginalWorldCameraProjectionMatrix;
         WorldCameraProjectionMatrix.Data[1][1] *= -1.0f;
 
-        GCTransformComponent* const EntityTransformComponent = GCEntity_GetTransformComponent(UIData->SelectedEntity);
+        const GCTransformComponent* const EntityTransformComponent =
+            GCEntity_GetTransformComponent(UIData->SelectedEntity);
         GCMatrix4x4 EntityTransform = GCTransformComponent_GetTransform(EntityTransformComponent);
 
         std::array<float, 3> SnapValues{};
@@ -310,15 +323,19 @@ void GCUI_Render(void)
 
             const GCTransformComponent EntityTransformComponentCopy = *EntityTransformComponent;
 
-            EntityTransformComponent->Translation = EntityTranslation;
-            EntityTransformComponent->Rotation = EntityRotation;
-            EntityTransformComponent->Scale = EntityScale;
+            GCTransformComponent NewEntityTransformComponent{};
+            NewEntityTransformComponent.Translation = EntityTranslation;
+            NewEntityTransformComponent.Rotation = EntityRotation;
+            NewEntityTransformComponent.Scale = EntityScale;
 
-            if (GCWorld_CheckCollision(World, UIData->SelectedEntity))
+            GCEntity_SetTransformComponent(UIData->SelectedEntity, &NewEntityTransformComponent);
+
+            std::array<GCEntity, 8> CollidingEntities{};
+
+            if (GCWorld_CheckCollision(World, UIData->SelectedEntity, CollidingEntities.data(),
+                                       static_cast<uint32_t>(CollidingEntities.size())))
             {
-                EntityTransformComponent->Translation = EntityTransformComponentCopy.Translation;
-                EntityTransformComponent->Rotation = EntityTransformComponentCopy.Rotation;
-                EntityTransformComponent->Scale = EntityTransformComponentCopy.Scale;
+                GCEntity_SetTransformComponent(UIData->SelectedEntity, &EntityTransformComponentCopy);
             }
         }
     }
@@ -326,6 +343,42 @@ void GCUI_Render(void)
     ImGui::End();
     ImGui::PopStyleVar();
 
+    const GCRendererStatistics RendererStatistics = GCRenderer_GetStatistics();
+
+    ImGui::Begin("Statistics");
+    ImGui::Text("Draw Calls: %u", RendererStatistics.DrawCallCount);
+    ImGui::Text("Binds: %u", RendererStatistics.BindCount);
+    ImGui::Text("Visible Entities: %u", RendererStatistics.VisibleEntityCount);
+    ImGui::Text("Culled Entities: %u", RendererStatistics.CulledEntityCount);
+    ImGui::Text("Heap Allocations: %u", RendererStatistics.HeapAllocationCount);
+
+    const GCRendererGeometryPoolStatistics GeometryPoolStatistics =
+        GCRendererGeometryPool_GetStatistics(GCRenderer_GetGeometryPool());
+
+    ImGui::Text("Geometry Pool Vertices: %u / %u", GeometryPoolStatistics.UsedVertexCount,
+                GeometryPoolStatistics.VertexCapacity);
+    ImGui::Text("Geometry Pool Indices: %u / %u", GeometryPoolStatistics.UsedIndexCount,
+                GeometryPoolStatistics.IndexCapacity);
+
+    const GCRendererDeviceMemoryStatistics DeviceMemoryStatistics =
+        GCRendererDevice_GetMemoryStatistics(GCRenderer_GetDevice());
+
+    ImGui::Text("Device Memory Allocations: %u / %u", DeviceMemoryStatistics.DeviceMemoryAllocationCount,
+                DeviceMemoryStatistics.MaximumDeviceMemoryAllocationCount);
+    ImGui::Text("Device Memory Blocks: %u", DeviceMemoryStatistics.BlockCount);
+    ImGui::Text("Device Memory Resources: %u (%u dedicated)", DeviceMemoryStatistics.AllocationCount,
+                DeviceMemoryStatistics.DedicatedAllocationCount);
+    ImGui::Text("Device Memory: %.1f / %.1f MiB", DeviceMemoryStatistics.UsedSize / (1024.0 * 1024.0),
+                DeviceMemoryStatistics.ReservedSize / (1024.0 * 1024.0));
+
+    float TimeScale = GCApplication_GetTimeScale();
+
+    if (ImGui::SliderFloat("Time Scale", &TimeScale, 0.0f, 8.0f))
+    {
+        GCApplication_SetTimeScale(TimeScale);
+    }
+    ImGui::End();
+
     GCImGuiManager_Render();
 
     GCRenderer_EndImGui();
@@ -353,10 +406,21 @@ void GCUI_OnUpdate(void)
         if (MouseX >= 0 && MouseY >= 0 && MouseX < static_cast<std::int32_t>(UIData->ViewportSize.X) &&
             MouseY < static_cast<std::int32_t>(UIData->ViewportSize.Y))
         {
-            const int32_t EntityID = GCRendererFramebuffer_GetPixel(GCRenderer_GetFramebuffer(),
-                                                                    GCRenderer_GetCommandList(), 1, MouseX, MouseY);
+#ifdef GC_RENDERER_CPU_PICKING
+            GCWorld* const World = GCApplication_GetWorld();
+            const GCRay Ray = GCWorldCamera_CreateRay(GCWorld_GetCamera(World), MousePosition);
+
+            GCEntity Entity{};
+            float Distance = 0.0f;
+
+            UIData->HoveredEntity = GCWorld_CastRay(World, &Ray, &Entity, &Distance) ? Entity : GCEntity{};
+#else
+            GCRendererFramebuffer_RequestPixel(GCRenderer_GetFramebuffer(), 1, MouseX, MouseY);
+
+            const int32_t EntityID = GCRendererFramebuffer_GetPixel(GCRenderer_GetFramebuffer());
 
             UIData->HoveredEntity = EntityID == -1 ? GCEntity{} : GCEntity{static_cast<uint64_t>(EntityID)};
+#endif
         }
     }
 }
@@ -395,7 +459,7 @@ bool GCUI_OnKeyPressed(GCEvent* const Event, void* CustomData)
 {
     (void)CustomData;
 
-    const GCKeyPressedEvent* const EventDetail = (const GCKeyPressedEvent* const)Event->EventDetail;
+    const GCKeyPressedEvent* const EventDetail = (const GCKeyPressedEvent*)Event->EventDetail;
 
     switch (EventDetail->KeyCode)
     {
@@ -418,6 +482,9 @@ bool GCUI_OnKeyPressed(GCEvent* const Event, void* CustomData)
 
         break;
     }
+    default: {
+        break;
+    }
     }
 
     return false;
@@ -427,7 +494,7 @@ bool GCUI_OnMouseButtonPressed(GCEvent* const Event, void* CustomData)
 {
     (void)CustomData;
 
-    const GCMouseButtonPressedEvent* const EventDetail = (const GCMouseButtonPressedEvent* const)Event->EventDetail;
+    const GCMouseButtonPressedEvent* const EventDetail = (const GCMouseButtonPressedEvent*)Event->EventDetail;
 
     if (EventDetail->MouseButtonCode == GCMouseButtonCode_Left)
     {
@@ -26,9 +26,11 @@
 #include "Core/Memory/Allocator.h"
 #include "Math/Matrix4x4.h"
 #include "Math/Quaternion.h"
+#include "Math/Ray.h"
 #include "Math/Utilities.h"
 #include "Math/Vector2.h"
 #include "Math/Vector3.h"
+#include "Math/Vector4.h"
 
 #include <math.h>
 #include <stdint.h>
@@ -133,12 +135,12 @@ GCVector3 GCWorldCamera_GetPosition(const GCWorldCamera* const WorldCamera)
     return WorldCamera->Position;
 }
 
-const GCMatrix4x4* const GCWorldCamera_GetViewMatrix(const GCWorldCamera* const WorldCamera)
+const GCMatrix4x4* GCWorldCamera_GetViewMatrix(const GCWorldCamera* const WorldCamera)
 {
     return &WorldCamera->ViewMatrix;
 }
 
-const GCMatrix4x4* const GCWorldCamera_GetProjectionMatrix(const GCWorldCamera* const WorldCamera)
+const GCMatrix4x4* GCWorldCamera_GetProjectionMatrix(const GCWorldCamera* const WorldCamera)
 {
     return &WorldCamera->ProjectionMatrix;
 }
@@ -148,6 +150,22 @@ GCMatrix4x4 GCWorldCamera_GetViewProjectionMatrix(const GCWorldCamera* const Wor
     return GCMatrix4x4_Multiply(&WorldCamera->ProjectionMatrix, &WorldCamera->ViewMatrix);
 }
 
+GCRay GCWorldCamera_CreateRay(const GCWorldCamera* const WorldCamera, const GCVector2 ScreenPosition)
+{
+    const GCMatrix4x4 ViewProjectionMatrix = GCWorldCamera_GetViewProjectionMatrix(WorldCamera);
+    const GCMatrix4x4 InverseViewProjectionMatrix = GCMatrix4x4_Inverse(&ViewProjectionMatrix);
+
+    const float X = 2.0f * ScreenPosition.X / WorldCamera->Width - 1.0f;
+    const float Y = 2.0f * ScreenPosition.Y / WorldCamera->Height - 1.0f;
+
+    const GCVector4 FarPoint =
+        GCMatrix4x4_MultiplyByVector(&InverseViewProjectionMatrix, GCVector4_Create(X, Y, 1.0f, 1.0f));
+    const GCVector3 FarPosition =
+        GCVector3_Create(FarPoint.X / FarPoint.W, FarPoint.Y / FarPoint.W, FarPoint.Z / FarPoint.W);
+
+    return GCRay_Create(WorldCamera->Position, GCVector3_Subtract(FarPosition, WorldCamera->Position));
+}
+
 void GCWorldCamera_UpdateView(GCWorldCamera* const WorldCamera)
 {
     WorldCamera->Position = GCWorldCamera_CalculatePosition(WorldCamera);
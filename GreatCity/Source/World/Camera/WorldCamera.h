@@ -19,6 +19,8 @@
 #define GC_WORLD_CAMERA_WORLD_CAMERA_H
 
 #include "Math/Matrix4x4.h"
+#include "Math/Ray.h"
+#include "Math/Vector2.h"
 #include "Math/Vector3.h"
 
 #include <stdint.h>
@@ -37,9 +39,10 @@ extern "C"
     void GCWorldCamera_SetSize(GCWorldCamera* const WorldCamera, const uint32_t Width, const uint32_t Height);
 
     GCVector3 GCWorldCamera_GetPosition(const GCWorldCamera* const WorldCamera);
-    const GCMatrix4x4* const GCWorldCamera_GetViewMatrix(const GCWorldCamera* const WorldCamera);
-    const GCMatrix4x4* const GCWorldCamera_GetProjectionMatrix(const GCWorldCamera* const WorldCamera);
+    const GCMatrix4x4* GCWorldCamera_GetViewMatrix(const GCWorldCamera* const WorldCamera);
+    const GCMatrix4x4* GCWorldCamera_GetProjectionMatrix(const GCWorldCamera* const WorldCamera);
     GCMatrix4x4 GCWorldCamera_GetViewProjectionMatrix(const GCWorldCamera* const WorldCamera);
+    GCRay GCWorldCamera_CreateRay(const GCWorldCamera* const WorldCamera, const GCVector2 ScreenPosition);
 
 #ifdef __cplusplus
 }
@@ -20,15 +20,47 @@
 #include "Math/Quaternion.h"
 #include "Math/Vector3.h"
 
+static GCMatrix4x4 GCTransformComponent_CreateTransform(const GCVector3 Translation, const GCQuaternion Rotation,
+                                                       const GCVector3 Scale);
+static GCQuaternion GCTransformComponent_GetRotation(const GCTransformComponent* const TransformComponent);
+
 GCMatrix4x4 GCTransformComponent_GetTransform(const GCTransformComponent* const TransformComponent)
 {
-    const GCMatrix4x4 Translation = GCMatrix4x4_CreateTranslation(TransformComponent->Translation);
-    const GCMatrix4x4 Rotation = GCQuaternion_ToRotationMatrix(GCQuaternion_CreateFromEulerAngles(
-        TransformComponent->Rotation.X, TransformComponent->Rotation.Y, TransformComponent->Rotation.Z));
-    const GCMatrix4x4 Scale = GCMatrix4x4_CreateScale(TransformComponent->Scale);
+    return GCTransformComponent_CreateTransform(TransformComponent->Translation,
+                                                GCTransformComponent_GetRotation(TransformComponent),
+                                                TransformComponent->Scale);
+}
+
+GCMatrix4x4 GCTransformComponent_Interpolate(const GCTransformComponent* const TransformComponent1,
+                                             const GCTransformComponent* const TransformComponent2, const float Factor)
+{
+    const GCVector3 TranslationDelta =
+        GCVector3_Subtract(TransformComponent2->Translation, TransformComponent1->Translation);
+    const GCVector3 Translation =
+        GCVector3_Add(TransformComponent1->Translation, GCVector3_MultiplyByScalar(TranslationDelta, Factor));
+    const GCQuaternion Rotation = GCQuaternion_Slerp(GCTransformComponent_GetRotation(TransformComponent1),
+                                                     GCTransformComponent_GetRotation(TransformComponent2), Factor);
+    const GCVector3 ScaleDelta = GCVector3_Subtract(TransformComponent2->Scale, TransformComponent1->Scale);
+    const GCVector3 Scale = GCVector3_Add(TransformComponent1->Scale, GCVector3_MultiplyByScalar(ScaleDelta, Factor));
+
+    return GCTransformComponent_CreateTransform(Translation, Rotation, Scale);
+}
+
+GCMatrix4x4 GCTransformComponent_CreateTransform(const GCVector3 Translation, const GCQuaternion Rotation,
+                                                 const GCVector3 Scale)
+{
+    const GCMatrix4x4 TranslationMatrix = GCMatrix4x4_CreateTranslation(Translation);
+    const GCMatrix4x4 RotationMatrix = GCQuaternion_ToRotationMatrix(Rotation);
+    const GCMatrix4x4 ScaleMatrix = GCMatrix4x4_CreateScale(Scale);
 
-    GCMatrix4x4 Transform = GCMatrix4x4_Multiply(&Translation, &Rotation);
-    Transform = GCMatrix4x4_Multiply(&Transform, &Scale);
+    GCMatrix4x4 Transform = GCMatrix4x4_Multiply(&TranslationMatrix, &RotationMatrix);
+    Transform = GCMatrix4x4_Multiply(&Transform, &ScaleMatrix);
 
     return Transform;
-}
\ No newline at end of file
+}
+
+GCQuaternion GCTransformComponent_GetRotation(const GCTransformComponent* const TransformComponent)
+{
+    return GCQuaternion_CreateFromEulerAngles(TransformComponent->Rotation.X, TransformComponent->Rotation.Y,
+                                              TransformComponent->Rotation.Z);
+}
@@ -21,6 +21,8 @@
 #include "Math/Matrix4x4.h"
 #include "Math/Vector3.h"
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -35,12 +37,25 @@ extern "C"
         GCVector3 Scale;
     } GCTransformComponent;
 
+    typedef struct GCWorldMatrixComponent
+    {
+        GCMatrix4x4 Transform;
+        GCMatrix4x4 InverseTransform;
+        GCTransformComponent PreviousState;
+        GCTransformComponent State;
+        uint64_t TickIndex;
+    } GCWorldMatrixComponent;
+
     typedef struct GCMeshComponent
     {
         GCRendererMesh* Mesh;
+        uint32_t LODIndex;
     } GCMeshComponent;
 
     GCMatrix4x4 GCTransformComponent_GetTransform(const GCTransformComponent* const TransformComponent);
+    GCMatrix4x4 GCTransformComponent_Interpolate(const GCTransformComponent* const TransformComponent1,
+                                                 const GCTransformComponent* const TransformComponent2,
+                                                 const float Factor);
 
 #ifdef __cplusplus
 }
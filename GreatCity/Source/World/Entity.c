@@ -16,6 +16,7 @@
 */
 
 #include "World/Entity.h"
+#include "Math/Matrix4x4.h"
 #include "Math/Vector3.h"
 #include "Renderer/RendererMesh.h"
 #include "World/Components.h"
@@ -24,23 +25,42 @@
 
 extern ecs_world_t* GWorldECSWorld;
 extern ECS_COMPONENT_DECLARE(GCTransformComponent);
+extern ECS_COMPONENT_DECLARE(GCWorldMatrixComponent);
 extern ECS_COMPONENT_DECLARE(GCMeshComponent);
 
-GCTransformComponent* GCEntity_AddTransformComponent(const GCEntity Entity)
+const GCTransformComponent* GCEntity_AddTransformComponent(const GCEntity Entity)
 {
-    ecs_add(GWorldECSWorld, (ecs_entity_t)Entity, GCTransformComponent);
+    GCTransformComponent TransformComponent = {0};
+    TransformComponent.Translation = GCVector3_CreateZero();
+    TransformComponent.Rotation = GCVector3_CreateZero();
+    TransformComponent.Scale = GCVector3_Create(1.0f, 1.0f, 1.0f);
+
+    GCWorldMatrixComponent WorldMatrixComponent = {0};
+    WorldMatrixComponent.Transform = GCTransformComponent_GetTransform(&TransformComponent);
+    WorldMatrixComponent.InverseTransform = GCMatrix4x4_Inverse(&WorldMatrixComponent.Transform);
+    WorldMatrixComponent.PreviousState = TransformComponent;
+    WorldMatrixComponent.State = TransformComponent;
+    WorldMatrixComponent.TickIndex = 0;
+
+    ecs_set_ptr(GWorldECSWorld, (ecs_entity_t)Entity, GCWorldMatrixComponent, &WorldMatrixComponent);
+    ecs_set_ptr(GWorldECSWorld, (ecs_entity_t)Entity, GCTransformComponent, &TransformComponent);
+
+    return ecs_get(GWorldECSWorld, (ecs_entity_t)Entity, GCTransformComponent);
+}
 
-    GCTransformComponent* TransformComponent = ecs_get_mut(GWorldECSWorld, (ecs_entity_t)Entity, GCTransformComponent);
-    TransformComponent->Translation = GCVector3_CreateZero();
-    TransformComponent->Rotation = GCVector3_CreateZero();
-    TransformComponent->Scale = GCVector3_Create(1.0f, 1.0f, 1.0f);
+const GCTransformComponent* GCEntity_GetTransformComponent(const GCEntity Entity)
+{
+    return ecs_get(GWorldECSWorld, (ecs_entity_t)Entity, GCTransformComponent);
+}
 
-    return TransformComponent;
+void GCEntity_SetTransformComponent(const GCEntity Entity, const GCTransformComponent* const TransformComponent)
+{
+    ecs_set_ptr(GWorldECSWorld, (ecs_entity_t)Entity, GCTransformComponent, TransformComponent);
 }
 
-GCTransformComponent* GCEntity_GetTransformComponent(const GCEntity Entity)
+const GCWorldMatrixComponent* GCEntity_GetWorldMatrixComponent(const GCEntity Entity)
 {
-    return ecs_get_mut(GWorldECSWorld, (ecs_entity_t)Entity, GCTransformComponent);
+    return ecs_get(GWorldECSWorld, (ecs_entity_t)Entity, GCWorldMatrixComponent);
 }
 
 GCMeshComponent* GCEntity_AddMeshComponent(const GCEntity Entity, const GCRendererModel* const Model)
@@ -48,7 +68,8 @@ GCMeshComponent* GCEntity_AddMeshComponent(const GCEntity Entity, const GCRender
     ecs_add(GWorldECSWorld, (ecs_entity_t)Entity, GCMeshComponent);
 
     GCMeshComponent* MeshComponent = ecs_get_mut(GWorldECSWorld, (ecs_entity_t)Entity, GCMeshComponent);
-    MeshComponent->Mesh = GCRendererMesh_Create(Entity, Model);
+    MeshComponent->Mesh = GCRendererMesh_Create(Model);
+    MeshComponent->LODIndex = 0;
 
     return MeshComponent;
 }
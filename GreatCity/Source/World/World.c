@@ -17,12 +17,22 @@
 
 #include "World/World.h"
 #include "Core/Memory/Allocator.h"
+#include "Core/Jobs/JobSystem.h"
+#include "Math/BoundingVolume.h"
+#include "Math/BoundingVolumeHierarchy.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Ray.h"
 #include "Renderer/Renderer.h"
+#include "Renderer/RendererMesh.h"
 #include "Renderer/RendererModel.h"
 #include "World/Camera/WorldCamera.h"
 #include "World/Components.h"
+#include "World/WorldSpatialHash.h"
 
+#include <float.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
 
 #include <flecs.h>
 
@@ -30,36 +40,191 @@ typedef struct GCWorld
 {
     GCWorldCamera* WorldCamera;
     GCEntity TerrainEntity;
+    GCRendererModel* TerrainModel;
+    GCWorldSpatialHash* SpatialHash;
 
     ecs_world_t* World;
+    ecs_query_t* RenderQuery;
+    ecs_query_t* MeshQuery;
+    ecs_entity_t UpdateWorldMatricesSystem;
+    GCJobCounter* UpdateWorldMatricesCounter;
+
+    GCBoundingVolumeHierarchy* BoundingVolumeHierarchy;
+    GCEntity* PickableEntities;
+    const GCRendererModel** PickableModels;
+    GCMatrix4x4* PickableInverseTransforms;
+    GCBoundingBox* PickableBoundingBoxes;
+    uint32_t* RefitPickableEntityIndices;
+    uint32_t PickableEntityCount;
+    uint32_t PickableEntityCapacity;
+    uint32_t* PickableEntityTable;
+    uint32_t PickableEntityTableCapacity;
+    GCEntity* ChangedEntities;
+    uint32_t ChangedEntityCount;
+    uint32_t ChangedEntityCapacity;
+    uint32_t RefitEntityCount;
+    bool IsBoundingVolumeHierarchyDirty;
+
+    uint64_t TickIndex;
 } GCWorld;
 
+typedef struct GCWorldUpdateWorldMatricesData
+{
+    const GCTransformComponent* TransformComponents;
+    GCWorldMatrixComponent* WorldMatrixComponents;
+    uint64_t TickIndex;
+    bool IsSimulated;
+} GCWorldUpdateWorldMatricesData;
+
+#define GC_WORLD_SPATIAL_HASH_CELL_SIZE 4.0f
+#define GC_WORLD_WORLD_MATRIX_GRAIN_SIZE 64
+#define GC_WORLD_BOUNDING_VOLUME_HIERARCHY_REFIT_RATIO 4
+
 ecs_world_t* GWorldECSWorld = NULL;
 
 ECS_COMPONENT_DECLARE(GCTransformComponent);
+ECS_COMPONENT_DECLARE(GCWorldMatrixComponent);
 ECS_COMPONENT_DECLARE(GCMeshComponent);
+ECS_TAG_DECLARE(GCWorldMatrixDirtyTag);
+
+static void* GCWorld_Allocate(const ecs_size_t Size);
+static void* GCWorld_AllocateZero(const ecs_size_t Size);
+static void* GCWorld_Reallocate(void* Data, const ecs_size_t NewSize);
+static void GCWorld_Free(void* Data);
+static void GCWorld_OnTransformComponentSet(ecs_iter_t* Iterator);
+static void GCWorld_OnTransformComponentRemove(ecs_iter_t* Iterator);
+static void GCWorld_OnMeshComponentChanged(ecs_iter_t* Iterator);
+static void GCWorld_UpdateWorldMatrices(ecs_iter_t* Iterator);
+static void GCWorld_UpdateWorldMatrixRange(const uint32_t Start, const uint32_t End, void* Data);
+static void GCWorld_AddChangedEntities(GCWorld* const World, const ecs_entity_t* const Entities,
+                                       const uint32_t EntityCount);
+static void GCWorld_UpdateBoundingVolumeHierarchy(GCWorld* const World);
+static void GCWorld_RefitBoundingVolumeHierarchy(GCWorld* const World);
+static uint32_t GCWorld_HashEntity(const GCEntity Entity);
+static uint32_t GCWorld_FindPickableEntityIndex(const GCWorld* const World, const GCEntity Entity);
+static bool GCWorld_CastRayAgainstEntity(void* const Context, const uint32_t PickableEntityIndex,
+                                         const GCRay* const Ray, const float MaximumDistance, float* const Distance);
 
 GCWorld* GCWorld_Create(void)
 {
+    GCRendererModelFuture* const TerrainModelFuture =
+        GCRendererModel_CreateFromFileAsync("Assets/Models/Terrains/BasicTerrain.obj", "Assets/Models/Terrains");
+
     GCWorld* World = (GCWorld*)GCMemory_Allocate(sizeof(GCWorld));
     World->WorldCamera = GCWorldCamera_Create(30.0f, 1280.0f / 720.0f, 0.1f, 1000.0f);
+    World->SpatialHash = GCWorldSpatialHash_Create(GC_WORLD_SPATIAL_HASH_CELL_SIZE);
+    World->BoundingVolumeHierarchy = NULL;
+    World->PickableEntities = NULL;
+    World->PickableModels = NULL;
+    World->PickableInverseTransforms = NULL;
+    World->PickableBoundingBoxes = NULL;
+    World->RefitPickableEntityIndices = NULL;
+    World->PickableEntityCount = 0;
+    World->PickableEntityCapacity = 0;
+    World->PickableEntityTable = NULL;
+    World->PickableEntityTableCapacity = 0;
+    World->ChangedEntities = NULL;
+    World->ChangedEntityCount = 0;
+    World->ChangedEntityCapacity = 0;
+    World->RefitEntityCount = 0;
+    World->IsBoundingVolumeHierarchyDirty = true;
+    World->TickIndex = 1;
+
+    ecs_os_set_api_defaults();
+
+    ecs_os_api_t OSAPI = ecs_os_get_api();
+    OSAPI.malloc_ = GCWorld_Allocate;
+    OSAPI.calloc_ = GCWorld_AllocateZero;
+    OSAPI.realloc_ = GCWorld_Reallocate;
+    OSAPI.free_ = GCWorld_Free;
+    ecs_os_set_api(&OSAPI);
+
     World->World = ecs_init();
 
     GWorldECSWorld = World->World;
 
     ECS_COMPONENT_DEFINE(World->World, GCTransformComponent);
+    ECS_COMPONENT_DEFINE(World->World, GCWorldMatrixComponent);
     ECS_COMPONENT_DEFINE(World->World, GCMeshComponent);
+    ECS_TAG_DEFINE(World->World, GCWorldMatrixDirtyTag);
+
+    {
+        ecs_observer_desc_t ObserverDescription = {0};
+        ObserverDescription.filter.terms->id = ecs_id(GCTransformComponent);
+        ObserverDescription.events[0] = EcsOnSet;
+        ObserverDescription.callback = GCWorld_OnTransformComponentSet;
+        ObserverDescription.ctx = World->SpatialHash;
+
+        ecs_observer_init(World->World, &ObserverDescription);
+    }
+
+    {
+        ecs_observer_desc_t ObserverDescription = {0};
+        ObserverDescription.filter.terms->id = ecs_id(GCTransformComponent);
+        ObserverDescription.events[0] = EcsOnRemove;
+        ObserverDescription.callback = GCWorld_OnTransformComponentRemove;
+        ObserverDescription.ctx = World->SpatialHash;
+
+        ecs_observer_init(World->World, &ObserverDescription);
+    }
+
+    {
+        ecs_observer_desc_t ObserverDescription = {0};
+        ObserverDescription.filter.terms->id = ecs_id(GCMeshComponent);
+        ObserverDescription.events[0] = EcsOnAdd;
+        ObserverDescription.events[1] = EcsOnRemove;
+        ObserverDescription.callback = GCWorld_OnMeshComponentChanged;
+        ObserverDescription.ctx = World;
+
+        ecs_observer_init(World->World, &ObserverDescription);
+    }
+
+    {
+        ecs_entity_desc_t EntityDescription = {0};
+        EntityDescription.name = "GCWorld_UpdateWorldMatrices";
+
+        ecs_system_desc_t SystemDescription = {0};
+        SystemDescription.entity = ecs_entity_init(World->World, &EntityDescription);
+        SystemDescription.query.filter.terms[0].id = ecs_id(GCTransformComponent);
+        SystemDescription.query.filter.terms[0].inout = EcsIn;
+        SystemDescription.query.filter.terms[1].id = ecs_id(GCWorldMatrixComponent);
+        SystemDescription.query.filter.terms[1].inout = EcsInOut;
+        SystemDescription.query.filter.terms[2].id = GCWorldMatrixDirtyTag;
+        SystemDescription.query.filter.terms[2].inout = EcsInOutNone;
+        SystemDescription.callback = GCWorld_UpdateWorldMatrices;
+        SystemDescription.ctx = World;
+
+        World->UpdateWorldMatricesSystem = ecs_system_init(World->World, &SystemDescription);
+    }
+
+    World->UpdateWorldMatricesCounter = GCJobCounter_Create();
+
+    {
+        ecs_query_desc_t QueryDescription = {0};
+        QueryDescription.filter.terms[0].id = ecs_id(GCWorldMatrixComponent);
+        QueryDescription.filter.terms[0].inout = EcsIn;
+        QueryDescription.filter.terms[1].id = ecs_id(GCMeshComponent);
+
+        World->RenderQuery = ecs_query_init(World->World, &QueryDescription);
+    }
+
+    {
+        ecs_query_desc_t QueryDescription = {0};
+        QueryDescription.filter.terms->id = ecs_id(GCMeshComponent);
+
+        World->MeshQuery = ecs_query_init(World->World, &QueryDescription);
+    }
 
     {
         World->TerrainEntity = GCWorld_CreateEntity(World, "Basic Terrain");
-        GCRendererModel* BasicTerrainModel =
-            GCRendererModel_CreateFromFile("Assets/Models/Terrains/BasicTerrain.obj", "Assets/Models/Terrains");
+        World->TerrainModel = GCRendererModelFuture_Get(TerrainModelFuture);
 
-        GCTransformComponent* const TransformComponent = GCEntity_GetTransformComponent(World->TerrainEntity);
-        TransformComponent->Scale = GCVector3_Create(50.0f, 50.0f, 50.0f);
+        GCTransformComponent TransformComponent = *GCEntity_GetTransformComponent(World->TerrainEntity);
+        TransformComponent.Scale = GCVector3_Create(50.0f, 50.0f, 50.0f);
 
-        GCEntity_AddMeshComponent(World->TerrainEntity, BasicTerrainModel);
-        GCRendererModel_Destroy(BasicTerrainModel);
+        GCEntity_SetTransformComponent(World->TerrainEntity, &TransformComponent);
+
+        GCEntity_AddMeshComponent(World->TerrainEntity, World->TerrainModel);
     }
 
     return World;
@@ -75,67 +240,109 @@ GCEntity GCWorld_CreateEntity(GCWorld* const World, const char* const Name)
     return (GCEntity)Entity;
 }
 
-bool GCWorld_CheckCollision(const GCWorld* const World, const GCEntity Entity)
+uint32_t GCWorld_CheckCollision(const GCWorld* const World, const GCEntity Entity, GCEntity* const CollidingEntities,
+                                const uint32_t MaximumCollidingEntityCount)
 {
     const GCTransformComponent* const TransformComponent = GCEntity_GetTransformComponent(Entity);
 
-    ecs_filter_desc_t FilterDescription = {0};
-    FilterDescription.terms->id = ecs_id(GCTransformComponent);
+    const GCVector3 Minimum = GCVector3_Create(TransformComponent->Translation.X - 1.0f, 0.0f,
+                                               TransformComponent->Translation.Z - 1.0f);
+    const GCVector3 Maximum = GCVector3_Create(TransformComponent->Translation.X + 1.0f, 0.0f,
+                                               TransformComponent->Translation.Z + 1.0f);
 
-    ecs_filter_t* Filter = ecs_filter_init(World->World, &FilterDescription);
-    ecs_iter_t FilterIterator = ecs_filter_iter(World->World, Filter);
+    const GCWorldSpatialHashItem* NearbyItems = NULL;
+    const uint32_t NearbyItemCount = GCWorldSpatialHash_Query(World->SpatialHash, Minimum, Maximum, &NearbyItems);
 
-    bool IsColliding = false;
+    uint32_t CollidingEntityCount = 0;
 
-    while (ecs_filter_next(&FilterIterator))
+    for (uint32_t Counter = 0; Counter < NearbyItemCount && CollidingEntityCount < MaximumCollidingEntityCount;
+         Counter++)
     {
-        for (int32_t Counter = 0; Counter < FilterIterator.count; Counter++)
+        if (NearbyItems[Counter].Entity != Entity)
         {
-            if (FilterIterator.entities[Counter] != Entity)
+            const GCVector3 OtherTranslation = NearbyItems[Counter].Position;
+
+            if (TransformComponent->Translation.X < OtherTranslation.X + 1.0f &&
+                TransformComponent->Translation.X + 1.0f > OtherTranslation.X &&
+                TransformComponent->Translation.Y < OtherTranslation.Y + 1.0f &&
+                TransformComponent->Translation.Y + 1.0f > OtherTranslation.Y &&
+                TransformComponent->Translation.Z < OtherTranslation.Z + 1.0f &&
+                TransformComponent->Translation.Z + 1.0f > OtherTranslation.Z)
             {
-                const GCTransformComponent* const OtherTransformComponent =
-                    GCEntity_GetTransformComponent(FilterIterator.entities[Counter]);
-
-                if (TransformComponent->Translation.X < OtherTransformComponent->Translation.X + 1.0f &&
-                    TransformComponent->Translation.X + 1.0f > OtherTransformComponent->Translation.X &&
-                    TransformComponent->Translation.Y < OtherTransformComponent->Translation.Y + 1.0f &&
-                    TransformComponent->Translation.Y + 1.0f > OtherTransformComponent->Translation.Y &&
-                    TransformComponent->Translation.Z < OtherTransformComponent->Translation.Z + 1.0f &&
-                    TransformComponent->Translation.Z + 1.0f > OtherTransformComponent->Translation.Z)
-                {
-                    IsColliding = true;
-                }
+                CollidingEntities[CollidingEntityCount] = NearbyItems[Counter].Entity;
+                CollidingEntityCount++;
             }
         }
     }
 
-    ecs_iter_fini(&FilterIterator);
-    ecs_filter_fini(Filter);
+    return CollidingEntityCount;
+}
+
+bool GCWorld_CastRay(GCWorld* const World, const GCRay* const Ray, GCEntity* const Entity, float* const Distance)
+{
+    if (World->IsBoundingVolumeHierarchyDirty)
+    {
+        GCWorld_UpdateBoundingVolumeHierarchy(World);
+    }
+    else if (World->ChangedEntityCount)
+    {
+        GCWorld_RefitBoundingVolumeHierarchy(World);
+    }
+
+    uint32_t PickableEntityIndex = 0;
 
-    return IsColliding;
+    if (!GCBoundingVolumeHierarchy_CastRay(World->BoundingVolumeHierarchy, Ray, FLT_MAX, GCWorld_CastRayAgainstEntity,
+                                           World, &PickableEntityIndex, Distance))
+    {
+        return false;
+    }
+
+    *Entity = World->PickableEntities[PickableEntityIndex];
+
+    return true;
+}
+
+void GCWorld_OnTick(GCWorld* const World, const float DeltaTime)
+{
+    World->TickIndex++;
+
+    bool IsSimulated = true;
+    ecs_run(World->World, World->UpdateWorldMatricesSystem, DeltaTime, &IsSimulated);
 }
 
-void GCWorld_OnUpdate(GCWorld* const World)
+void GCWorld_OnUpdate(GCWorld* const World, const float InterpolationFactor)
 {
+    bool IsSimulated = false;
+    ecs_run(World->World, World->UpdateWorldMatricesSystem, 0.0f, &IsSimulated);
+
     GCRenderer_BeginWorld(World->WorldCamera);
     {
-        ecs_filter_desc_t FilterDescriptions[2] = {0};
-        FilterDescriptions[0].terms->id = ecs_id(GCTransformComponent);
-        FilterDescriptions[1].terms->id = ecs_id(GCMeshComponent);
+        ecs_iter_t QueryIterator = ecs_query_iter(World->World, World->RenderQuery);
 
-        ecs_filter_t* Filter = ecs_filter_init(World->World, FilterDescriptions);
-        ecs_iter_t FilterIterator = ecs_filter_iter(World->World, Filter);
-
-        while (ecs_filter_next(&FilterIterator))
+        while (ecs_query_next(&QueryIterator))
         {
-            for (int32_t Counter = 0; Counter < FilterIterator.count; Counter++)
+            const GCWorldMatrixComponent* const WorldMatrixComponents =
+                ecs_field(&QueryIterator, GCWorldMatrixComponent, 1);
+            GCMeshComponent* const MeshComponents = ecs_field(&QueryIterator, GCMeshComponent, 2);
+
+            for (int32_t Counter = 0; Counter < QueryIterator.count; Counter++)
             {
-                GCRenderer_RenderEntity(FilterIterator.entities[Counter]);
+                const GCWorldMatrixComponent* const WorldMatrixComponent = &WorldMatrixComponents[Counter];
+
+                if (WorldMatrixComponent->TickIndex == World->TickIndex)
+                {
+                    const GCMatrix4x4 Transform = GCTransformComponent_Interpolate(
+                        &WorldMatrixComponent->PreviousState, &WorldMatrixComponent->State, InterpolationFactor);
+
+                    GCRenderer_RenderEntity(QueryIterator.entities[Counter], &Transform, &MeshComponents[Counter]);
+                }
+                else
+                {
+                    GCRenderer_RenderEntity(QueryIterator.entities[Counter], &WorldMatrixComponent->Transform,
+                                            &MeshComponents[Counter]);
+                }
             }
         }
-
-        ecs_iter_fini(&FilterIterator);
-        ecs_filter_fini(Filter);
     }
     GCRenderer_EndWorld();
 }
@@ -159,24 +366,328 @@ GCEntity GCWorld_GetTerrainEntity(const GCWorld* const World)
 
 void GCWorld_Destroy(GCWorld* World)
 {
-    ecs_filter_desc_t FilterDescription = {0};
-    FilterDescription.terms->id = ecs_id(GCMeshComponent);
-
-    ecs_filter_t* Filter = ecs_filter_init(World->World, &FilterDescription);
-    ecs_iter_t FilterIterator = ecs_filter_iter(World->World, Filter);
+    ecs_iter_t QueryIterator = ecs_query_iter(World->World, World->MeshQuery);
 
-    while (ecs_filter_next(&FilterIterator))
+    while (ecs_query_next(&QueryIterator))
     {
-        for (int32_t Counter = 0; Counter < FilterIterator.count; Counter++)
+        GCMeshComponent* const MeshComponents = ecs_field(&QueryIterator, GCMeshComponent, 1);
+
+        for (int32_t Counter = 0; Counter < QueryIterator.count; Counter++)
         {
-            GCEntity_RemoveMeshComponent(FilterIterator.entities[Counter]);
+            GCRendererMesh_Destroy(MeshComponents[Counter].Mesh);
+            MeshComponents[Counter].Mesh = NULL;
         }
     }
 
-    ecs_iter_fini(&FilterIterator);
-    ecs_filter_fini(Filter);
+    ecs_query_fini(World->MeshQuery);
+    ecs_query_fini(World->RenderQuery);
     ecs_fini(World->World);
 
+    GCJobCounter_Destroy(World->UpdateWorldMatricesCounter);
+
+    if (World->BoundingVolumeHierarchy)
+    {
+        GCBoundingVolumeHierarchy_Destroy(World->BoundingVolumeHierarchy);
+    }
+
+    GCMemory_Free(World->ChangedEntities);
+    GCMemory_Free(World->PickableEntityTable);
+    GCMemory_Free(World->RefitPickableEntityIndices);
+    GCMemory_Free(World->PickableBoundingBoxes);
+    GCMemory_Free(World->PickableInverseTransforms);
+    GCMemory_Free(World->PickableModels);
+    GCMemory_Free(World->PickableEntities);
+
+    GCRendererModel_Destroy(World->TerrainModel);
+
+    GCWorldSpatialHash_Destroy(World->SpatialHash);
     GCMemory_Free(World->WorldCamera);
     GCMemory_Free(World);
 }
+
+void* GCWorld_Allocate(const ecs_size_t Size)
+{
+    return GCMemory_Allocate((size_t)Size);
+}
+
+void* GCWorld_AllocateZero(const ecs_size_t Size)
+{
+    return GCMemory_AllocateZero((size_t)Size);
+}
+
+void* GCWorld_Reallocate(void* Data, const ecs_size_t NewSize)
+{
+    return GCMemory_Reallocate(Data, (size_t)NewSize);
+}
+
+void GCWorld_Free(void* Data)
+{
+    GCMemory_Free(Data);
+}
+
+void GCWorld_OnTransformComponentSet(ecs_iter_t* Iterator)
+{
+    GCWorldSpatialHash* const SpatialHash = (GCWorldSpatialHash*)Iterator->ctx;
+    const GCTransformComponent* const TransformComponents = ecs_field(Iterator, GCTransformComponent, 1);
+
+    for (int32_t Counter = 0; Counter < Iterator->count; Counter++)
+    {
+        ecs_add(Iterator->world, Iterator->entities[Counter], GCWorldMatrixDirtyTag);
+
+        GCWorldSpatialHash_Insert(SpatialHash, Iterator->entities[Counter], TransformComponents[Counter].Translation);
+    }
+}
+
+void GCWorld_OnTransformComponentRemove(ecs_iter_t* Iterator)
+{
+    GCWorldSpatialHash* const SpatialHash = (GCWorldSpatialHash*)Iterator->ctx;
+
+    for (int32_t Counter = 0; Counter < Iterator->count; Counter++)
+    {
+        GCWorldSpatialHash_Remove(SpatialHash, Iterator->entities[Counter]);
+    }
+}
+
+void GCWorld_OnMeshComponentChanged(ecs_iter_t* Iterator)
+{
+    GCWorld* const World = (GCWorld*)Iterator->ctx;
+    World->IsBoundingVolumeHierarchyDirty = true;
+}
+
+void GCWorld_UpdateWorldMatrices(ecs_iter_t* Iterator)
+{
+    GCWorld* const World = (GCWorld*)Iterator->ctx;
+
+    GCWorldUpdateWorldMatricesData UpdateWorldMatricesData = {0};
+    UpdateWorldMatricesData.TransformComponents = ecs_field(Iterator, GCTransformComponent, 1);
+    UpdateWorldMatricesData.WorldMatrixComponents = ecs_field(Iterator, GCWorldMatrixComponent, 2);
+    UpdateWorldMatricesData.TickIndex = World->TickIndex;
+    UpdateWorldMatricesData.IsSimulated = *(const bool*)Iterator->param;
+
+    GCJobSystem_ParallelFor((uint32_t)Iterator->count, GC_WORLD_WORLD_MATRIX_GRAIN_SIZE,
+                            GCWorld_UpdateWorldMatrixRange, &UpdateWorldMatricesData,
+                            World->UpdateWorldMatricesCounter);
+    GCJobSystem_Wait(World->UpdateWorldMatricesCounter);
+
+    for (int32_t Counter = 0; Counter < Iterator->count; Counter++)
+    {
+        ecs_remove(Iterator->world, Iterator->entities[Counter], GCWorldMatrixDirtyTag);
+    }
+
+    GCWorld_AddChangedEntities(World, Iterator->entities, (uint32_t)Iterator->count);
+}
+
+void GCWorld_AddChangedEntities(GCWorld* const World, const ecs_entity_t* const Entities, const uint32_t EntityCount)
+{
+    if (World->IsBoundingVolumeHierarchyDirty || !EntityCount)
+    {
+        return;
+    }
+
+    const uint32_t ChangedEntityCount = World->ChangedEntityCount + EntityCount;
+
+    if (ChangedEntityCount * GC_WORLD_BOUNDING_VOLUME_HIERARCHY_REFIT_RATIO > World->PickableEntityCount)
+    {
+        World->IsBoundingVolumeHierarchyDirty = true;
+        World->ChangedEntityCount = 0;
+
+        return;
+    }
+
+    if (ChangedEntityCount > World->ChangedEntityCapacity)
+    {
+        World->ChangedEntityCapacity = World->PickableEntityCapacity;
+        World->ChangedEntities =
+            (GCEntity*)GCMemory_Reallocate(World->ChangedEntities, World->ChangedEntityCapacity * sizeof(GCEntity));
+    }
+
+    for (uint32_t Counter = 0; Counter < EntityCount; Counter++)
+    {
+        World->ChangedEntities[World->ChangedEntityCount++] = (GCEntity)Entities[Counter];
+    }
+}
+
+void GCWorld_UpdateWorldMatrixRange(const uint32_t Start, const uint32_t End, void* Data)
+{
+    const GCWorldUpdateWorldMatricesData* const UpdateWorldMatricesData = (const GCWorldUpdateWorldMatricesData*)Data;
+
+    for (uint32_t Counter = Start; Counter < End; Counter++)
+    {
+        const GCTransformComponent* const TransformComponent = &UpdateWorldMatricesData->TransformComponents[Counter];
+        GCWorldMatrixComponent* const WorldMatrixComponent = &UpdateWorldMatricesData->WorldMatrixComponents[Counter];
+
+        WorldMatrixComponent->PreviousState =
+            UpdateWorldMatricesData->IsSimulated ? WorldMatrixComponent->State : *TransformComponent;
+        WorldMatrixComponent->State = *TransformComponent;
+        WorldMatrixComponent->Transform = GCTransformComponent_GetTransform(TransformComponent);
+        WorldMatrixComponent->InverseTransform = GCMatrix4x4_Inverse(&WorldMatrixComponent->Transform);
+        WorldMatrixComponent->TickIndex = UpdateWorldMatricesData->IsSimulated ? UpdateWorldMatricesData->TickIndex : 0;
+    }
+}
+
+void GCWorld_UpdateBoundingVolumeHierarchy(GCWorld* const World)
+{
+    World->PickableEntityCount = 0;
+
+    ecs_iter_t QueryIterator = ecs_query_iter(World->World, World->RenderQuery);
+
+    while (ecs_query_next(&QueryIterator))
+    {
+        const GCWorldMatrixComponent* const WorldMatrixComponents =
+            ecs_field(&QueryIterator, GCWorldMatrixComponent, 1);
+        const GCMeshComponent* const MeshComponents = ecs_field(&QueryIterator, GCMeshComponent, 2);
+
+        for (int32_t Counter = 0; Counter < QueryIterator.count; Counter++)
+        {
+            if (!MeshComponents[Counter].Mesh)
+            {
+                continue;
+            }
+
+            if (World->PickableEntityCount == World->PickableEntityCapacity)
+            {
+                World->PickableEntityCapacity = World->PickableEntityCapacity ? World->PickableEntityCapacity * 2 : 64;
+
+                World->PickableEntities = (GCEntity*)GCMemory_Reallocate(
+                    World->PickableEntities, World->PickableEntityCapacity * sizeof(GCEntity));
+                World->PickableModels = (const GCRendererModel**)GCMemory_Reallocate(
+                    World->PickableModels, World->PickableEntityCapacity * sizeof(const GCRendererModel*));
+                World->PickableInverseTransforms = (GCMatrix4x4*)GCMemory_Reallocate(
+                    World->PickableInverseTransforms, World->PickableEntityCapacity * sizeof(GCMatrix4x4));
+                World->PickableBoundingBoxes = (GCBoundingBox*)GCMemory_Reallocate(
+                    World->PickableBoundingBoxes, World->PickableEntityCapacity * sizeof(GCBoundingBox));
+                World->RefitPickableEntityIndices = (uint32_t*)GCMemory_Reallocate(
+                    World->RefitPickableEntityIndices, World->PickableEntityCapacity * sizeof(uint32_t));
+            }
+
+            const GCMatrix4x4* const Transform = &WorldMatrixComponents[Counter].Transform;
+            const GCRendererModel* const Model = MeshComponents[Counter].Mesh->Model;
+            const uint32_t PickableEntityIndex = World->PickableEntityCount++;
+
+            World->PickableEntities[PickableEntityIndex] = (GCEntity)QueryIterator.entities[Counter];
+            World->PickableModels[PickableEntityIndex] = Model;
+            World->PickableInverseTransforms[PickableEntityIndex] = WorldMatrixComponents[Counter].InverseTransform;
+            World->PickableBoundingBoxes[PickableEntityIndex] = GCBoundingBox_Transform(&Model->BoundingBox, Transform);
+        }
+    }
+
+    if (World->BoundingVolumeHierarchy)
+    {
+        GCBoundingVolumeHierarchy_Destroy(World->BoundingVolumeHierarchy);
+    }
+
+    World->BoundingVolumeHierarchy =
+        GCBoundingVolumeHierarchy_Create(World->PickableBoundingBoxes, World->PickableEntityCount);
+
+    if (World->PickableEntityTableCapacity < World->PickableEntityCapacity * 2)
+    {
+        World->PickableEntityTableCapacity = World->PickableEntityCapacity * 2;
+
+        GCMemory_Free(World->PickableEntityTable);
+        World->PickableEntityTable =
+            (uint32_t*)GCMemory_Allocate(World->PickableEntityTableCapacity * sizeof(uint32_t));
+    }
+
+    if (World->PickableEntityTableCapacity)
+    {
+        memset(World->PickableEntityTable, 0, World->PickableEntityTableCapacity * sizeof(uint32_t));
+    }
+
+    const uint32_t Mask = World->PickableEntityTableCapacity - 1;
+
+    for (uint32_t Counter = 0; Counter < World->PickableEntityCount; Counter++)
+    {
+        uint32_t Index = GCWorld_HashEntity(World->PickableEntities[Counter]) & Mask;
+
+        while (World->PickableEntityTable[Index])
+        {
+            Index = (Index + 1) & Mask;
+        }
+
+        World->PickableEntityTable[Index] = Counter + 1;
+    }
+
+    World->ChangedEntityCount = 0;
+    World->RefitEntityCount = 0;
+    World->IsBoundingVolumeHierarchyDirty = false;
+}
+
+void GCWorld_RefitBoundingVolumeHierarchy(GCWorld* const World)
+{
+    uint32_t RefitPickableEntityCount = 0;
+
+    for (uint32_t Counter = 0; Counter < World->ChangedEntityCount; Counter++)
+    {
+        const uint32_t PickableEntityIndex = GCWorld_FindPickableEntityIndex(World, World->ChangedEntities[Counter]);
+
+        if (PickableEntityIndex == UINT32_MAX)
+        {
+            continue;
+        }
+
+        const GCWorldMatrixComponent* const WorldMatrixComponent =
+            ecs_get(World->World, (ecs_entity_t)World->ChangedEntities[Counter], GCWorldMatrixComponent);
+
+        World->PickableInverseTransforms[PickableEntityIndex] = WorldMatrixComponent->InverseTransform;
+        World->PickableBoundingBoxes[PickableEntityIndex] = GCBoundingBox_Transform(
+            &World->PickableModels[PickableEntityIndex]->BoundingBox, &WorldMatrixComponent->Transform);
+        World->RefitPickableEntityIndices[RefitPickableEntityCount++] = PickableEntityIndex;
+    }
+
+    World->ChangedEntityCount = 0;
+    World->RefitEntityCount += RefitPickableEntityCount;
+
+    if (World->RefitEntityCount > World->PickableEntityCount)
+    {
+        GCWorld_UpdateBoundingVolumeHierarchy(World);
+
+        return;
+    }
+
+    GCBoundingVolumeHierarchy_Refit(World->BoundingVolumeHierarchy, World->RefitPickableEntityIndices,
+                                    World->PickableBoundingBoxes, RefitPickableEntityCount);
+}
+
+uint32_t GCWorld_HashEntity(const GCEntity Entity)
+{
+    uint64_t Hash = Entity;
+    Hash ^= Hash >> 33;
+    Hash *= 0xFF51AFD7ED558CCDull;
+    Hash ^= Hash >> 33;
+
+    return (uint32_t)Hash;
+}
+
+uint32_t GCWorld_FindPickableEntityIndex(const GCWorld* const World, const GCEntity Entity)
+{
+    if (!World->PickableEntityTableCapacity)
+    {
+        return UINT32_MAX;
+    }
+
+    const uint32_t Mask = World->PickableEntityTableCapacity - 1;
+
+    for (uint32_t Index = GCWorld_HashEntity(Entity) & Mask;; Index = (Index + 1) & Mask)
+    {
+        const uint32_t PickableEntityIndex = World->PickableEntityTable[Index];
+
+        if (!PickableEntityIndex)
+        {
+            return UINT32_MAX;
+        }
+
+        if (World->PickableEntities[PickableEntityIndex - 1] == Entity)
+        {
+            return PickableEntityIndex - 1;
+        }
+    }
+}
+
+bool GCWorld_CastRayAgainstEntity(void* const Context, const uint32_t PickableEntityIndex, const GCRay* const Ray,
+                                  const float MaximumDistance, float* const Distance)
+{
+    const GCWorld* const World = (const GCWorld*)Context;
+    const GCRay ModelRay = GCRay_Transform(Ray, &World->PickableInverseTransforms[PickableEntityIndex]);
+
+    return GCRendererModel_CastRay(World->PickableModels[PickableEntityIndex], &ModelRay, MaximumDistance, Distance);
+}
@@ -21,6 +21,7 @@
 #include "World/Entity.h"
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -30,11 +31,15 @@ extern "C"
     typedef struct GCWorld GCWorld;
     typedef struct GCWorldCamera GCWorldCamera;
     typedef struct GCEvent GCEvent;
+    typedef struct GCRay GCRay;
 
     GCWorld* GCWorld_Create(void);
     GCEntity GCWorld_CreateEntity(GCWorld* const World, const char* const Name);
-    bool GCWorld_CheckCollision(const GCWorld* const World, const GCEntity Entity);
-    void GCWorld_OnUpdate(GCWorld* const World);
+    uint32_t GCWorld_CheckCollision(const GCWorld* const World, const GCEntity Entity,
+                                    GCEntity* const CollidingEntities, const uint32_t MaximumCollidingEntityCount);
+    bool GCWorld_CastRay(GCWorld* const World, const GCRay* const Ray, GCEntity* const Entity, float* const Distance);
+    void GCWorld_OnTick(GCWorld* const World, const float DeltaTime);
+    void GCWorld_OnUpdate(GCWorld* const World, const float InterpolationFactor);
     void GCWorld_OnEvent(GCWorld* const World, GCEvent* const Event);
     GCWorldCamera* GCWorld_GetCamera(const GCWorld* const World);
 
@@ -0,0 +1,436 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "World/WorldSpatialHash.h"
+#include "Core/Memory/Allocator.h"
+#include "Math/Vector3.h"
+#include "World/Entity.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#define GC_WORLD_SPATIAL_HASH_INITIAL_CAPACITY 256
+
+typedef struct GCWorldSpatialHashCell
+{
+    int32_t X;
+    int32_t Z;
+    GCWorldSpatialHashItem* Items;
+    uint32_t ItemCount;
+    uint32_t ItemCapacity;
+    bool IsOccupied;
+} GCWorldSpatialHashCell;
+
+typedef struct GCWorldSpatialHashEntry
+{
+    GCEntity Entity;
+    int32_t CellX;
+    int32_t CellZ;
+} GCWorldSpatialHashEntry;
+
+typedef struct GCWorldSpatialHash
+{
+    float CellSize;
+
+    GCWorldSpatialHashCell* Cells;
+    uint32_t CellCount;
+    uint32_t CellCapacity;
+
+    GCWorldSpatialHashEntry* Entries;
+    uint32_t EntryCount;
+    uint32_t EntryCapacity;
+
+    GCWorldSpatialHashItem* QueryItems;
+    uint32_t QueryItemCapacity;
+} GCWorldSpatialHash;
+
+static int32_t GCWorldSpatialHash_GetCellCoordinate(const GCWorldSpatialHash* const SpatialHash, const float Position);
+static uint32_t GCWorldSpatialHash_HashCell(const int32_t X, const int32_t Z);
+static uint32_t GCWorldSpatialHash_HashEntity(const GCEntity Entity);
+static GCWorldSpatialHashCell* GCWorldSpatialHash_FindCell(const GCWorldSpatialHash* const SpatialHash, const int32_t X,
+                                                           const int32_t Z);
+static GCWorldSpatialHashCell* GCWorldSpatialHash_FindOrAddCell(GCWorldSpatialHash* const SpatialHash, const int32_t X,
+                                                                const int32_t Z);
+static GCWorldSpatialHashEntry* GCWorldSpatialHash_FindEntry(const GCWorldSpatialHash* const SpatialHash,
+                                                             const GCEntity Entity);
+static void GCWorldSpatialHash_AddEntry(GCWorldSpatialHash* const SpatialHash, const GCEntity Entity,
+                                        const int32_t CellX, const int32_t CellZ);
+static void GCWorldSpatialHash_RemoveEntry(GCWorldSpatialHash* const SpatialHash, GCWorldSpatialHashEntry* const Entry);
+static GCWorldSpatialHashItem* GCWorldSpatialHash_FindInCell(GCWorldSpatialHashCell* const Cell, const GCEntity Entity);
+static void GCWorldSpatialHash_AddToCell(GCWorldSpatialHashCell* const Cell, const GCEntity Entity,
+                                         const GCVector3 Position);
+static void GCWorldSpatialHash_RemoveFromCell(GCWorldSpatialHashCell* const Cell, const GCEntity Entity);
+static void GCWorldSpatialHash_ResizeCells(GCWorldSpatialHash* const SpatialHash);
+static void GCWorldSpatialHash_ResizeEntries(GCWorldSpatialHash* const SpatialHash);
+
+GCWorldSpatialHash* GCWorldSpatialHash_Create(const float CellSize)
+{
+    GCWorldSpatialHash* SpatialHash = (GCWorldSpatialHash*)GCMemory_Allocate(sizeof(GCWorldSpatialHash));
+    SpatialHash->CellSize = CellSize;
+
+    SpatialHash->CellCount = 0;
+    SpatialHash->CellCapacity = GC_WORLD_SPATIAL_HASH_INITIAL_CAPACITY;
+    SpatialHash->Cells = (GCWorldSpatialHashCell*)GCMemory_AllocateZero(SpatialHash->CellCapacity *
+                                                                        sizeof(GCWorldSpatialHashCell));
+
+    SpatialHash->EntryCount = 0;
+    SpatialHash->EntryCapacity = GC_WORLD_SPATIAL_HASH_INITIAL_CAPACITY;
+    SpatialHash->Entries = (GCWorldSpatialHashEntry*)GCMemory_AllocateZero(SpatialHash->EntryCapacity *
+                                                                          sizeof(GCWorldSpatialHashEntry));
+
+    SpatialHash->QueryItems = NULL;
+    SpatialHash->QueryItemCapacity = 0;
+
+    return SpatialHash;
+}
+
+void GCWorldSpatialHash_Insert(GCWorldSpatialHash* const SpatialHash, const GCEntity Entity, const GCVector3 Position)
+{
+    const int32_t CellX = GCWorldSpatialHash_GetCellCoordinate(SpatialHash, Position.X);
+    const int32_t CellZ = GCWorldSpatialHash_GetCellCoordinate(SpatialHash, Position.Z);
+
+    GCWorldSpatialHashEntry* const Entry = GCWorldSpatialHash_FindEntry(SpatialHash, Entity);
+
+    if (Entry)
+    {
+        if (Entry->CellX == CellX && Entry->CellZ == CellZ)
+        {
+            GCWorldSpatialHash_FindInCell(GCWorldSpatialHash_FindCell(SpatialHash, CellX, CellZ), Entity)->Position =
+                Position;
+
+            return;
+        }
+
+        GCWorldSpatialHash_RemoveFromCell(GCWorldSpatialHash_FindCell(SpatialHash, Entry->CellX, Entry->CellZ), Entity);
+
+        Entry->CellX = CellX;
+        Entry->CellZ = CellZ;
+    }
+    else
+    {
+        GCWorldSpatialHash_AddEntry(SpatialHash, Entity, CellX, CellZ);
+    }
+
+    GCWorldSpatialHash_AddToCell(GCWorldSpatialHash_FindOrAddCell(SpatialHash, CellX, CellZ), Entity, Position);
+}
+
+void GCWorldSpatialHash_Remove(GCWorldSpatialHash* const SpatialHash, const GCEntity Entity)
+{
+    GCWorldSpatialHashEntry* const Entry = GCWorldSpatialHash_FindEntry(SpatialHash, Entity);
+
+    if (!Entry)
+    {
+        return;
+    }
+
+    GCWorldSpatialHash_RemoveFromCell(GCWorldSpatialHash_FindCell(SpatialHash, Entry->CellX, Entry->CellZ), Entity);
+    GCWorldSpatialHash_RemoveEntry(SpatialHash, Entry);
+}
+
+uint32_t GCWorldSpatialHash_Query(GCWorldSpatialHash* const SpatialHash, const GCVector3 Minimum,
+                                  const GCVector3 Maximum, const GCWorldSpatialHashItem** const Items)
+{
+    const int32_t MinimumCellX = GCWorldSpatialHash_GetCellCoordinate(SpatialHash, Minimum.X);
+    const int32_t MinimumCellZ = GCWorldSpatialHash_GetCellCoordinate(SpatialHash, Minimum.Z);
+    const int32_t MaximumCellX = GCWorldSpatialHash_GetCellCoordinate(SpatialHash, Maximum.X);
+    const int32_t MaximumCellZ = GCWorldSpatialHash_GetCellCoordinate(SpatialHash, Maximum.Z);
+
+    uint32_t QueryItemCount = 0;
+
+    for (int32_t CellZ = MinimumCellZ; CellZ <= MaximumCellZ; CellZ++)
+    {
+        for (int32_t CellX = MinimumCellX; CellX <= MaximumCellX; CellX++)
+        {
+            const GCWorldSpatialHashCell* const Cell = GCWorldSpatialHash_FindCell(SpatialHash, CellX, CellZ);
+
+            if (!Cell || !Cell->ItemCount)
+            {
+                continue;
+            }
+
+            if (QueryItemCount + Cell->ItemCount > SpatialHash->QueryItemCapacity)
+            {
+                SpatialHash->QueryItemCapacity = (QueryItemCount + Cell->ItemCount) * 2;
+                SpatialHash->QueryItems = (GCWorldSpatialHashItem*)GCMemory_Reallocate(
+                    SpatialHash->QueryItems, SpatialHash->QueryItemCapacity * sizeof(GCWorldSpatialHashItem));
+            }
+
+            memcpy(&SpatialHash->QueryItems[QueryItemCount], Cell->Items,
+                   Cell->ItemCount * sizeof(GCWorldSpatialHashItem));
+            QueryItemCount += Cell->ItemCount;
+        }
+    }
+
+    *Items = SpatialHash->QueryItems;
+
+    return QueryItemCount;
+}
+
+void GCWorldSpatialHash_Destroy(GCWorldSpatialHash* SpatialHash)
+{
+    for (uint32_t Counter = 0; Counter < SpatialHash->CellCapacity; Counter++)
+    {
+        GCMemory_Free(SpatialHash->Cells[Counter].Items);
+    }
+
+    GCMemory_Free(SpatialHash->QueryItems);
+    GCMemory_Free(SpatialHash->Entries);
+    GCMemory_Free(SpatialHash->Cells);
+    GCMemory_Free(SpatialHash);
+}
+
+int32_t GCWorldSpatialHash_GetCellCoordinate(const GCWorldSpatialHash* const SpatialHash, const float Position)
+{
+    return (int32_t)floorf(Position / SpatialHash->CellSize);
+}
+
+uint32_t GCWorldSpatialHash_HashCell(const int32_t X, const int32_t Z)
+{
+    return ((uint32_t)X * 73856093u) ^ ((uint32_t)Z * 19349663u);
+}
+
+uint32_t GCWorldSpatialHash_HashEntity(const GCEntity Entity)
+{
+    uint64_t Hash = Entity;
+    Hash ^= Hash >> 33;
+    Hash *= 0xFF51AFD7ED558CCDull;
+    Hash ^= Hash >> 33;
+
+    return (uint32_t)Hash;
+}
+
+GCWorldSpatialHashCell* GCWorldSpatialHash_FindCell(const GCWorldSpatialHash* const SpatialHash, const int32_t X,
+                                                    const int32_t Z)
+{
+    const uint32_t Mask = SpatialHash->CellCapacity - 1;
+
+    for (uint32_t Index = GCWorldSpatialHash_HashCell(X, Z) & Mask;; Index = (Index + 1) & Mask)
+    {
+        GCWorldSpatialHashCell* const Cell = &SpatialHash->Cells[Index];
+
+        if (!Cell->IsOccupied)
+        {
+            return NULL;
+        }
+
+        if (Cell->X == X && Cell->Z == Z)
+        {
+            return Cell;
+        }
+    }
+}
+
+GCWorldSpatialHashCell* GCWorldSpatialHash_FindOrAddCell(GCWorldSpatialHash* const SpatialHash, const int32_t X,
+                                                         const int32_t Z)
+{
+    if ((SpatialHash->CellCount + 1) * 4 > SpatialHash->CellCapacity * 3)
+    {
+        GCWorldSpatialHash_ResizeCells(SpatialHash);
+    }
+
+    const uint32_t Mask = SpatialHash->CellCapacity - 1;
+
+    for (uint32_t Index = GCWorldSpatialHash_HashCell(X, Z) & Mask;; Index = (Index + 1) & Mask)
+    {
+        GCWorldSpatialHashCell* const Cell = &SpatialHash->Cells[Index];
+
+        if (!Cell->IsOccupied)
+        {
+            Cell->X = X;
+            Cell->Z = Z;
+            Cell->Items = NULL;
+            Cell->ItemCount = 0;
+            Cell->ItemCapacity = 0;
+            Cell->IsOccupied = true;
+
+            SpatialHash->CellCount++;
+
+            return Cell;
+        }
+
+        if (Cell->X == X && Cell->Z == Z)
+        {
+            return Cell;
+        }
+    }
+}
+
+GCWorldSpatialHashEntry* GCWorldSpatialHash_FindEntry(const GCWorldSpatialHash* const SpatialHash,
+                                                      const GCEntity Entity)
+{
+    const uint32_t Mask = SpatialHash->EntryCapacity - 1;
+
+    for (uint32_t Index = GCWorldSpatialHash_HashEntity(Entity) & Mask;; Index = (Index + 1) & Mask)
+    {
+        GCWorldSpatialHashEntry* const Entry = &SpatialHash->Entries[Index];
+
+        if (!Entry->Entity)
+        {
+            return NULL;
+        }
+
+        if (Entry->Entity == Entity)
+        {
+            return Entry;
+        }
+    }
+}
+
+void GCWorldSpatialHash_AddEntry(GCWorldSpatialHash* const SpatialHash, const GCEntity Entity, const int32_t CellX,
+                                 const int32_t CellZ)
+{
+    if ((SpatialHash->EntryCount + 1) * 4 > SpatialHash->EntryCapacity * 3)
+    {
+        GCWorldSpatialHash_ResizeEntries(SpatialHash);
+    }
+
+    const uint32_t Mask = SpatialHash->EntryCapacity - 1;
+    uint32_t Index = GCWorldSpatialHash_HashEntity(Entity) & Mask;
+
+    while (SpatialHash->Entries[Index].Entity)
+    {
+        Index = (Index + 1) & Mask;
+    }
+
+    SpatialHash->Entries[Index].Entity = Entity;
+    SpatialHash->Entries[Index].CellX = CellX;
+    SpatialHash->Entries[Index].CellZ = CellZ;
+
+    SpatialHash->EntryCount++;
+}
+
+void GCWorldSpatialHash_RemoveEntry(GCWorldSpatialHash* const SpatialHash, GCWorldSpatialHashEntry* const Entry)
+{
+    const uint32_t Mask = SpatialHash->EntryCapacity - 1;
+    uint32_t EmptyIndex = (uint32_t)(Entry - SpatialHash->Entries);
+
+    for (uint32_t Index = (EmptyIndex + 1) & Mask; SpatialHash->Entries[Index].Entity; Index = (Index + 1) & Mask)
+    {
+        const uint32_t HomeIndex = GCWorldSpatialHash_HashEntity(SpatialHash->Entries[Index].Entity) & Mask;
+
+        if (((Index - HomeIndex) & Mask) >= ((Index - EmptyIndex) & Mask))
+        {
+            SpatialHash->Entries[EmptyIndex] = SpatialHash->Entries[Index];
+            EmptyIndex = Index;
+        }
+    }
+
+    SpatialHash->Entries[EmptyIndex].Entity = 0;
+    SpatialHash->EntryCount--;
+}
+
+GCWorldSpatialHashItem* GCWorldSpatialHash_FindInCell(GCWorldSpatialHashCell* const Cell, const GCEntity Entity)
+{
+    for (uint32_t Counter = 0; Counter < Cell->ItemCount; Counter++)
+    {
+        if (Cell->Items[Counter].Entity == Entity)
+        {
+            return &Cell->Items[Counter];
+        }
+    }
+
+    return NULL;
+}
+
+void GCWorldSpatialHash_AddToCell(GCWorldSpatialHashCell* const Cell, const GCEntity Entity, const GCVector3 Position)
+{
+    if (Cell->ItemCount >= Cell->ItemCapacity)
+    {
+        Cell->ItemCapacity = Cell->ItemCapacity ? Cell->ItemCapacity * 2 : 4;
+        Cell->Items = (GCWorldSpatialHashItem*)GCMemory_Reallocate(Cell->Items,
+                                                                   Cell->ItemCapacity * sizeof(GCWorldSpatialHashItem));
+    }
+
+    Cell->Items[Cell->ItemCount].Entity = Entity;
+    Cell->Items[Cell->ItemCount].Position = Position;
+    Cell->ItemCount++;
+}
+
+void GCWorldSpatialHash_RemoveFromCell(GCWorldSpatialHashCell* const Cell, const GCEntity Entity)
+{
+    GCWorldSpatialHashItem* const Item = GCWorldSpatialHash_FindInCell(Cell, Entity);
+
+    if (Item)
+    {
+        Cell->ItemCount--;
+        *Item = Cell->Items[Cell->ItemCount];
+    }
+}
+
+void GCWorldSpatialHash_ResizeCells(GCWorldSpatialHash* const SpatialHash)
+{
+    GCWorldSpatialHashCell* const OldCells = SpatialHash->Cells;
+    const uint32_t OldCellCapacity = SpatialHash->CellCapacity;
+
+    SpatialHash->CellCapacity *= 2;
+    SpatialHash->Cells = (GCWorldSpatialHashCell*)GCMemory_AllocateZero(SpatialHash->CellCapacity *
+                                                                        sizeof(GCWorldSpatialHashCell));
+
+    const uint32_t Mask = SpatialHash->CellCapacity - 1;
+
+    for (uint32_t Counter = 0; Counter < OldCellCapacity; Counter++)
+    {
+        if (!OldCells[Counter].IsOccupied)
+        {
+            continue;
+        }
+
+        uint32_t Index = GCWorldSpatialHash_HashCell(OldCells[Counter].X, OldCells[Counter].Z) & Mask;
+
+        while (SpatialHash->Cells[Index].IsOccupied)
+        {
+            Index = (Index + 1) & Mask;
+        }
+
+        SpatialHash->Cells[Index] = OldCells[Counter];
+    }
+
+    GCMemory_Free(OldCells);
+}
+
+void GCWorldSpatialHash_ResizeEntries(GCWorldSpatialHash* const SpatialHash)
+{
+    GCWorldSpatialHashEntry* const OldEntries = SpatialHash->Entries;
+    const uint32_t OldEntryCapacity = SpatialHash->EntryCapacity;
+
+    SpatialHash->EntryCapacity *= 2;
+    SpatialHash->Entries = (GCWorldSpatialHashEntry*)GCMemory_AllocateZero(SpatialHash->EntryCapacity *
+                                                                          sizeof(GCWorldSpatialHashEntry));
+
+    const uint32_t Mask = SpatialHash->EntryCapacity - 1;
+
+    for (uint32_t Counter = 0; Counter < OldEntryCapacity; Counter++)
+    {
+        if (!OldEntries[Counter].Entity)
+        {
+            continue;
+        }
+
+        uint32_t Index = GCWorldSpatialHash_HashEntity(OldEntries[Counter].Entity) & Mask;
+
+        while (SpatialHash->Entries[Index].Entity)
+        {
+            Index = (Index + 1) & Mask;
+        }
+
+        SpatialHash->Entries[Index] = OldEntries[Counter];
+    }
+
+    GCMemory_Free(OldEntries);
+}
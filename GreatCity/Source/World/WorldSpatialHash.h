@@ -0,0 +1,51 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GC_WORLD_WORLD_SPATIAL_HASH_H
+#define GC_WORLD_WORLD_SPATIAL_HASH_H
+
+#include "Math/Vector3.h"
+#include "World/Entity.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct GCWorldSpatialHashItem
+    {
+        GCEntity Entity;
+        GCVector3 Position;
+    } GCWorldSpatialHashItem;
+
+    typedef struct GCWorldSpatialHash GCWorldSpatialHash;
+
+    GCWorldSpatialHash* GCWorldSpatialHash_Create(const float CellSize);
+    void GCWorldSpatialHash_Insert(GCWorldSpatialHash* const SpatialHash, const GCEntity Entity,
+                                   const GCVector3 Position);
+    void GCWorldSpatialHash_Remove(GCWorldSpatialHash* const SpatialHash, const GCEntity Entity);
+    uint32_t GCWorldSpatialHash_Query(GCWorldSpatialHash* const SpatialHash, const GCVector3 Minimum,
+                                      const GCVector3 Maximum, const GCWorldSpatialHashItem** const Items);
+    void GCWorldSpatialHash_Destroy(GCWorldSpatialHash* SpatialHash);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,84 @@
+project "JobSystemTest"
+    kind "ConsoleApp"
+    language "C"
+    cdialect "C11"
+    warnings "Extra"
+
+    targetdir "%{wks.location}/Binaries/%{cfg.architecture}/%{cfg.buildcfg}"
+    objdir "%{wks.location}/Intermediates/%{cfg.architecture}/%{cfg.buildcfg}"
+
+    files
+    {
+        "%{wks.location}/GreatCity/Tests/JobSystemTest.c",
+
+        "%{wks.location}/GreatCity/Source/Core/Jobs/JobSystem.c",
+        "%{wks.location}/GreatCity/Source/Core/Log.c",
+        "%{wks.location}/GreatCity/Source/Core/Memory/Allocator.c"
+    }
+
+    includedirs
+    {
+        "%{wks.location}/GreatCity/Source"
+    }
+
+    flags "FatalWarnings"
+
+    filter "system:windows"
+        systemversion "latest"
+
+        defines "GC_PLATFORM_WINDOWS"
+
+        files
+        {
+            "%{wks.location}/GreatCity/Source/Platform/Windows/Core/WindowsAtomic.c",
+            "%{wks.location}/GreatCity/Source/Platform/Windows/Core/WindowsClock.c",
+            "%{wks.location}/GreatCity/Source/Platform/Windows/Core/WindowsLog.c",
+            "%{wks.location}/GreatCity/Source/Platform/Windows/Core/WindowsThread.c"
+        }
+
+    filter "system:linux"
+        defines
+        {
+            "GC_PLATFORM_LINUX",
+            "_DEFAULT_SOURCE"
+        }
+
+        files
+        {
+            "%{wks.location}/GreatCity/Source/Platform/Linux/Core/LinuxAtomic.c",
+            "%{wks.location}/GreatCity/Source/Platform/Linux/Core/LinuxClock.c",
+            "%{wks.location}/GreatCity/Source/Platform/Linux/Core/LinuxLog.c",
+            "%{wks.location}/GreatCity/Source/Platform/Linux/Core/LinuxThread.c"
+        }
+
+        links
+        {
+            "pthread",
+            "m"
+        }
+
+    filter "configurations:Debug"
+        defines
+        {
+            "GC_BUILD_TYPE_DEBUG",
+            "GC_ASSERT_ENABLED"
+        }
+
+        runtime "Debug"
+        symbols "On"
+
+    filter "configurations:Release"
+        defines
+        {
+            "GC_BUILD_TYPE_RELEASE",
+            "GC_ASSERT_ENABLED"
+        }
+
+        runtime "Release"
+        symbols "On"
+
+    filter "configurations:Distribution"
+        defines "GC_BUILD_TYPE_DISTRIBUTION"
+
+        runtime "Release"
+        optimize "On"
@@ -0,0 +1,147 @@
+/*
+    Copyright (C) 2023  Rohfel Adyaraka Christianugrah Puspoasmoro
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Core/Atomic.h"
+#include "Core/Clock.h"
+#include "Core/Jobs/JobSystem.h"
+#include "Core/Log.h"
+#include "Core/Thread.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define GC_JOB_SYSTEM_TEST_FRAME_JOB_TIME 0.05
+#define GC_JOB_SYSTEM_TEST_BACKGROUND_CHUNK_TIME 0.1
+#define GC_JOB_SYSTEM_TEST_BACKGROUND_CHUNK_COUNT 4
+
+typedef struct GCJobSystemTestData
+{
+    volatile int64_t IsFrameJobRunning;
+    volatile int64_t BackgroundChunkCount;
+    volatile int64_t MainThreadBackgroundChunkCount;
+} GCJobSystemTestData;
+
+static void GCJobSystemTest_Spin(const double Time);
+static void GCJobSystemTest_RunFrameJob(void* Data);
+static void GCJobSystemTest_RunBackgroundJob(void* Data);
+static void GCJobSystemTest_RunBackgroundChunks(const uint32_t Start, const uint32_t End, void* Data);
+static bool GCJobSystemTest_FrameWaitSkipsBackgroundJobs(void);
+
+int main(void)
+{
+    GCJobSystem_Initialize(1);
+
+    const bool IsPassed = GCJobSystemTest_FrameWaitSkipsBackgroundJobs();
+
+    GCJobSystem_Terminate();
+
+    if (!IsPassed)
+    {
+        GC_LOG_ERROR("GCJobSystemTest_FrameWaitSkipsBackgroundJobs failed");
+
+        return 1;
+    }
+
+    GC_LOG_INFORMATION("GCJobSystemTest_FrameWaitSkipsBackgroundJobs passed");
+
+    return 0;
+}
+
+void GCJobSystemTest_Spin(const double Time)
+{
+    const double StartTime = GCClock_GetTime();
+
+    while (GCClock_GetTime() - StartTime < Time)
+    {
+        GCThread_Yield();
+    }
+}
+
+void GCJobSystemTest_RunFrameJob(void* Data)
+{
+    GCJobSystemTestData* const TestData = (GCJobSystemTestData*)Data;
+
+    GCAtomic_Store(&TestData->IsFrameJobRunning, 1);
+
+    GCJobSystemTest_Spin(GC_JOB_SYSTEM_TEST_FRAME_JOB_TIME);
+}
+
+void GCJobSystemTest_RunBackgroundJob(void* Data)
+{
+    GCJobCounter* const ChunkCounter = GCJobCounter_Create();
+
+    GCJobSystem_ParallelFor(GC_JOB_SYSTEM_TEST_BACKGROUND_CHUNK_COUNT, 1, GCJobSystemTest_RunBackgroundChunks, Data,
+                            ChunkCounter);
+    GCJobSystem_Wait(ChunkCounter);
+
+    GCJobCounter_Destroy(ChunkCounter);
+}
+
+void GCJobSystemTest_RunBackgroundChunks(const uint32_t Start, const uint32_t End, void* Data)
+{
+    GCJobSystemTestData* const TestData = (GCJobSystemTestData*)Data;
+
+    for (uint32_t Counter = Start; Counter < End; Counter++)
+    {
+        if (!GCJobSystem_GetThreadIndex())
+        {
+            GCAtomic_Add(&TestData->MainThreadBackgroundChunkCount, 1);
+        }
+
+        GCJobSystemTest_Spin(GC_JOB_SYSTEM_TEST_BACKGROUND_CHUNK_TIME);
+
+        GCAtomic_Add(&TestData->BackgroundChunkCount, 1);
+    }
+}
+
+bool GCJobSystemTest_FrameWaitSkipsBackgroundJobs(void)
+{
+    GCJobSystemTestData TestData;
+    TestData.IsFrameJobRunning = 0;
+    TestData.BackgroundChunkCount = 0;
+    TestData.MainThreadBackgroundChunkCount = 0;
+
+    GCJobCounter* const FrameCounter = GCJobCounter_Create();
+    GCJobCounter* const BackgroundCounter = GCJobCounter_Create();
+
+    GCJobSystem_Run(GCJobSystemTest_RunFrameJob, &TestData, FrameCounter);
+
+    while (!GCAtomic_Load(&TestData.IsFrameJobRunning))
+    {
+        GCThread_Yield();
+    }
+
+    GCJobSystem_RunBackground(GCJobSystemTest_RunBackgroundJob, &TestData, BackgroundCounter);
+
+    const double StartTime = GCClock_GetTime();
+
+    GCJobSystem_Wait(FrameCounter);
+
+    const double FrameWaitTime = GCClock_GetTime() - StartTime;
+
+    GCJobSystem_Wait(BackgroundCounter);
+
+    GCJobCounter_Destroy(BackgroundCounter);
+    GCJobCounter_Destroy(FrameCounter);
+
+    GC_LOG_INFORMATION("Frame wait took %.3f ms with a %.3f ms background job pending", FrameWaitTime * 1000.0,
+                       GC_JOB_SYSTEM_TEST_BACKGROUND_CHUNK_TIME * GC_JOB_SYSTEM_TEST_BACKGROUND_CHUNK_COUNT * 1000.0);
+
+    return FrameWaitTime < GC_JOB_SYSTEM_TEST_BACKGROUND_CHUNK_TIME &&
+           GCAtomic_Load(&TestData.BackgroundChunkCount) == GC_JOB_SYSTEM_TEST_BACKGROUND_CHUNK_COUNT &&
+           !GCAtomic_Load(&TestData.MainThreadBackgroundChunkCount);
+}
@@ -0,0 +1,4 @@
+#!/bin/sh
+
+cd "$(dirname "$0")/.."
+premake5 --file=GreatCity.build.lua --os=linux gmake2